@@ -13,6 +13,8 @@
 #include "chi_mpi.h"
 #include "chi_log.h"
 #include "utils/chi_timer.h"
+#include "utils/chi_perf_region.h"
+#include "utils/chi_hw_counters.h"
 
 #include <iostream>
 
@@ -51,6 +53,12 @@ bool Chi::run_time::allow_petsc_error_handler_ = false;
 bool Chi::run_time::supress_beg_end_timelog_ = false;
 bool Chi::run_time::suppress_color_ = false;
 bool Chi::run_time::dump_registry_ = false;
+size_t Chi::run_time::num_mesh_threads_ = 1;
+int Chi::run_time::num_energy_comms_ = 1;
+bool Chi::run_time::perf_report_ = false;
+std::string Chi::run_time::perf_report_json_file_;
+bool Chi::run_time::hw_counters_ = false;
+uint64_t Chi::run_time::hw_counters_raw_event_ = 0;
 
 const std::string Chi::run_time::command_line_help_string_ =
   "\nUsage: exe inputfile [options values]\n"
@@ -65,6 +73,27 @@ const std::string Chi::run_time::command_line_help_string_ =
   "     --suppress_color            Suppresses the printing of color.\n"
   "                                 useful for unit tests requiring a diff.\n"
   "     --dump-object-registry      Dumps the object registry.\n"
+  "     --mesh_threads=N            Number of threads used by mesh\n"
+  "                                 setup operations. Default 1.\n"
+  "     --energy_comms=K            Splits the processes into K equal\n"
+  "                                 communicators, each running the input\n"
+  "                                 on its own copy of the mesh. LBS\n"
+  "                                 groupsets are distributed over the\n"
+  "                                 communicators and solved concurrently\n"
+  "                                 (block-Jacobi in energy). Only the\n"
+  "                                 first communicator prints LOG_0 output;\n"
+  "                                 file output is not coordinated, use\n"
+  "                                 chi_energy_color to guard it. Default 1.\n"
+  "     --perf_report               Prints a report of the performance\n"
+  "                                 regions at exit.\n"
+  "     --perf_report_json=FILE     Same as --perf_report and also\n"
+  "                                 writes the report to a JSON file.\n"
+  "     --hw_counters               Collects hardware counters (Linux\n"
+  "                                 perf_event_open) for the performance\n"
+  "                                 regions. Implies --perf_report.\n"
+  "     --hw_counters_raw=CODE      Same as --hw_counters and also counts\n"
+  "                                 the CPU-specific raw event CODE,\n"
+  "                                 e.g. 0x01c7.\n"
   "\n\n\n";
 
 // ############################################### Argument parser
@@ -81,8 +110,32 @@ void Chi::run_time::ParseArguments(int argc, char** argv)
 
     Chi::log.Log() << "Parsing argument " << i << " " << argument;
 
-    if (argument.find("-h") != std::string::npos or
-        argument.find("--help") != std::string::npos)
+    //================================================ Hardware counters
+    // Checked first since the option names contain "-h"
+    if (argument.find("--hw_counters_raw=") != std::string::npos)
+    {
+      const std::string value = argument.substr(argument.find('=') + 1);
+      try
+      {
+        Chi::run_time::hw_counters_raw_event_ = std::stoull(value, nullptr, 0);
+      }
+      catch (const std::exception&)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "--hw_counters_raw. Expected an event code."
+                  << std::endl;
+        Chi::Exit(EXIT_FAILURE);
+      }
+      Chi::run_time::hw_counters_ = true;
+      Chi::run_time::perf_report_ = true;
+    }
+    else if (argument.find("--hw_counters") != std::string::npos)
+    {
+      Chi::run_time::hw_counters_ = true;
+      Chi::run_time::perf_report_ = true;
+    }
+    else if (argument.find("-h") != std::string::npos or
+             argument.find("--help") != std::string::npos)
     {
       Chi::log.Log() << Chi::run_time::command_line_help_string_;
       Chi::run_time::termination_posted_ = true;
@@ -104,6 +157,38 @@ void Chi::run_time::ParseArguments(int argc, char** argv)
       Chi::run_time::dump_registry_ = true;
       Chi::run_time::termination_posted_ = true;
     }
+    else if (argument.find("--mesh_threads=") != std::string::npos)
+    {
+      const std::string value = argument.substr(argument.find('=') + 1);
+      try
+      {
+        Chi::run_time::num_mesh_threads_ =
+          std::max(1, std::stoi(value));
+      }
+      catch (const std::invalid_argument& e)
+      {
+        std::cerr << "Invalid option used with command line argument "
+                     "--mesh_threads. Expected a positive integer."
+                  << std::endl;
+        Chi::Exit(EXIT_FAILURE);
+      }
+    }
+    else if (argument.find("--energy_comms=") != std::string::npos)
+    {
+      // Already applied in Chi::Initialize, the communicator is split
+      // before the arguments are parsed
+    }
+    //================================================ Performance report
+    else if (argument.find("--perf_report_json=") != std::string::npos)
+    {
+      Chi::run_time::perf_report_ = true;
+      Chi::run_time::perf_report_json_file_ =
+        argument.substr(argument.find('=') + 1);
+    }
+    else if (argument.find("--perf_report") != std::string::npos)
+    {
+      Chi::run_time::perf_report_ = true;
+    }
     //================================================ No-graphics option
     else if (argument.find("-b") != std::string::npos)
     {
@@ -157,6 +242,34 @@ void Chi::run_time::ParseArguments(int argc, char** argv)
   }
 }
 
+// ###################################################################
+/**Returns the number of energy communicators requested with
+ * `--energy_comms=K`, or 1 if the option is absent. Parsed separately from
+ * the other arguments since it is needed before the communicator is set.*/
+int Chi::run_time::ParseEnergyCommsArgument(int argc, char** argv)
+{
+  int num_energy_comms = 1;
+  for (int i = 1; i < argc; i++)
+  {
+    const std::string argument(argv[i]);
+    if (argument.find("--energy_comms=") == std::string::npos) continue;
+
+    const std::string value = argument.substr(argument.find('=') + 1);
+    try
+    {
+      num_energy_comms = std::max(1, std::stoi(value));
+    }
+    catch (const std::invalid_argument& e)
+    {
+      std::cerr << "Invalid option used with command line argument "
+                   "--energy_comms. Expected a positive integer."
+                << std::endl;
+      Chi::Exit(EXIT_FAILURE);
+    }
+  }
+  return num_energy_comms;
+}
+
 // ############################################### Initialize ChiTech
 /**Initializes all necessary items for ChiTech.
 \param argc int    Number of arguments supplied.
@@ -172,6 +285,45 @@ int Chi::Initialize(int argc,
   MPI_Comm_rank(communicator, &location_id);      /* get cur process id */
   MPI_Comm_size(communicator, &number_processes); /* get num of processes */
 
+  //============================================= Energy communicators
+  // Split before anything else uses the communicator
+  MPI_Comm energy_communicator = MPI_COMM_SELF;
+  const MPI_Comm world_communicator = communicator;
+  run_time::num_energy_comms_ =
+    run_time::ParseEnergyCommsArgument(argc, argv);
+  const int num_energy_comms = run_time::num_energy_comms_;
+  int energy_color = 0;
+  if (num_energy_comms > 1)
+  {
+    if (number_processes % num_energy_comms != 0)
+    {
+      if (location_id == 0)
+        std::cerr << "The number of processes (" << number_processes
+                  << ") must be a multiple of --energy_comms ("
+                  << num_energy_comms << ")." << std::endl;
+      Chi::Exit(EXIT_FAILURE);
+    }
+
+    const int comm_size = number_processes / num_energy_comms;
+    energy_color = location_id / comm_size;
+
+    MPI_Comm solver_communicator;
+    MPI_Comm_split(world_communicator,          //comm
+                   energy_color,                //color
+                   location_id,                 //key
+                   &solver_communicator);       //newcomm
+    MPI_Comm_split(world_communicator,          //comm
+                   location_id % comm_size,     //color
+                   location_id,                 //key
+                   &energy_communicator);       //newcomm
+
+    communicator = solver_communicator;
+    MPI_Comm_rank(communicator, &location_id);
+    MPI_Comm_size(communicator, &number_processes);
+  }
+  mpi.SetEnergyDecomposition(world_communicator, energy_communicator,
+                             energy_color, num_energy_comms);
+
   mpi.SetCommunicator(communicator);
   mpi.SetLocationID(location_id);
   mpi.SetProcessCount(number_processes);
@@ -181,6 +333,12 @@ int Chi::Initialize(int argc,
 
   run_time::ParseArguments(argc, argv);
 
+  // Regions and counters are recorded for the thread creating them
+  chi::PerfRegistry::GetInstance();
+  if (run_time::hw_counters_)
+    chi::HardwareCounters::GetInstance().Enable(
+      run_time::hw_counters_raw_event_);
+
   run_time::InitPetSc(argc, argv);
 
   return 0;
@@ -216,6 +374,14 @@ void Chi::Finalize()
   multigroup_xs_stack.clear();
 
   PetscFinalize();
+
+  if (mpi.num_energy_colors > 1)
+  {
+    MPI_Comm solver_communicator = mpi.comm;
+    MPI_Comm energy_communicator = mpi.energy_comm;
+    MPI_Comm_free(&solver_communicator);
+    MPI_Comm_free(&energy_communicator);
+  }
   MPI_Finalize();
 }
 
@@ -255,6 +421,10 @@ int Chi::RunInteractive(int argc, char** argv)
 
   Chi::console.RunConsoleLoop();
 
+  if (Chi::run_time::perf_report_)
+    chi::PerfRegistry::GetInstance().PrintReport(
+      Chi::run_time::perf_report_json_file_);
+
   if (not Chi::run_time::supress_beg_end_timelog_)
   {
     Chi::log.Log() << "Final program time " << program_timer.GetTimeString();
@@ -311,6 +481,10 @@ int Chi::RunBatch(int argc, char** argv)
     }
   }
 
+  if (Chi::run_time::perf_report_)
+    chi::PerfRegistry::GetInstance().PrintReport(
+      Chi::run_time::perf_report_json_file_);
+
   if (not Chi::run_time::supress_beg_end_timelog_)
   {
     Chi::log.Log() << "\nFinal program time " << program_timer.GetTimeString();
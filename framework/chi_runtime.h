@@ -6,6 +6,7 @@
 #include <string>
 #include <stdexcept>
 #include <memory>
+#include <cstdint>
 
 #include "chi_mpi.h"
 
@@ -107,12 +108,19 @@ public:
     static bool supress_beg_end_timelog_;
     static bool suppress_color_;
     static bool dump_registry_;
+    static size_t num_mesh_threads_;
+    static int num_energy_comms_;
+    static bool perf_report_;
+    static std::string perf_report_json_file_;
+    static bool hw_counters_;
+    static uint64_t hw_counters_raw_event_;
 
     static const std::string command_line_help_string_;
 
   private:
     friend class Chi;
     static void ParseArguments(int argc, char** argv);
+    static int ParseEnergyCommsArgument(int argc, char** argv);
     static int InitPetSc(int argc, char** argv);
 
   public:
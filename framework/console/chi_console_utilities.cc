@@ -2,6 +2,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
 
 #include "chi_utils.h"
 
@@ -47,7 +48,8 @@ int chi::Console::ExecuteFile(const std::string& fileName,
 }
 
 // ###################################################################
-/**Pushes location id and number of processes to lua state.*/
+/**Pushes location id, number of processes and the energy
+ * decomposition to lua state.*/
 void chi::Console::PostMPIInfo(int location_id,
                                   int number_of_processes) const
 {
@@ -58,6 +60,12 @@ void chi::Console::PostMPIInfo(int location_id,
 
   lua_pushnumber(L, number_of_processes);
   lua_setglobal(L, "chi_number_of_processes");
+
+  lua_pushnumber(L, Chi::mpi.energy_color);
+  lua_setglobal(L, "chi_energy_color");
+
+  lua_pushnumber(L, Chi::mpi.num_energy_colors);
+  lua_setglobal(L, "chi_number_of_energy_comms");
 }
 
 // ###################################################################
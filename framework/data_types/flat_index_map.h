@@ -0,0 +1,109 @@
+#ifndef CHITECH_FLAT_INDEX_MAP_H
+#define CHITECH_FLAT_INDEX_MAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+
+namespace chi_data_types
+{
+
+// ##################################################################
+/**Open-addressing (linear probing) hash map from a 64-bit global id to
+ * a 64-bit local index. Keys and values are stored in a single flat
+ * array so that a lookup touches, on average, a single cache line, as
+ * opposed to the pointer chasing of a std::map. Entries can only be
+ * added, never removed, which is all that global-to-local index
+ * mappings require.*/
+class FlatIndexMap
+{
+public:
+  static constexpr uint64_t INVALID = std::numeric_limits<uint64_t>::max();
+
+private:
+  struct Slot
+  {
+    uint64_t key = INVALID;
+    uint64_t value = INVALID;
+  };
+
+  std::vector<Slot> slots_;
+  size_t size_ = 0;
+
+  static uint64_t Hash(uint64_t key)
+  {
+    key += 0x9e3779b97f4a7c15ULL;
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+  }
+
+  /**Returns the index of the slot holding the key, or of the empty
+   * slot where it belongs.*/
+  size_t Probe(uint64_t key) const
+  {
+    const size_t mask = slots_.size() - 1;
+    size_t s = Hash(key) & mask;
+    while (slots_[s].key != INVALID and slots_[s].key != key)
+      s = (s + 1) & mask;
+    return s;
+  }
+
+  void Rehash(size_t capacity)
+  {
+    std::vector<Slot> old_slots(capacity);
+    old_slots.swap(slots_);
+    for (const auto& slot : old_slots)
+      if (slot.key != INVALID)
+        slots_[Probe(slot.key)] = slot;
+  }
+
+public:
+  /**Makes sure `num_entries` can be stored without rehashing. The load
+   * factor is kept at or below one half.*/
+  void Reserve(size_t num_entries)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * num_entries) capacity *= 2;
+    if (capacity > slots_.size()) Rehash(capacity);
+  }
+
+  /**Adds a key-value pair. As with std::map::insert, an existing key is
+   * not overwritten. Returns `true` if the pair was added.*/
+  bool Insert(uint64_t key, uint64_t value)
+  {
+    if (2 * (size_ + 1) > slots_.size()) Reserve(size_ + 1);
+
+    auto& slot = slots_[Probe(key)];
+    if (slot.key == key) return false;
+
+    slot = {key, value};
+    ++size_;
+    return true;
+  }
+
+  /**Returns the value associated with a key, or `INVALID`.*/
+  uint64_t Find(uint64_t key) const
+  {
+    if (size_ == 0) return INVALID;
+    return slots_[Probe(key)].value;
+  }
+
+  /**Returns the number of entries.*/
+  size_t size() const {return size_;}
+
+  /**Removes all entries and releases the storage.*/
+  void clear()
+  {
+    std::vector<Slot>().swap(slots_);
+    size_ = 0;
+  }
+
+  /**Approximate memory used by the map, in bytes.*/
+  size_t MemoryUsage() const {return slots_.size() * sizeof(Slot);}
+};
+
+}//namespace chi_data_types
+
+#endif //CHITECH_FLAT_INDEX_MAP_H
@@ -6,6 +6,7 @@
 #include "stringstream_color.h"
 
 #include <sstream>
+#include <algorithm>
 
 //###################################################################
 /**Access to the singleton*/
@@ -25,11 +26,19 @@ chi::ChiLog::ChiLog() noexcept
 
   RepeatingEvent& ref_rep_event = repeating_events.back();
 
-  ref_rep_event.events.emplace_back(Chi::program_timer.GetTime(),
+  ref_rep_event.AddEvent(Chi::program_timer.GetTime(),
     EventType::EVENT_CREATED,
     std::make_shared<EventInfo>());
 }
 
+//###################################################################
+/**Returns true on the location printing the LOG_0 entries, i.e., location 0
+ * of the first energy communicator.*/
+static bool IsLogLocation()
+{
+  return Chi::mpi.location_id == 0 and Chi::mpi.energy_color == 0;
+}
+
 //###################################################################
 /** Makes a log entry.*/
 chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
@@ -39,7 +48,7 @@ chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     case LOG_0VERBOSE_0:
     case LOG_0:
     {
-      if (Chi::mpi.location_id == 0)
+      if (IsLogLocation())
       {
         std::string header = "[" + std::to_string(Chi::mpi.location_id) + "]  ";
         return {&std::cout, header};
@@ -52,7 +61,7 @@ chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     }
     case LOG_0WARNING:
     {
-      if (Chi::mpi.location_id == 0)
+      if (IsLogLocation())
       {
         std::string header = "[" + std::to_string(Chi::mpi.location_id) + "]  ";
         header += StringStreamColor(FG_YELLOW) + "**WARNING** ";
@@ -66,7 +75,7 @@ chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     }
     case LOG_0ERROR:
     {
-      if (Chi::mpi.location_id == 0)
+      if (IsLogLocation())
       {
         std::string header = "[" + std::to_string(Chi::mpi.location_id) + "]  ";
         header += StringStreamColor(FG_RED) + "**!**ERROR**!** ";
@@ -81,7 +90,7 @@ chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
 
     case LOG_0VERBOSE_1:
     {
-      if ((Chi::mpi.location_id == 0) && (verbosity_ >= 1))
+      if (IsLogLocation() && (verbosity_ >= 1))
       {
         std::string header = "[" + std::to_string(Chi::mpi.location_id) + "]  ";
         header += StringStreamColor(FG_CYAN);
@@ -95,7 +104,7 @@ chi::LogStream chi::ChiLog::Log(LOG_LVL level/*=LOG_0*/)
     }
     case ChiLog::LOG_LVL::LOG_0VERBOSE_2:
     {
-      if ((Chi::mpi.location_id == 0) && (verbosity_ >= 2))
+      if (IsLogLocation() && (verbosity_ >= 2))
       {
         std::string header = "[" + std::to_string(Chi::mpi.location_id) + "]  ";
         header += StringStreamColor(FG_MAGENTA);
@@ -183,7 +192,7 @@ size_t chi::ChiLog::GetRepeatingEventTag(std::string event_name)
 
   RepeatingEvent& ref_rep_event = repeating_events.back();
 
-  ref_rep_event.events.emplace_back(Chi::program_timer.GetTime(),
+  ref_rep_event.AddEvent(Chi::program_timer.GetTime(),
     EventType::EVENT_CREATED,
     std::make_shared<EventInfo>());
 
@@ -201,7 +210,7 @@ void chi::ChiLog::LogEvent(size_t ev_tag,
 
   RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  ref_rep_event.events.emplace_back(
+  ref_rep_event.AddEvent(
     Chi::program_timer.GetTime(),
     ev_type,
     ev_info);
@@ -217,12 +226,28 @@ void chi::ChiLog::LogEvent(size_t ev_tag,
 
   RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  ref_rep_event.events.emplace_back(
+  ref_rep_event.AddEvent(
     Chi::program_timer.GetTime(),
     ev_type,
     nullptr);
 }
 
+//###################################################################
+/**Sets the number of raw events retained for PrintEventHistory. When the
+ * capacity is reduced the oldest events are discarded. A capacity of zero
+ * retains no raw events. The aggregated event statistics are unaffected.*/
+void chi::ChiLog::SetEventHistoryCapacity(size_t ev_tag, size_t capacity)
+{
+  if (ev_tag >= repeating_events.size())
+    return;
+
+  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+
+  ref_rep_event.history_capacity = capacity;
+  while (ref_rep_event.history.size() > capacity)
+    ref_rep_event.history.pop_front();
+}
+
 //###################################################################
 /**Returns a string representation of the event history associated with
  * the tag. Each event entry will be prepended by the location id and
@@ -237,7 +262,7 @@ std::string chi::ChiLog::PrintEventHistory(size_t ev_tag)
 
   RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
-  for (auto& event : ref_rep_event.events)
+  for (auto& event : ref_rep_event.history)
   {
     outstr << "[" << Chi::mpi.location_id << "] ";
 
@@ -278,90 +303,88 @@ double chi::ChiLog::ProcessEvent(size_t ev_tag,
   if (ev_tag >= repeating_events.size())
     return 0.0;
 
-  RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
+  const RepeatingEvent& ref_rep_event = repeating_events[ev_tag];
 
   double ret_val = 0.0;
   switch (ev_operation)
   {
     case EventOperation::NUMBER_OF_OCCURRENCES:
-    {
-      for (auto& event : ref_rep_event.events)
-      {
-        if ( (event.ev_type == EventType::EVENT_CREATED) or
-             (event.ev_type == EventType::SINGLE_OCCURRENCE) or
-             (event.ev_type == EventType::EVENT_BEGIN))
-          ret_val += 1.0;
-      }//for events
+      ret_val = static_cast<double>(ref_rep_event.num_occurrences);
       break;
-    }
     case EventOperation::TOTAL_DURATION:
-    {
-      double start_time = 0.0;
-      for (auto& event : ref_rep_event.events)
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN)
-          start_time = event.ev_time;
-        if (event.ev_type == EventType::EVENT_END)
-          ret_val += event.ev_time - start_time;
-      }//for events
-      ret_val *= 1000.0;
+      ret_val = ref_rep_event.total_duration*1000.0;
       break;
-    }
     case EventOperation::AVERAGE_DURATION:
-    {
-      double start_time = 0.0;
-      int counter = 0;
-      for (auto& event : ref_rep_event.events)
-      {
-        if (event.ev_type == EventType::EVENT_BEGIN)
-          start_time = event.ev_time;
-
-        if (event.ev_type == EventType::EVENT_END)
-        {
-          ret_val += event.ev_time - start_time;
-          counter++;
-        }
-      }//for events
-      ret_val /= (1000.0*counter);
+      ret_val = ref_rep_event.total_duration/
+                (1000.0*static_cast<double>(ref_rep_event.num_durations));
       break;
-    }
     case EventOperation::MAX_VALUE:
-    {
-      ret_val = 0.0;
-      for (auto& event : ref_rep_event.events)
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-            ret_val = std::max(event.ev_info->arb_value,ret_val);
-        }
-      }//for events
+      ret_val = ref_rep_event.max_value;
       break;
-    }
     case EventOperation::AVERAGE_VALUE:
     {
-      ret_val = 0.0;
-      int count = 0;
-      for (auto& event : ref_rep_event.events)
-      {
-        if ((event.ev_type == EventType::SINGLE_OCCURRENCE) or
-            (event.ev_type == EventType::EVENT_BEGIN) or
-            (event.ev_type == EventType::EVENT_END))
-        {
-          if (event.ev_info != nullptr)
-          {
-            ret_val += event.ev_info->arb_value;
-            ++count;
-          }
-        }
-      }//for events
-      if (count == 0) count = 1;
-      ret_val /= count;
+      const size_t count = std::max<size_t>(ref_rep_event.num_values, 1);
+      ret_val = ref_rep_event.total_value/static_cast<double>(count);
       break;
     }
+    case EventOperation::MIN_DURATION:
+      if (ref_rep_event.num_durations > 0)
+        ret_val = ref_rep_event.min_duration/1000.0;
+      break;
+    case EventOperation::MAX_DURATION:
+      ret_val = ref_rep_event.max_duration/1000.0;
+      break;
+    case EventOperation::MIN_VALUE:
+      if (ref_rep_event.num_values > 0)
+        ret_val = ref_rep_event.min_value;
+      break;
   }//switch
 
   return ret_val;
 }
+
+//###################################################################
+/**Adds an event to the running aggregates and to the history ring buffer.
+ * The aggregates reproduce what a scan over all events would give: a
+ * duration is measured from the most recent begin to each end, and values
+ * are taken from the EventInfo of every non-creation event.*/
+void chi::ChiLog::RepeatingEvent::AddEvent(double ev_time,
+                                           EventType ev_type,
+                                           std::shared_ptr<EventInfo> ev_info)
+{
+  switch (ev_type)
+  {
+    case EventType::EVENT_CREATED:
+    case EventType::SINGLE_OCCURRENCE:
+      ++num_occurrences;
+      break;
+    case EventType::EVENT_BEGIN:
+      ++num_occurrences;
+      last_begin_time = ev_time;
+      break;
+    case EventType::EVENT_END:
+    {
+      const double duration = ev_time - last_begin_time;
+      ++num_durations;
+      total_duration += duration;
+      min_duration = std::min(min_duration, duration);
+      max_duration = std::max(max_duration, duration);
+      break;
+    }
+  }
+
+  if (ev_type != EventType::EVENT_CREATED and ev_info != nullptr)
+  {
+    const double value = ev_info->arb_value;
+    ++num_values;
+    total_value += value;
+    min_value = std::min(min_value, value);
+    max_value = std::max(max_value, value);
+  }
+
+  if (history_capacity == 0) return;
+
+  if (history.size() >= history_capacity)
+    history.pop_front();
+  history.emplace_back(ev_time, ev_type, std::move(ev_info));
+}
@@ -6,7 +6,9 @@
 
 #include <utility>
 #include <vector>
+#include <deque>
 #include <memory>
+#include <limits>
 
 //###################################################################
 namespace chi
@@ -117,11 +119,22 @@ namespace chi
      * and initialize it at construction then all of the objects methods can
      * contribute to the event.
      *
+     * ### Memory use
+     * Logging an event does not store it. Instead each repeating event
+     * aggregates, as events arrive, the number of occurrences, the total,
+     * minimum and maximum duration between begins and ends, and the count, sum,
+     * minimum and maximum of the EventInfo arb_value. ChiLog::ProcessEvent
+     * therefore costs O(1) and the memory per tag is bounded, no matter how
+     * many events are logged during a long run.
+     *
+     * Only the most recent raw events are kept, in a ring buffer, for
+     * ChiLog::PrintEventHistory. Its capacity defaults to
+     * ChiLog::DEFAULT_EVENT_HISTORY_CAPACITY and can be changed per tag with
+     * ChiLog::SetEventHistoryCapacity. A capacity of zero keeps no raw events.
+     *
      * ### Supplying event information
      * In addition to the ChiLog::EventType the user can also supply a reference to
-     * a ChiLog::EventInfo structure. Be cautious with this though because each
-     * event stored a double and a string which can look like a memory leak if
-     * multiple events are pushed up with event information. Developers can supply
+     * a ChiLog::EventInfo structure. Developers can supply
      * either a double or a string or both to an event info constructor to
      * instantiate an instance. The event arb_value is by default 0.0 and the event
      * arb_info is by default an empty string. An example is shown below:
@@ -170,7 +183,8 @@ namespace chi
      * ChiLog::PrintEventHistory along with the event tag. Just note that it will
      * automatically be formatted for each location so no need to use chi::log to
      * print it. Also, each event will be prepended with a program timestamp
-     * in seconds.
+     * in seconds. Only the events still held in the history ring buffer are
+     * printed.
      *
     \code
     std::cout << chi::log.PrintEventHistory(tag);
@@ -250,8 +264,13 @@ namespace chi
       TOTAL_DURATION = 1,        ///< Integrates times between begins and ends
       AVERAGE_DURATION = 2,      ///< Computes average time between begins and ends
       MAX_VALUE = 3,             ///< Computes the maximum of the EventInfo arb_value
-      AVERAGE_VALUE = 4          ///< Computes the average of the EventInfo arb_value
+      AVERAGE_VALUE = 4,         ///< Computes the average of the EventInfo arb_value
+      MIN_DURATION = 5,          ///< Shortest time between a begin and an end
+      MAX_DURATION = 6,          ///< Longest time between a begin and an end
+      MIN_VALUE = 7              ///< Computes the minimum of the EventInfo arb_value
     };
+    /**Default number of raw events kept per tag for PrintEventHistory.*/
+    static constexpr size_t DEFAULT_EVENT_HISTORY_CAPACITY = 1000;
     struct EventInfo;
     struct Event;
 
@@ -265,6 +284,7 @@ namespace chi
                     const std::shared_ptr<EventInfo>& ev_info);
     void   LogEvent(size_t ev_tag,
                     EventType ev_type);
+    void   SetEventHistoryCapacity(size_t ev_tag, size_t capacity);
     std::string PrintEventHistory(size_t ev_tag);
     double ProcessEvent(size_t ev_tag, EventOperation ev_operation);
   };
@@ -311,15 +331,35 @@ struct chi::ChiLog::Event
 };
 
 //###################################################################
-/**Repeating event object.*/
+/**Repeating event object. Events are aggregated as they are added and only
+ * the most recent `history_capacity` raw events are retained.*/
 class chi::ChiLog::RepeatingEvent
 {
 public:
   const std::string  name;
-  std::vector<Event> events;
+
+  size_t num_occurrences = 0; ///< Creations, single occurrences and begins
+
+  double last_begin_time = 0.0;
+  size_t num_durations = 0;
+  double total_duration = 0.0;
+  double min_duration = std::numeric_limits<double>::max();
+  double max_duration = 0.0;
+
+  size_t num_values = 0;
+  double total_value = 0.0;
+  double min_value = std::numeric_limits<double>::max();
+  double max_value = 0.0;
+
+  size_t history_capacity = DEFAULT_EVENT_HISTORY_CAPACITY;
+  std::deque<Event> history;
 public:
   explicit RepeatingEvent(std::string& in_event_name) : name(in_event_name)
   {  }
+
+  void AddEvent(double ev_time,
+                EventType ev_type,
+                std::shared_ptr<EventInfo> ev_info);
 };
 
 #endif//CHI_LOG_H
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "linear_solver.h"
 
+#include "utils/chi_memory_registry.h"
+
 #include <petscksp.h>
 
 namespace chi_math
@@ -11,6 +13,7 @@ LinearSolver<Mat, Vec, KSP>::~LinearSolver()
   VecDestroy(&x_);
   VecDestroy(&b_);
   KSPDestroy(&solver_);
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
 }
 
 template<>
@@ -67,7 +70,8 @@ void LinearSolver<Mat, Vec, KSP>::Setup()
 
   this->ApplyToleranceOptions();
 
-  if (iterative_method_ == "gmres")
+  if (iterative_method_ == "gmres" or iterative_method_ == "lgmres" or
+      iterative_method_ == "dgmres")
   {
     KSPGMRESSetRestart(solver_, tolerance_options_.gmres_restart_interval);
     KSPGMRESSetBreakdownTolerance(solver_,
@@ -89,6 +93,18 @@ void LinearSolver<Mat, Vec, KSP>::Setup()
 
   this->PostSetupCallback();
   system_set_ = true;
+
+  //============================================= Register memory
+  // The solution and rhs vectors plus, for GMRES variants, an estimate of
+  // the Krylov basis that KSP allocates during the first solve.
+  size_t num_vectors = 2;
+  if (iterative_method_ == "gmres" or iterative_method_ == "lgmres" or
+      iterative_method_ == "dgmres")
+    num_vectors += tolerance_options_.gmres_restart_interval + 2;
+
+  chi::MemoryRegistry::GetInstance().Set(
+    chi::MemoryRegistry::PETSC_VECTORS, this,
+    num_vectors * static_cast<size_t>(num_local_dofs_) * sizeof(PetscScalar));
 }
 
 
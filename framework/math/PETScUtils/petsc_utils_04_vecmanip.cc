@@ -1,6 +1,7 @@
 #include "petsc_utils.h"
 
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 //###################################################################
 /**Copies a PETSc vector to a STL vector. Only the local portion is
@@ -99,6 +100,8 @@ void chi_math::PETScUtils::CopyGlobalVecToSTLvector(
  * vector.*/
 void chi_math::PETScUtils::CommunicateGhostEntries(Vec x)
 {
+  chi::PerfRegion perf_region("Comm::GhostEntries");
+
   VecGhostUpdateBegin(x,INSERT_VALUES,SCATTER_FORWARD);
   VecGhostUpdateEnd  (x,INSERT_VALUES,SCATTER_FORWARD);
 }
@@ -12,6 +12,15 @@ std::vector<chi_mesh::Vector3> chi_math::CellMappingFE_PWL::GetNodeLocations() c
   return node_locations_;
 }
 
+/**Returns the approximate number of bytes held by the mapping, including
+ * the object itself.*/
+size_t chi_math::CellMappingFE_PWL::MemoryUsage() const
+{
+  return CellMapping::MemoryUsage() +
+         sizeof(CellMappingFE_PWL) - sizeof(CellMapping) +
+         node_locations_.capacity() * sizeof(chi_mesh::Vector3);
+}
+
 /** This section just determines a mapping of face dofs
 to cell dofs. This is pretty simple since we can
 just loop over each face dof then subsequently
@@ -36,6 +36,8 @@ namespace chi_math
     //02 ShapeFuncs
     std::vector<chi_mesh::Vector3> GetNodeLocations() const override;
 
+    size_t MemoryUsage() const override;
+
   protected:
     /** Spatial weight function. See also ComputeWeightedUnitIntegrals. */
     virtual double SpatialWeightFunction(const chi_mesh::Vector3& pt) const
@@ -98,6 +98,8 @@ namespace chi_math
     void GradShapeValues(
       const chi_mesh::Vector3& xyz,
       std::vector<chi_mesh::Vector3>& gradshape_values) const override;
+
+    size_t MemoryUsage() const override;
   };
 }
 
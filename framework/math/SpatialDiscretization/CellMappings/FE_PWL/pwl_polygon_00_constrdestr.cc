@@ -114,4 +114,19 @@ chi_math::PolygonMappingFE_PWL::
 //      }//for v
 //    }//for fv
 //  }//for e
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Returns the approximate number of bytes held by the mapping, including
+ * the object itself.*/
+size_t chi_math::PolygonMappingFE_PWL::MemoryUsage() const
+{
+  size_t num_bytes = CellMappingFE_PWL::MemoryUsage() +
+    sizeof(PolygonMappingFE_PWL) - sizeof(CellMappingFE_PWL) +
+    sides_.capacity() * sizeof(FEside_data2d) +
+    node_to_side_map_.capacity() * sizeof(std::vector<int>);
+  for (const auto& side_map : node_to_side_map_)
+    num_bytes += side_map.capacity() * sizeof(int);
+
+  return num_bytes;
+}
@@ -153,6 +153,7 @@ namespace chi_math
       const chi_mesh::Vector3& xyz,
       std::vector<chi_mesh::Vector3>& gradshape_values) const override;
 
+    size_t MemoryUsage() const override;
   };
 }
 
@@ -177,4 +177,32 @@ chi_math::PolyhedronMappingFE_PWL::
     }//for f
     node_side_maps_.push_back(newNodeMap);
   }//for i
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Returns the approximate number of bytes held by the mapping, including
+ * the object itself.*/
+size_t chi_math::PolyhedronMappingFE_PWL::MemoryUsage() const
+{
+  size_t num_bytes = CellMappingFE_PWL::MemoryUsage() +
+    sizeof(PolyhedronMappingFE_PWL) - sizeof(CellMappingFE_PWL) +
+    face_betaf_.capacity() * sizeof(double) +
+    face_data_.capacity() * sizeof(FEface_data) +
+    node_side_maps_.capacity() * sizeof(FEnodeMap);
+
+  for (const auto& face_data : face_data_)
+  {
+    num_bytes += face_data.sides.capacity() * sizeof(FEside_data3d);
+    for (const auto& side : face_data.sides)
+      num_bytes += side.v_index.capacity() * sizeof(uint64_t);
+  }
+
+  for (const auto& node_map : node_side_maps_)
+  {
+    num_bytes += node_map.face_map.capacity() * sizeof(FEnodeFaceMap);
+    for (const auto& face_map : node_map.face_map)
+      num_bytes += face_map.side_map.capacity() * sizeof(FEnodeSideMap);
+  }
+
+  return num_bytes;
+}
@@ -255,4 +255,18 @@ chi_math::CellMapping::MakeFaceQuadraturePointData(size_t face_index) const
   chi_math::finite_element::FaceQuadraturePointData qp_data;
   InitializeFaceQuadraturePointData(face_index, qp_data);
   return qp_data;
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Returns the approximate number of bytes held by the mapping, including
+ * the object itself.*/
+size_t chi_math::CellMapping::MemoryUsage() const
+{
+  size_t num_bytes = sizeof(CellMapping) +
+                     areas_.capacity() * sizeof(double) +
+                     face_node_mappings_.capacity() * sizeof(std::vector<int>);
+  for (const auto& face_node_mapping : face_node_mappings_)
+    num_bytes += face_node_mapping.capacity() * sizeof(int);
+
+  return num_bytes;
+}
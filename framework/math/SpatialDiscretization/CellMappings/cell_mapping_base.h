@@ -118,6 +118,9 @@ public:
   finite_element::FaceQuadraturePointData
   MakeFaceQuadraturePointData(size_t face_index) const;
 
+  //04 Memory
+  virtual size_t MemoryUsage() const;
+
 public:
   virtual ~CellMapping() = default;
 };
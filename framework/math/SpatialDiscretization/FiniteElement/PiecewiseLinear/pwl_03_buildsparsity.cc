@@ -39,7 +39,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
     {
       if (face.has_neighbor_ and face.IsNeighborLocal(ref_grid_))
       {
-        const auto& adj_cell = ref_grid_.cells[face.neighbor_id_];
+        const auto& adj_cell = ref_grid_.cells.GetNeighbor(face);
         const auto& adj_cell_mapping = GetCellMapping(adj_cell);
 
         for (int i=0; i<num_nodes; ++i)
@@ -64,7 +64,7 @@ BuildSparsityPattern(std::vector<int64_t> &nodal_nnz_in_diag,
     {
       if (face.has_neighbor_ and (not face.IsNeighborLocal(ref_grid_)))
       {
-        const auto& adj_cell = ref_grid_.cells[face.neighbor_id_];
+        const auto& adj_cell = ref_grid_.cells.GetNeighbor(face);
         const auto& adj_cell_mapping = GetCellMapping(adj_cell);
 
         for (int i=0; i < cell_mapping.NumNodes(); ++i)
@@ -57,6 +57,7 @@ public:
   /**Returns the reference grid on which this discretization is based.*/
   const chi_mesh::MeshContinuum& Grid() const;
   CoordinateSystemType GetCoordinateSystemType() const;
+  size_t CellMappingsMemoryUsage() const;
 
   // 02 OrderNodes
 
@@ -22,6 +22,20 @@ const chi_math::CellMapping& chi_math::SpatialDiscretization::GetCellMapping(
   }
 }
 
+/**Returns the approximate number of bytes held by the cell mappings of
+ * the local and ghost cells.*/
+size_t chi_math::SpatialDiscretization::CellMappingsMemoryUsage() const
+{
+  size_t num_bytes =
+    cell_mappings_.capacity() * sizeof(std::unique_ptr<CellMapping>);
+  for (const auto& cell_mapping : cell_mappings_)
+    num_bytes += cell_mapping->MemoryUsage();
+  for (const auto& [ghost_id, cell_mapping] : nb_cell_mappings_)
+    num_bytes += cell_mapping->MemoryUsage();
+
+  return num_bytes;
+}
+
 chi_math::SpatialDiscretizationType
 chi_math::SpatialDiscretization::Type() const
 {
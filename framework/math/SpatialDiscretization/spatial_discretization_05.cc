@@ -65,7 +65,7 @@ chi_math::SpatialDiscretization::MakeInternalFaceNodeMappings(
       FaceAdjMapping face_adj_mapping(num_face_nodes, -1);
       if (face.has_neighbor_)
       {
-        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        const auto& adj_cell = grid.cells.GetNeighbor(face);
         const auto& adj_cell_mapping = this->GetCellMapping(adj_cell);
         const auto& adj_node_locations = adj_cell_mapping.GetNodeLocations();
         const size_t adj_num_nodes = adj_cell_mapping.NumNodes();
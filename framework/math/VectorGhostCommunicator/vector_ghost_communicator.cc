@@ -4,6 +4,7 @@
 #include <string>
 
 #include "mpi/chi_mpi_utils_map_all2all.h"
+#include "utils/chi_perf_region.h"
 
 chi_math::VectorGhostCommunicator::
   VectorGhostCommunicator(uint64_t local_size,
@@ -164,6 +165,8 @@ int chi_math::VectorGhostCommunicator::FindOwnerPID(uint64_t global_id) const
 void chi_math::VectorGhostCommunicator::
   CommunicateGhostEntries(std::vector<double> &local_vector) const
 {
+  chi::PerfRegion perf_region("Comm::GhostEntries");
+
   if (local_vector.size() != (local_size_ + ghost_indices_.size()))
     throw std::logic_error(
       "chi_math::VectorWithGhosts::CommunicateGhostEntries: Vector size "
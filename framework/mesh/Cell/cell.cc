@@ -88,7 +88,7 @@ bool chi_mesh::CellFace::
   if (not has_neighbor_) return false;
   if (Chi::mpi.process_count == 1) return true;
 
-  auto& adj_cell = grid.cells[neighbor_id_];
+  auto& adj_cell = grid.cells.GetNeighbor(*this);
 
   return (adj_cell.partition_id_ == static_cast<uint64_t>(Chi::mpi.location_id));
 }
@@ -101,7 +101,7 @@ int chi_mesh::CellFace::
   if (not has_neighbor_) return -1;
   if (Chi::mpi.process_count == 1) return 0;
 
-  auto& adj_cell = grid.cells[neighbor_id_];
+  auto& adj_cell = grid.cells.GetNeighbor(*this);
 
   return adj_cell.partition_id_;
 }
@@ -112,9 +112,7 @@ int chi_mesh::CellFace::
   GetNeighborLocalID(const chi_mesh::MeshContinuum& grid) const
 {
   if (not has_neighbor_) return -1;
-  if (Chi::mpi.process_count == 1) return neighbor_id_; //cause global_ids=local_ids
-
-  auto& adj_cell = grid.cells[neighbor_id_];
+  auto& adj_cell = grid.cells.GetNeighbor(*this);
 
   if (adj_cell.partition_id_ != Chi::mpi.location_id)
     throw std::logic_error("Cell local ID requested from a non-local cell.");
@@ -139,7 +137,7 @@ int chi_mesh::CellFace::
     throw std::logic_error(outstr.str());
   }
 
-  const auto& adj_cell = grid.cells[cur_face.neighbor_id_];
+  const auto& adj_cell = grid.cells.GetNeighbor(cur_face);
 
   int associated_face = -1;
   std::set<uint64_t> cfvids(cur_face.vertex_ids_.begin(),
@@ -4,6 +4,7 @@
 #include"../chi_mesh.h"
 #include "data_types/chi_data_types.h"
 #include <tuple>
+#include <limits>
 
 //Appending cell types to namespace
 namespace chi_mesh
@@ -41,6 +42,9 @@ public:
   bool has_neighbor_=false;          ///< Flag indicating whether face has a neighbor
   uint64_t neighbor_id_=0;           ///< If face has neighbor, contains the global_id.
                                     ///< Otherwise contains boundary_id.
+  uint64_t neighbor_index_=           ///< Storage index of the neighbor if it
+    std::numeric_limits<uint64_t>::max();///< is stored locally (see
+                                    ///< GlobalCellHandler).
 
 public:
   bool IsNeighborLocal(const chi_mesh::MeshContinuum& grid) const;
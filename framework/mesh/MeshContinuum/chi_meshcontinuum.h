@@ -26,6 +26,7 @@ namespace chi
 namespace chi_mesh
 {
   class GridFaceHistogram;
+  class MeshTopology;
 }
 
 //######################################################### Class Definition
@@ -39,8 +40,8 @@ private:
   std::vector<std::unique_ptr<chi_mesh::Cell>> local_cells_;  ///< Actual local cells
   std::vector<std::unique_ptr<chi_mesh::Cell>> ghost_cells_; ///< Locally stored ghosts
 
-  std::map<uint64_t,uint64_t> global_cell_id_to_local_id_map_;
-  std::map<uint64_t,uint64_t> global_cell_id_to_nonlocal_id_map_;
+  chi_data_types::FlatIndexMap global_cell_id_to_local_id_map_;
+  chi_data_types::FlatIndexMap global_cell_id_to_nonlocal_id_map_;
 
   uint64_t global_vertex_count_=0;
 
@@ -60,6 +61,8 @@ private:
 
   std::map<uint64_t, std::string> boundary_id_map_;
 
+  mutable std::shared_ptr<MeshTopology> topology_; ///< Built on demand
+
 public:
   MeshContinuum() :
     local_cells(local_cells_),
@@ -70,6 +73,8 @@ public:
   {
   }
 
+  ~MeshContinuum();
+
   void SetGlobalVertexCount(const uint64_t count) { global_vertex_count_ = count;}
   uint64_t GetGlobalVertexCount() const {return global_vertex_count_;}
 
@@ -94,6 +99,7 @@ public:
     global_cell_id_to_local_id_map_.clear();
     global_cell_id_to_nonlocal_id_map_.clear();
     vertices.Clear();
+    topology_ = nullptr;
   }
 
   void ExportCellsToObj(const char* fileName,
@@ -103,12 +109,37 @@ public:
   void ExportCellsToExodus(const std::string& file_base_name,
                            bool suppress_node_sets = false,
                            bool suppress_side_sets = false) const;
+  void ExportCellsToBinary(const std::string& file_base_name) const;
 
   std::shared_ptr<GridFaceHistogram>
   MakeGridFaceHistogram(double master_tolerance=100.0,
                         double slave_tolerance=1.1) const;
 
   bool IsCellLocal(uint64_t cell_global_index) const;
+  size_t CellsMemoryUsage() const;
+  void RegisterMemoryUsage() const;
+
+  void BuildLocalIndexing();
+  const MeshTopology& GetTopology() const;
+  void InvalidateTopology() const;
+
+  /**Local sums describing how close, in local-id, face-neighboring local
+   * cells are stored.*/
+  struct LocalityMetrics
+  {
+    uint64_t num_neighbor_pairs = 0;  ///< Local-local face pairs
+    uint64_t sum_id_distance = 0;     ///< Sum of |local-id differences|
+    uint64_t bandwidth = 0;           ///< Max |local-id difference|
+    uint64_t num_within_window = 0;   ///< Pairs closer than WINDOW ids
+
+    static constexpr uint64_t WINDOW = 64;
+  };
+  LocalityMetrics ComputeLocalityMetrics() const;
+  std::vector<uint64_t> MakeRCMLocalCellOrdering() const;
+  std::vector<uint64_t> MakeHilbertLocalCellOrdering() const;
+  void RenumberLocalCells(const std::vector<uint64_t>& new_to_old);
+  std::shared_ptr<MeshContinuum>
+  MakeRepartitioned(const std::vector<int64_t>& new_local_cell_pids) const;
   static int GetCellDimension(const chi_mesh::Cell& cell);
 
   void FindAssociatedVertices(const chi_mesh::CellFace& cur_face,
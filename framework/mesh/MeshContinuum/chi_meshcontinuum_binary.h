@@ -0,0 +1,85 @@
+#ifndef CHI_MESHCONTINUUM_BINARY_H_
+#define CHI_MESHCONTINUUM_BINARY_H_
+
+#include <cstdint>
+#include <string>
+
+namespace chi_mesh
+{
+
+//##################################################
+/**Header of the native binary mesh format (`.cmsh`). One file is
+ * written per location and contains the location's local and ghost
+ * cells, already connected and partitioned, and all the vertices they
+ * reference.
+ *
+ * The header is followed by arrays stored in host byte order, in the
+ * order listed below. Nc is the number of cells (local cells first, in
+ * local-id order, then the ghosts), Nf the number of faces, Nv the
+ * number of vertices and Nb the number of boundary names. All 8-byte
+ * arrays come first so that every array is naturally aligned when the
+ * file is memory mapped:
+ * - uint64 cell_global_ids[Nc], cell_partition_ids[Nc]
+ * - int32  cell_info[4*Nc] (type, sub-type, material-id, unused)
+ * - double cell_centroids[3*Nc]
+ * - uint64 cell_vertex_offsets[Nc+1], cell_vertex_ids[...]
+ * - uint64 cell_face_offsets[Nc+1]
+ * - uint64 face_vertex_offsets[Nf+1], face_vertex_ids[...]
+ * - double face_normals[3*Nf], face_centroids[3*Nf]
+ * - uint64 face_neighbor_ids[Nf]
+ * - uint64 vertex_global_ids[Nv]
+ * - double vertex_coordinates[3*Nv]
+ * - uint64 boundary_ids[Nb], boundary_name_offsets[Nb+1]
+ * - uint8  face_has_neighbor[Nf]
+ * - char   boundary_names[...]*/
+struct BinaryMeshHeader
+{
+  static constexpr char     MAGIC[8] = {'C','H','I','M','E','S','H','\0'};
+  static constexpr uint64_t VERSION = 1;
+  /**Written as-is to detect files written with another byte order.*/
+  static constexpr uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+
+  char     magic[8] = {};
+  uint64_t version = 0;
+  uint64_t byte_order_mark = 0;
+  uint64_t location_id = 0;
+  uint64_t num_locations = 0;
+
+  uint64_t attributes = 0;
+  uint64_t ortho_Nx = 0;
+  uint64_t ortho_Ny = 0;
+  uint64_t ortho_Nz = 0;
+  uint64_t global_vertex_count = 0;
+
+  uint64_t num_cells = 0;
+  uint64_t num_local_cells = 0;
+  uint64_t num_cell_vertex_ids = 0;
+  uint64_t num_faces = 0;
+  uint64_t num_face_vertex_ids = 0;
+  uint64_t num_vertices = 0;
+  uint64_t num_boundaries = 0;
+  uint64_t boundary_names_size = 0;
+
+  /**Total file size in bytes implied by the counts.*/
+  uint64_t FileSize() const
+  {
+    const uint64_t Nc = num_cells, Nf = num_faces, Nv = num_vertices;
+    const uint64_t num_8byte_words =
+      2 * Nc + 2 * Nc + 3 * Nc + (Nc + 1) + num_cell_vertex_ids + (Nc + 1) +
+      (Nf + 1) + num_face_vertex_ids + 3 * Nf + 3 * Nf + Nf +
+      Nv + 3 * Nv + num_boundaries + (num_boundaries + 1);
+    return sizeof(BinaryMeshHeader) + 8 * num_8byte_words +
+           Nf + boundary_names_size;
+  }
+};
+
+/**Returns the name of the binary mesh file of a location.*/
+inline std::string MakeBinaryMeshFileName(const std::string& file_base_name,
+                                          int location_id)
+{
+  return file_base_name + "_" + std::to_string(location_id) + ".cmsh";
+}
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_BINARY_H_
@@ -7,7 +7,10 @@
 
 //###################################################################
 /**Gets the communicator-set for interprocess communication,
- * associated with this mesh. If not created yet, it will create it.*/
+ * associated with this mesh. Each location only contributes its own
+ * neighboring locations to a distributed graph communicator, therefore
+ * the cost of creating it does not grow with the number of locations.
+ * Collective over all locations.*/
 std::shared_ptr<chi::ChiMPICommunicatorSet>
   chi_mesh::MeshContinuum::MakeMPILocalCommunicatorSet() const
 {
@@ -17,7 +20,6 @@ std::shared_ptr<chi::ChiMPICommunicatorSet>
 
   //================================================== Loop over local cells
   //Populate local_graph_edges
-  local_graph_edges.insert(Chi::mpi.location_id); //add current location
   for (auto& cell : local_cells)
   {
     for (auto& face : cell.faces_)
@@ -30,91 +32,33 @@ std::shared_ptr<chi::ChiMPICommunicatorSet>
 
   //============================================= Convert set to vector
   //This is just done for convenience because MPI
-  //needs a contiguous array
-  std::vector<int> local_connections(local_graph_edges.begin(),
-                                     local_graph_edges.end());
+  //needs a contiguous array. Face adjacency is symmetric, hence
+  //the neighbors are both sources and destinations.
+  std::vector<int> neighbor_locations(local_graph_edges.begin(),
+                                      local_graph_edges.end());
+  const int num_neighbors = static_cast<int>(neighbor_locations.size());
+
+  //============================================= Create graph communicator
+  MPI_Comm communicator;
+  int err = MPI_Dist_graph_create_adjacent(
+    Chi::mpi.comm,
+    num_neighbors,             //indegree
+    neighbor_locations.data(), //sources
+    MPI_UNWEIGHTED,            //sourceweights
+    num_neighbors,             //outdegree
+    neighbor_locations.data(), //destinations
+    MPI_UNWEIGHTED,            //destweights
+    MPI_INFO_NULL,             //info
+    0,                         //reorder, keeps ranks equal to location ids
+    &communicator);
+
+  if (err != MPI_SUCCESS)
+    throw std::runtime_error("MakeMPILocalCommunicatorSet: "
+                             "Communicator creation failed.");
 
-  //============================================= Broadcast local connection size
   Chi::log.Log0Verbose1()
-    << "Communicating local connections.";
-
-  std::vector<std::vector<int>> global_graph(Chi::mpi.process_count,
-                                             std::vector<int>());
-  for (int locI=0;locI< Chi::mpi.process_count; locI++)
-  {
-    int locI_num_connections = static_cast<int>(local_connections.size());
-
-    //If chi::mpi.location_id == locI then this call will
-    //act like a send instead of receive. Otherwise
-    //It receives the count.
-    MPI_Bcast(&locI_num_connections,1,MPI_INT,locI,Chi::mpi.comm);
-
-    if (Chi::mpi.location_id != locI)
-    {global_graph[locI].resize(locI_num_connections,-1);}
-    else
-    {
-      std::copy(local_connections.begin(),
-                local_connections.end(),
-                std::back_inserter(global_graph[locI]));
-    }
-  }
-
-
-
-  //============================================= Broadcast local connections
-  for (int locI=0;locI< Chi::mpi.process_count; locI++)
-  {
-    //If chi::mpi.location_id == locI then this call will
-    //act like a send instead of receive. Otherwise
-    //It receives the count.
-    MPI_Bcast(global_graph[locI].data(),
-              static_cast<int>(global_graph[locI].size()),
-              MPI_INT,locI,Chi::mpi.comm);
-  }
-
-  Chi::log.Log0Verbose1()
-    << "Done communicating local connections.";
-
-
-  //============================================= Build groups
-  MPI_Group world_group;
-  MPI_Comm_group(Chi::mpi.comm,&world_group);
-
-  std::vector<MPI_Group> location_groups;
-  location_groups.resize(Chi::mpi.process_count, MPI_Group());
-
-  for (int locI=0;locI< Chi::mpi.process_count; locI++)
-  {
-    MPI_Group_incl(world_group,
-                   static_cast<int>(global_graph[locI].size()),
-                   global_graph[locI].data(),
-                   &location_groups[locI]);
-  }
-
-  //============================================= Build communicators
-  std::vector<MPI_Comm>  communicators;
-  Chi::log.Log0Verbose1()
-    << "Building communicators.";
-  communicators.resize(Chi::mpi.process_count, MPI_Comm());
-
-  for (int locI=0;locI< Chi::mpi.process_count; locI++)
-  {
-    int err = MPI_Comm_create_group(Chi::mpi.comm,
-                                    location_groups[locI],
-                                    0, //tag
-                                    &communicators[locI]);
-
-    if (err != MPI_SUCCESS)
-    {
-      Chi::log.Log0Verbose1()
-        << "Communicator creation failed.";
-    }
-  }
-
-  Chi::log.Log0Verbose1()
-    << "Done building communicators.";
+    << "Done building communicator.";
 
   return std::make_shared<chi::ChiMPICommunicatorSet>(
-    communicators, location_groups, world_group);
+    communicator, std::move(neighbor_locations));
 }
-
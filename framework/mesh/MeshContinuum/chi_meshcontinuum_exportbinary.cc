@@ -0,0 +1,174 @@
+#include "chi_meshcontinuum.h"
+#include "chi_meshcontinuum_binary.h"
+
+#include "mesh/Cell/cell.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <fstream>
+#include <algorithm>
+
+namespace
+{
+/**Writes the contents of a vector as raw bytes.*/
+template<typename T>
+void WriteArray(std::ofstream& file, const std::vector<T>& data)
+{
+  file.write(reinterpret_cast<const char*>(data.data()),
+             static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+}//namespace
+
+//###################################################################
+/**Exports the local and ghost cells of every location to the native
+ * binary mesh format (see BinaryMeshHeader). Each location writes the
+ * file `<file_base_name>_<location_id>.cmsh`. The mesh can be loaded
+ * again, on the same number of locations, with VolumeMesherBinary,
+ * skipping mesh reading, connectivity and partitioning.*/
+void chi_mesh::MeshContinuum::
+  ExportCellsToBinary(const std::string& file_base_name) const
+{
+  Chi::log.Log() << "Exporting mesh to binary files with base "
+                 << file_base_name;
+
+  //======================================== Collect cells in file order
+  std::vector<const chi_mesh::Cell*> cells_to_write;
+  cells_to_write.reserve(local_cells_.size() + ghost_cells_.size());
+  for (const auto& cell : local_cells_) cells_to_write.push_back(cell.get());
+  for (const auto& cell : ghost_cells_) cells_to_write.push_back(cell.get());
+
+  //======================================== Build arrays
+  std::vector<uint64_t> cell_global_ids, cell_partition_ids;
+  std::vector<int32_t>  cell_info;
+  std::vector<double>   cell_centroids;
+  std::vector<uint64_t> cell_vertex_offsets = {0}, cell_vertex_ids;
+  std::vector<uint64_t> cell_face_offsets = {0};
+  std::vector<uint64_t> face_vertex_offsets = {0}, face_vertex_ids;
+  std::vector<double>   face_normals, face_centroids;
+  std::vector<uint64_t> face_neighbor_ids;
+  std::vector<uint8_t>  face_has_neighbor;
+
+  for (const auto* cell : cells_to_write)
+  {
+    cell_global_ids.push_back(cell->global_id_);
+    cell_partition_ids.push_back(cell->partition_id_);
+    cell_info.push_back(static_cast<int32_t>(cell->Type()));
+    cell_info.push_back(static_cast<int32_t>(cell->SubType()));
+    cell_info.push_back(static_cast<int32_t>(cell->material_id_));
+    cell_info.push_back(0);
+    for (int d = 0; d < 3; ++d) cell_centroids.push_back(cell->centroid_[d]);
+
+    cell_vertex_ids.insert(cell_vertex_ids.end(),
+                           cell->vertex_ids_.begin(), cell->vertex_ids_.end());
+    cell_vertex_offsets.push_back(cell_vertex_ids.size());
+
+    for (const auto& face : cell->faces_)
+    {
+      face_vertex_ids.insert(face_vertex_ids.end(),
+                             face.vertex_ids_.begin(), face.vertex_ids_.end());
+      face_vertex_offsets.push_back(face_vertex_ids.size());
+      for (int d = 0; d < 3; ++d) face_normals.push_back(face.normal_[d]);
+      for (int d = 0; d < 3; ++d) face_centroids.push_back(face.centroid_[d]);
+      face_neighbor_ids.push_back(face.neighbor_id_);
+      face_has_neighbor.push_back(face.has_neighbor_ ? 1 : 0);
+    }
+    cell_face_offsets.push_back(face_neighbor_ids.size());
+  }
+
+  std::vector<uint64_t> vertex_global_ids;
+  std::vector<double>   vertex_coordinates;
+  vertex_global_ids.reserve(vertices.NumLocallyStored());
+  vertex_coordinates.reserve(3 * vertices.NumLocallyStored());
+  for (const auto& [vid, vertex] : vertices)
+  {
+    vertex_global_ids.push_back(vid);
+    vertex_coordinates.push_back(vertex.x);
+    vertex_coordinates.push_back(vertex.y);
+    vertex_coordinates.push_back(vertex.z);
+  }
+
+  std::vector<uint64_t> boundary_ids;
+  std::vector<uint64_t> boundary_name_offsets = {0};
+  std::string           boundary_names;
+  for (const auto& [bid, name] : boundary_id_map_)
+  {
+    boundary_ids.push_back(bid);
+    boundary_names += name;
+    boundary_name_offsets.push_back(boundary_names.size());
+  }
+
+  //======================================== Header
+  BinaryMeshHeader header;
+  std::copy(std::begin(BinaryMeshHeader::MAGIC),
+            std::end(BinaryMeshHeader::MAGIC), header.magic);
+  header.version = BinaryMeshHeader::VERSION;
+  header.byte_order_mark = BinaryMeshHeader::BYTE_ORDER_MARK;
+  header.location_id = Chi::mpi.location_id;
+  header.num_locations = Chi::mpi.process_count;
+
+  header.attributes = static_cast<uint64_t>(attributes);
+  header.ortho_Nx = ortho_attributes.Nx;
+  header.ortho_Ny = ortho_attributes.Ny;
+  header.ortho_Nz = ortho_attributes.Nz;
+  header.global_vertex_count = global_vertex_count_;
+
+  header.num_cells = cells_to_write.size();
+  header.num_local_cells = local_cells_.size();
+  header.num_cell_vertex_ids = cell_vertex_ids.size();
+  header.num_faces = face_neighbor_ids.size();
+  header.num_face_vertex_ids = face_vertex_ids.size();
+  header.num_vertices = vertex_global_ids.size();
+  header.num_boundaries = boundary_ids.size();
+  header.boundary_names_size = boundary_names.size();
+
+  //======================================== Write file
+  const std::string file_name =
+    MakeBinaryMeshFileName(file_base_name, Chi::mpi.location_id);
+  std::ofstream file(file_name, std::ios_base::binary | std::ios_base::out);
+  if (file.is_open())
+  {
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    WriteArray(file, cell_global_ids);
+    WriteArray(file, cell_partition_ids);
+    WriteArray(file, cell_info);
+    WriteArray(file, cell_centroids);
+    WriteArray(file, cell_vertex_offsets);
+    WriteArray(file, cell_vertex_ids);
+    WriteArray(file, cell_face_offsets);
+    WriteArray(file, face_vertex_offsets);
+    WriteArray(file, face_vertex_ids);
+    WriteArray(file, face_normals);
+    WriteArray(file, face_centroids);
+    WriteArray(file, face_neighbor_ids);
+    WriteArray(file, vertex_global_ids);
+    WriteArray(file, vertex_coordinates);
+    WriteArray(file, boundary_ids);
+    WriteArray(file, boundary_name_offsets);
+    WriteArray(file, face_has_neighbor);
+    file.write(boundary_names.data(),
+               static_cast<std::streamsize>(boundary_names.size()));
+  }
+
+  //Every location must learn of a failure, otherwise the others
+  //would wait for it indefinitely
+  const bool local_success = file.is_open() and file.good();
+  file.close();
+
+  bool global_success = false;
+  MPI_Allreduce(&local_success,    //sendbuf
+                &global_success,   //recvbuf
+                1, MPI_CXX_BOOL,   //count + datatype
+                MPI_LAND,          //operation
+                Chi::mpi.comm);    //communicator
+
+  if (not local_success)
+    throw std::runtime_error("Failed to write binary mesh file " +
+                             file_name + ".");
+  if (not global_success)
+    throw std::runtime_error("Failed to write the binary mesh file "
+                             "of another location.");
+
+  Chi::log.Log() << "Done exporting mesh to binary.";
+}
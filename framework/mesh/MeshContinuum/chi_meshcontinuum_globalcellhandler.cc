@@ -17,8 +17,8 @@ void chi_mesh::GlobalCellHandler::
 
     const auto& cell = local_cells_ref_.back();
 
-    global_cell_id_to_native_id_map.insert(std::make_pair(
-      cell->global_id_, local_cells_ref_.size() - 1));
+    global_cell_id_to_native_id_map.Insert(cell->global_id_,
+                                           local_cells_ref_.size() - 1);
   }
   else
   {
@@ -26,8 +26,8 @@ void chi_mesh::GlobalCellHandler::
 
     const auto& cell = ghost_cells_ref_.back();
 
-    global_cell_id_to_foreign_id_map.insert(std::make_pair(
-      cell->global_id_, ghost_cells_ref_.size() - 1));
+    global_cell_id_to_foreign_id_map.Insert(cell->global_id_,
+                                            ghost_cells_ref_.size() - 1);
   }
 
 }
@@ -37,16 +37,9 @@ void chi_mesh::GlobalCellHandler::
 chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index)
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *local_cells_ref_[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *ghost_cells_ref_[foreign_location->second];
-  }
+  const uint64_t storage_index = GetStorageIndex(cell_global_index);
+  if (storage_index != INVALID_INDEX)
+    return ByStorageIndex(storage_index);
 
   std::stringstream ostr;
   ostr << "chi_mesh::MeshContinuum::cells. Mapping error."
@@ -61,16 +54,9 @@ chi_mesh::Cell& chi_mesh::GlobalCellHandler::
 const chi_mesh::Cell& chi_mesh::GlobalCellHandler::
   operator[](uint64_t cell_global_index) const
 {
-  auto native_location = global_cell_id_to_native_id_map.find(cell_global_index);
-
-  if (native_location != global_cell_id_to_native_id_map.end())
-    return *local_cells_ref_[native_location->second];
-  else
-  {
-    auto foreign_location = global_cell_id_to_foreign_id_map.find(cell_global_index);
-    if (foreign_location != global_cell_id_to_foreign_id_map.end())
-      return *ghost_cells_ref_[foreign_location->second];
-  }
+  const uint64_t storage_index = GetStorageIndex(cell_global_index);
+  if (storage_index != INVALID_INDEX)
+    return ByStorageIndex(storage_index);
 
   std::stringstream ostr;
   ostr << "chi_mesh::MeshContinuum::cells. Mapping error."
@@ -121,14 +107,56 @@ std::vector<uint64_t> chi_mesh::GlobalCellHandler::
 uint64_t chi_mesh::GlobalCellHandler::
   GetGhostLocalID(uint64_t cell_global_index) const
 {
-  auto foreign_location =
-    global_cell_id_to_foreign_id_map.find(cell_global_index);
+  const uint64_t ghost_id =
+    global_cell_id_to_foreign_id_map.Find(cell_global_index);
 
-  if (foreign_location != global_cell_id_to_foreign_id_map.end())
-    return foreign_location->second;
+  if (ghost_id != INVALID_INDEX)
+    return ghost_id;
 
   std::stringstream ostr;
   ostr << "Grid GetGhostLocalID failed to find cell " << cell_global_index;
 
   throw std::invalid_argument(ostr.str());
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Returns the storage index of a cell given its global cell index, or
+ * INVALID_INDEX when the cell is not stored on this location.*/
+uint64_t chi_mesh::GlobalCellHandler::
+  GetStorageIndex(uint64_t cell_global_index) const
+{
+  const uint64_t local_id =
+    global_cell_id_to_native_id_map.Find(cell_global_index);
+  if (local_id != INVALID_INDEX) return local_id;
+
+  const uint64_t ghost_id =
+    global_cell_id_to_foreign_id_map.Find(cell_global_index);
+  if (ghost_id != INVALID_INDEX) return ghost_id | GHOST_INDEX_FLAG;
+
+  return INVALID_INDEX;
+}
+
+//###################################################################
+/**Returns the neighbor cell of a face using the precomputed storage
+ * index, when available, and the global-id otherwise. The storage index
+ * is verified against the neighbor's global-id so that stale indices,
+ * e.g., after mesh modifications, fall back to the global lookup.*/
+const chi_mesh::Cell& chi_mesh::GlobalCellHandler::
+  GetNeighbor(const chi_mesh::CellFace& face) const
+{
+  const uint64_t index = face.neighbor_index_;
+  if (index != INVALID_INDEX)
+  {
+    const bool in_range = IsStorageIndexLocal(index) ?
+      index < local_cells_ref_.size() :
+      (index & ~GHOST_INDEX_FLAG) < ghost_cells_ref_.size();
+
+    if (in_range)
+    {
+      const auto& cell = ByStorageIndex(index);
+      if (cell.global_id_ == face.neighbor_id_) return cell;
+    }
+  }
+
+  return (*this)[face.neighbor_id_];
+}
@@ -2,30 +2,41 @@
 #define CHI_MESHCONTINUUM_GLOBALCELLHANDLER_H_
 
 #include "mesh/Cell/cell.h"
-
-#include <map>
+#include "data_types/flat_index_map.h"
 
 namespace chi_mesh
 {
 //##################################################
-/**Handles all global index queries.*/
+/**Handles all global index queries.
+ *
+ * Besides global-ids, cells can be addressed with a compact storage
+ * index. For local cells this is the local-id, for ghost cells it is
+ * the ghost's position in ghost storage with the most significant bit
+ * set. Storage indices do not change when cells are added, and are
+ * precomputed for neighbors in CellFace::neighbor_index_ by
+ * MeshContinuum::BuildLocalIndexing.*/
 class GlobalCellHandler
 {
   friend class MeshContinuum;
+public:
+  static constexpr uint64_t GHOST_INDEX_FLAG = uint64_t(1) << 63;
+  static constexpr uint64_t INVALID_INDEX =
+    chi_data_types::FlatIndexMap::INVALID;
+
 private:
   std::vector<std::unique_ptr<chi_mesh::Cell>>& local_cells_ref_;
   std::vector<std::unique_ptr<chi_mesh::Cell>>& ghost_cells_ref_;
 
-  std::map<uint64_t,uint64_t>& global_cell_id_to_native_id_map;
-  std::map<uint64_t,uint64_t>& global_cell_id_to_foreign_id_map;
+  chi_data_types::FlatIndexMap& global_cell_id_to_native_id_map;
+  chi_data_types::FlatIndexMap& global_cell_id_to_foreign_id_map;
 
 
 private:
   explicit GlobalCellHandler(
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_native_cells,
     std::vector<std::unique_ptr<chi_mesh::Cell>>& in_foreign_cells,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_native_id_map,
-    std::map<uint64_t,uint64_t>& in_global_cell_id_to_foreign_id_map) :
+    chi_data_types::FlatIndexMap& in_global_cell_id_to_native_id_map,
+    chi_data_types::FlatIndexMap& in_global_cell_id_to_foreign_id_map) :
     local_cells_ref_(in_native_cells),
     ghost_cells_ref_(in_foreign_cells),
     global_cell_id_to_native_id_map(in_global_cell_id_to_native_id_map),
@@ -43,8 +54,32 @@ public:
   std::vector<uint64_t> GetGhostGlobalIDs() const;
 
   uint64_t GetGhostLocalID(uint64_t cell_global_index) const;
+
+  uint64_t GetStorageIndex(uint64_t cell_global_index) const;
+
+  /**Returns `true` if the storage index refers to a local cell.*/
+  static bool IsStorageIndexLocal(uint64_t storage_index)
+  {return (storage_index & GHOST_INDEX_FLAG) == 0;}
+
+  /**Returns a cell given its storage index. No bounds checking.*/
+  chi_mesh::Cell& ByStorageIndex(uint64_t storage_index)
+  {
+    return IsStorageIndexLocal(storage_index) ?
+           *local_cells_ref_[storage_index] :
+           *ghost_cells_ref_[storage_index & ~GHOST_INDEX_FLAG];
+  }
+
+  /**Returns a cell given its storage index. No bounds checking.*/
+  const chi_mesh::Cell& ByStorageIndex(uint64_t storage_index) const
+  {
+    return IsStorageIndexLocal(storage_index) ?
+           *local_cells_ref_[storage_index] :
+           *ghost_cells_ref_[storage_index & ~GHOST_INDEX_FLAG];
+  }
+
+  const chi_mesh::Cell& GetNeighbor(const chi_mesh::CellFace& face) const;
 };
 
 }//namespace chi_mesh
 
-#endif //CHI_MESHCONTINUUM_GLOBALCELLHANDLER_H_
\ No newline at end of file
+#endif //CHI_MESHCONTINUUM_GLOBALCELLHANDLER_H_
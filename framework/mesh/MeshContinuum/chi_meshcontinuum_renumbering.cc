@@ -0,0 +1,241 @@
+#include "chi_meshcontinuum.h"
+
+#include "mesh/chi_mesh_sfc.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+//###################################################################
+/**Computes locality metrics of the current local cell order over all
+ * pairs of face-neighboring local cells.*/
+chi_mesh::MeshContinuum::LocalityMetrics
+chi_mesh::MeshContinuum::ComputeLocalityMetrics() const
+{
+  LocalityMetrics metrics;
+  for (const auto& cell : local_cells)
+    for (const auto& face : cell.faces_)
+    {
+      if (not face.has_neighbor_) continue;
+      const uint64_t index = cells.GetStorageIndex(face.neighbor_id_);
+      if (index == GlobalCellHandler::INVALID_INDEX or
+          not GlobalCellHandler::IsStorageIndexLocal(index)) continue;
+
+      const uint64_t distance = index > cell.local_id_ ?
+                                index - cell.local_id_ :
+                                cell.local_id_ - index;
+      ++metrics.num_neighbor_pairs;
+      metrics.sum_id_distance += distance;
+      metrics.bandwidth = std::max(metrics.bandwidth, distance);
+      if (distance < LocalityMetrics::WINDOW) ++metrics.num_within_window;
+    }
+
+  return metrics;
+}
+
+//###################################################################
+/**Computes a reverse Cuthill-McKee ordering of the local cells based on
+ * the local face-neighbor graph. Each connected component starts from a
+ * pseudo-peripheral cell. Returns the old local-id of each new
+ * local-id.*/
+std::vector<uint64_t> chi_mesh::MeshContinuum::MakeRCMLocalCellOrdering() const
+{
+  const size_t num_local_cells = local_cells_.size();
+
+  //======================================== Build local adjacency (CSR)
+  std::vector<uint64_t> adj_offsets(num_local_cells + 1, 0);
+  std::vector<uint64_t> adj_ids;
+  for (const auto& cell : local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      if (not face.has_neighbor_) continue;
+      const uint64_t index = cells.GetStorageIndex(face.neighbor_id_);
+      if (index == GlobalCellHandler::INVALID_INDEX or
+          not GlobalCellHandler::IsStorageIndexLocal(index)) continue;
+      adj_ids.push_back(index);
+    }
+    adj_offsets[cell.local_id_ + 1] = adj_ids.size();
+  }
+
+  auto Degree = [&adj_offsets](uint64_t c)
+  {return adj_offsets[c + 1] - adj_offsets[c];};
+
+  // Neighbors are visited in order of increasing degree
+  for (size_t c = 0; c < num_local_cells; ++c)
+    std::sort(adj_ids.begin() + static_cast<int64_t>(adj_offsets[c]),
+              adj_ids.begin() + static_cast<int64_t>(adj_offsets[c + 1]),
+              [&Degree](uint64_t a, uint64_t b)
+              {return Degree(a) < Degree(b);});
+
+  //======================================== Breadth-first search
+  // Appends the unvisited cells reachable from `root` to `order`, level
+  // by level. Returns the index in `order` where the last level starts
+  // and the number of levels.
+  std::vector<char> visited(num_local_cells, 0);
+  auto BFS = [&](uint64_t root, std::vector<uint64_t>& order)
+  {
+    size_t head = order.size();
+    size_t last_level_begin = head;
+    size_t num_levels = 0;
+    order.push_back(root);
+    visited[root] = 1;
+    while (head < order.size())
+    {
+      last_level_begin = head;
+      ++num_levels;
+      const size_t level_end = order.size();
+      for (; head < level_end; ++head)
+      {
+        const uint64_t c = order[head];
+        for (uint64_t k = adj_offsets[c]; k < adj_offsets[c + 1]; ++k)
+          if (not visited[adj_ids[k]])
+          {
+            visited[adj_ids[k]] = 1;
+            order.push_back(adj_ids[k]);
+          }
+      }
+    }
+    return std::make_pair(last_level_begin, num_levels);
+  };
+
+  //======================================== Order each component
+  std::vector<uint64_t> by_degree(num_local_cells);
+  std::iota(by_degree.begin(), by_degree.end(), 0);
+  std::stable_sort(by_degree.begin(), by_degree.end(),
+                   [&Degree](uint64_t a, uint64_t b)
+                   {return Degree(a) < Degree(b);});
+
+  std::vector<uint64_t> order;
+  order.reserve(num_local_cells);
+  std::vector<uint64_t> trial;
+  for (uint64_t start : by_degree)
+  {
+    if (visited[start]) continue;
+
+    //=================================== Find pseudo-peripheral root
+    // Restart from a minimum degree cell of the last BFS level for as
+    // long as the number of levels grows (George and Liu).
+    uint64_t root = start;
+    size_t root_num_levels = 0;
+    for (int iter = 0; iter < 8; ++iter)
+    {
+      trial.clear();
+      const auto [last_level_begin, num_levels] = BFS(root, trial);
+      for (uint64_t c : trial) visited[c] = 0;
+
+      if (iter > 0 and num_levels <= root_num_levels) break;
+      root_num_levels = num_levels;
+
+      const uint64_t candidate = *std::min_element(
+        trial.begin() + static_cast<int64_t>(last_level_begin), trial.end(),
+        [&Degree](uint64_t a, uint64_t b) {return Degree(a) < Degree(b);});
+      if (candidate == root) break;
+      root = candidate;
+    }
+
+    BFS(root, order);
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+//###################################################################
+/**Computes an ordering of the local cells along a Hilbert curve through
+ * the cell centroids. Returns the old local-id of each new local-id.*/
+std::vector<uint64_t> chi_mesh::MeshContinuum::
+  MakeHilbertLocalCellOrdering() const
+{
+  const size_t num_local_cells = local_cells_.size();
+
+  //======================================== Local bounding box
+  chi_mesh::Vector3 xmin(std::numeric_limits<double>::max(),
+                         std::numeric_limits<double>::max(),
+                         std::numeric_limits<double>::max());
+  chi_mesh::Vector3 xmax = -1.0 * xmin;
+  for (const auto& cell : local_cells)
+    for (int d = 0; d < 3; ++d)
+    {
+      xmin(d) = std::min(xmin[d], cell.centroid_[d]);
+      xmax(d) = std::max(xmax[d], cell.centroid_[d]);
+    }
+
+  const auto box = sfc::MakeCurveBox(xmin, xmax);
+
+  //======================================== Keys
+  std::vector<std::pair<uint64_t, uint64_t>> keys_ids;
+  keys_ids.reserve(num_local_cells);
+  for (const auto& cell : local_cells)
+    keys_ids.emplace_back(sfc::ComputePointKey(box, cell.centroid_, true),
+                          cell.local_id_);
+  std::sort(keys_ids.begin(), keys_ids.end());
+
+  std::vector<uint64_t> order;
+  order.reserve(num_local_cells);
+  for (const auto& key_id : keys_ids) order.push_back(key_id.second);
+
+  return order;
+}
+
+//###################################################################
+/**Renumbers the local cells such that the new local-id `i` is the cell
+ * with old local-id `new_to_old[i]`. Ghost cells are reordered in order
+ * of first reference by the renumbered local cells. Since spatial
+ * discretizations number their unknowns by traversing the local cells,
+ * this must be done before any discretization is created on the grid.*/
+void chi_mesh::MeshContinuum::
+  RenumberLocalCells(const std::vector<uint64_t>& new_to_old)
+{
+  const size_t num_local_cells = local_cells_.size();
+  ChiInvalidArgumentIf(new_to_old.size() != num_local_cells,
+                       "Ordering size does not match the number of local "
+                       "cells.");
+
+  //======================================== Reorder local cells
+  std::vector<std::unique_ptr<chi_mesh::Cell>> new_local_cells(num_local_cells);
+  for (size_t i = 0; i < num_local_cells; ++i)
+  {
+    const uint64_t old_id = new_to_old[i];
+    ChiInvalidArgumentIf(old_id >= num_local_cells or
+                         local_cells_[old_id] == nullptr,
+                         "Ordering is not a permutation of the local cells.");
+    new_local_cells[i] = std::move(local_cells_[old_id]);
+    new_local_cells[i]->local_id_ = i;
+  }
+  local_cells_ = std::move(new_local_cells);
+
+  global_cell_id_to_local_id_map_.clear();
+  global_cell_id_to_local_id_map_.Reserve(num_local_cells);
+  for (const auto& cell : local_cells_)
+    global_cell_id_to_local_id_map_.Insert(cell->global_id_, cell->local_id_);
+
+  //======================================== Reorder ghosts
+  const size_t num_ghosts = ghost_cells_.size();
+  std::vector<std::unique_ptr<chi_mesh::Cell>> new_ghost_cells;
+  new_ghost_cells.reserve(num_ghosts);
+  for (const auto& cell : local_cells_)
+    for (const auto& face : cell->faces_)
+    {
+      if (not face.has_neighbor_) continue;
+      const uint64_t ghost_id =
+        global_cell_id_to_nonlocal_id_map_.Find(face.neighbor_id_);
+      if (ghost_id == chi_data_types::FlatIndexMap::INVALID or
+          ghost_cells_[ghost_id] == nullptr) continue;
+      new_ghost_cells.push_back(std::move(ghost_cells_[ghost_id]));
+    }
+  for (auto& ghost : ghost_cells_)
+    if (ghost != nullptr) new_ghost_cells.push_back(std::move(ghost));
+  ghost_cells_ = std::move(new_ghost_cells);
+
+  global_cell_id_to_nonlocal_id_map_.clear();
+  global_cell_id_to_nonlocal_id_map_.Reserve(num_ghosts);
+  for (size_t g = 0; g < num_ghosts; ++g)
+    global_cell_id_to_nonlocal_id_map_.Insert(ghost_cells_[g]->global_id_, g);
+
+  BuildLocalIndexing();
+}
@@ -0,0 +1,179 @@
+#include "chi_meshcontinuum.h"
+
+#include "mesh/Cell/cell.h"
+#include "data_types/byte_array.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_log_exceptions.h"
+#include "chi_mpi.h"
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
+#include "utils/chi_timer.h"
+
+#include <set>
+
+//###################################################################
+/**Creates a new grid in which the local cells of this grid are moved to
+ * the given partitions (one partition-id per local cell). Every location
+ * receives the cells it owns plus, as ghosts, every cell sharing a vertex
+ * with them, together with the required vertices. Since the ghosts of
+ * this grid are exactly the vertex-neighbors of the local cells, each
+ * location can determine all the destinations of its local cells once it
+ * knows the new partition-ids of its ghosts. Collective.
+ *
+ * The new grid has the same attributes and boundary map but its local
+ * indexing still needs to be built, e.g., by setting it on a volume
+ * mesher.*/
+std::shared_ptr<chi_mesh::MeshContinuum> chi_mesh::MeshContinuum::
+  MakeRepartitioned(const std::vector<int64_t>& new_local_cell_pids) const
+{
+  ChiInvalidArgumentIf(new_local_cell_pids.size() != local_cells_.size(),
+                       "Partition-id list does not match the local cells.");
+
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Migrating cells to new partitions.";
+
+  //======================================== Get ghost partition-ids
+  // Queries and replies are in ghost order per location
+  std::map<int, std::vector<uint64_t>> ghost_queries;
+  for (const auto& ghost : ghost_cells_)
+    ghost_queries[static_cast<int>(ghost->partition_id_)].push_back(
+      ghost->global_id_);
+
+  const auto ghost_queries_received =
+    chi_mpi_utils::MapAllToAll(ghost_queries, MPI_UINT64_T);
+
+  std::map<int, std::vector<uint64_t>> ghost_replies;
+  for (const auto& [location, gids] : ghost_queries_received)
+  {
+    auto& reply = ghost_replies[location];
+    reply.reserve(gids.size());
+    for (uint64_t gid : gids)
+    {
+      const uint64_t local_id = global_cell_id_to_local_id_map_.Find(gid);
+      ChiLogicalErrorIf(local_id == chi_data_types::FlatIndexMap::INVALID,
+                        "Ghost query for a cell that is not local.");
+      reply.push_back(static_cast<uint64_t>(new_local_cell_pids[local_id]));
+    }
+  }
+
+  const auto ghost_replies_received =
+    chi_mpi_utils::MapAllToAll(ghost_replies, MPI_UINT64_T);
+
+  std::map<uint64_t, uint64_t> ghost_new_pids;
+  for (const auto& [location, gids] : ghost_queries)
+  {
+    const auto& reply = ghost_replies_received.at(location);
+    for (size_t k = 0; k < gids.size(); ++k)
+      ghost_new_pids[gids[k]] = reply[k];
+  }
+
+  //======================================== Partitions subscribing to
+  //                                         each vertex
+  std::map<uint64_t, std::set<uint64_t>> vertex_pids;
+  for (const auto& cell : local_cells_)
+    for (uint64_t vid : cell->vertex_ids_)
+      vertex_pids[vid].insert(
+        static_cast<uint64_t>(new_local_cell_pids[cell->local_id_]));
+  for (const auto& ghost : ghost_cells_)
+    for (uint64_t vid : ghost->vertex_ids_)
+      vertex_pids[vid].insert(ghost_new_pids.at(ghost->global_id_));
+
+  //======================================== Serialize cells
+  std::map<int, std::vector<std::byte>> cell_data_to_send;
+  std::map<int, std::set<uint64_t>> vids_to_send;
+  for (const auto& cell : local_cells_)
+  {
+    const auto pid =
+      static_cast<uint64_t>(new_local_cell_pids[cell->local_id_]);
+
+    std::set<uint64_t> destinations = {pid};
+    for (uint64_t vid : cell->vertex_ids_)
+    {
+      const auto& pids = vertex_pids.at(vid);
+      destinations.insert(pids.begin(), pids.end());
+    }
+
+    chi_mesh::Cell migrated_cell(*cell);
+    migrated_cell.partition_id_ = pid;
+    const auto raw = migrated_cell.Serialize();
+
+    for (uint64_t dest : destinations)
+    {
+      const auto location = static_cast<int>(dest);
+      auto& data = cell_data_to_send[location];
+      data.insert(data.end(), raw.Data().begin(), raw.Data().end());
+
+      vids_to_send[location].insert(cell->vertex_ids_.begin(),
+                                    cell->vertex_ids_.end());
+    }
+  }//for local cell
+  vertex_pids.clear();
+
+  std::map<int, std::vector<uint64_t>> vertex_ids_to_send;
+  std::map<int, std::vector<double>> vertex_coords_to_send;
+  for (const auto& [location, vids] : vids_to_send)
+  {
+    auto& ids = vertex_ids_to_send[location];
+    auto& coords = vertex_coords_to_send[location];
+    ids.assign(vids.begin(), vids.end());
+    coords.reserve(3 * vids.size());
+    for (uint64_t vid : vids)
+    {
+      const auto& vertex = vertices[vid];
+      coords.insert(coords.end(), {vertex.x, vertex.y, vertex.z});
+    }
+  }
+  vids_to_send.clear();
+
+  //======================================== Exchange
+  const auto cell_data_received =
+    chi_mpi_utils::MapAllToAll(cell_data_to_send, MPI_BYTE);
+  cell_data_to_send.clear();
+  const auto vertex_ids_received =
+    chi_mpi_utils::MapAllToAll(vertex_ids_to_send, MPI_UINT64_T);
+  vertex_ids_to_send.clear();
+  const auto vertex_coords_received =
+    chi_mpi_utils::MapAllToAll(vertex_coords_to_send, MPI_DOUBLE);
+  vertex_coords_to_send.clear();
+
+  //======================================== Create new grid
+  auto new_grid = MeshContinuum::New();
+  new_grid->attributes = attributes;
+  new_grid->ortho_attributes = ortho_attributes;
+  new_grid->boundary_id_map_ = boundary_id_map_;
+  new_grid->global_vertex_count_ = global_vertex_count_;
+
+  for (const auto& [location, ids] : vertex_ids_received)
+  {
+    const auto& coords = vertex_coords_received.at(location);
+    for (size_t v = 0; v < ids.size(); ++v)
+      new_grid->vertices.Insert(ids[v],
+                                chi_mesh::Vector3(coords[3 * v],
+                                                  coords[3 * v + 1],
+                                                  coords[3 * v + 2]));
+  }
+
+  // Cells are added in global-id order
+  std::map<uint64_t, std::unique_ptr<chi_mesh::Cell>> received_cells;
+  for (const auto& [location, data] : cell_data_received)
+  {
+    const chi_data_types::ByteArray raw(data);
+    size_t address = 0;
+    while (address < raw.Size())
+    {
+      auto cell = std::make_unique<chi_mesh::Cell>(
+        chi_mesh::Cell::DeSerialize(raw, address));
+      received_cells[cell->global_id_] = std::move(cell);
+    }
+  }
+
+  for (auto& [global_id, cell] : received_cells)
+    new_grid->cells.push_back(std::move(cell));
+
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Done migrating cells.";
+
+  return new_grid;
+}
@@ -0,0 +1,176 @@
+#include "chi_meshcontinuum_topology.h"
+
+#include "chi_meshcontinuum.h"
+
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Builds the CSR topology from the local and ghost cells of a grid.*/
+chi_mesh::MeshTopology::MeshTopology(const MeshContinuum& grid)
+{
+  //======================================== Collect cells in topology
+  //                                         order
+  std::vector<const chi_mesh::Cell*> cells;
+  cells.reserve(grid.local_cells.size() + grid.cells.GetNumGhosts());
+  for (const auto& cell : grid.local_cells)
+    cells.push_back(&cell);
+  num_local_cells_ = cells.size();
+  for (uint64_t ghost_id : grid.cells.GetGhostGlobalIDs())
+    cells.push_back(&grid.cells[ghost_id]);
+
+  const size_t num_cells = cells.size();
+  size_t num_cell_vertices = 0, num_faces = 0, num_face_vertices = 0;
+  for (const auto* cell : cells)
+  {
+    num_cell_vertices += cell->vertex_ids_.size();
+    num_faces += cell->faces_.size();
+    for (const auto& face : cell->faces_)
+      num_face_vertices += face.vertex_ids_.size();
+  }
+
+  //======================================== Size arrays
+  cell_global_ids_.reserve(num_cells);
+  cell_partition_ids_.reserve(num_cells);
+  cell_material_ids_.reserve(num_cells);
+  cell_types_.reserve(num_cells);
+  cell_sub_types_.reserve(num_cells);
+  cell_centroids_.reserve(num_cells);
+  cell_vertex_offsets_.reserve(num_cells + 1);
+  cell_vertex_ids_.reserve(num_cell_vertices);
+  cell_face_offsets_.reserve(num_cells + 1);
+
+  face_vertex_offsets_.reserve(num_faces + 1);
+  face_vertex_ids_.reserve(num_face_vertices);
+  face_normals_.reserve(num_faces);
+  face_centroids_.reserve(num_faces);
+  face_areas_.reserve(num_faces);
+  face_neighbor_ids_.reserve(num_faces);
+  face_neighbor_indices_.reserve(num_faces);
+  face_associated_faces_.reserve(num_faces);
+  face_has_neighbor_.reserve(num_faces);
+
+  //======================================== Copy cell and face data
+  cell_vertex_offsets_.push_back(0);
+  cell_face_offsets_.push_back(0);
+  face_vertex_offsets_.push_back(0);
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const auto& cell = *cells[c];
+    cell_global_ids_.push_back(cell.global_id_);
+    cell_partition_ids_.push_back(cell.partition_id_);
+    cell_material_ids_.push_back(cell.material_id_);
+    cell_types_.push_back(cell.Type());
+    cell_sub_types_.push_back(cell.SubType());
+    cell_centroids_.push_back(cell.centroid_);
+    cell_vertex_ids_.insert(cell_vertex_ids_.end(),
+                            cell.vertex_ids_.begin(), cell.vertex_ids_.end());
+    cell_vertex_offsets_.push_back(cell_vertex_ids_.size());
+
+    for (const auto& face : cell.faces_)
+    {
+      face_vertex_ids_.insert(face_vertex_ids_.end(),
+                              face.vertex_ids_.begin(),
+                              face.vertex_ids_.end());
+      face_vertex_offsets_.push_back(face_vertex_ids_.size());
+      face_normals_.push_back(face.normal_);
+      face_centroids_.push_back(face.centroid_);
+      face_areas_.push_back(c < num_local_cells_ ?
+                            face.ComputeFaceArea(grid) : 0.0);
+      face_neighbor_ids_.push_back(face.neighbor_id_);
+      face_has_neighbor_.push_back(face.has_neighbor_);
+
+      // Topology indices coincide with storage indices for local cells
+      // and are offset by the number of local cells for ghosts.
+      uint64_t neighbor_index = INVALID_INDEX;
+      if (face.has_neighbor_)
+      {
+        const uint64_t storage_index =
+          grid.cells.GetStorageIndex(face.neighbor_id_);
+        if (storage_index != GlobalCellHandler::INVALID_INDEX)
+          neighbor_index = GlobalCellHandler::IsStorageIndexLocal(storage_index) ?
+            storage_index :
+            num_local_cells_ +
+            (storage_index & ~GlobalCellHandler::GHOST_INDEX_FLAG);
+      }
+      face_neighbor_indices_.push_back(neighbor_index);
+    }//for face
+    cell_face_offsets_.push_back(face_normals_.size());
+  }//for cell
+
+  //======================================== Associated faces
+  // Same criterion as CellFace::GetNeighborAssociatedFace, i.e., equal
+  // sets of vertex-ids, but without throwing on failure.
+  auto SortedFaceVertexIDs = [this](uint64_t face_index)
+  {
+    std::vector<uint64_t> vids(
+      face_vertex_ids_.begin() + face_vertex_offsets_[face_index],
+      face_vertex_ids_.begin() + face_vertex_offsets_[face_index + 1]);
+    std::sort(vids.begin(), vids.end());
+    return vids;
+  };
+
+  face_associated_faces_.assign(num_faces, -1);
+  for (size_t f = 0; f < num_faces; ++f)
+  {
+    const uint64_t adj_c = face_neighbor_indices_[f];
+    if (adj_c == INVALID_INDEX) continue;
+
+    const auto cur_vids = SortedFaceVertexIDs(f);
+    const uint64_t af_begin = cell_face_offsets_[adj_c];
+    const uint64_t af_end = cell_face_offsets_[adj_c + 1];
+    for (uint64_t af = af_begin; af < af_end; ++af)
+      if (SortedFaceVertexIDs(af) == cur_vids)
+      {
+        face_associated_faces_[f] = static_cast<int>(af - af_begin);
+        break;
+      }
+  }
+}
+
+//###################################################################
+/**Returns the number of bytes allocated by the topology arrays.*/
+size_t chi_mesh::MeshTopology::MemoryUsage() const
+{
+  auto Bytes = [](const auto& vec)
+  {return vec.capacity() * sizeof(typename std::decay_t<decltype(vec)>::value_type);};
+
+  return Bytes(cell_global_ids_) + Bytes(cell_partition_ids_) +
+         Bytes(cell_material_ids_) + Bytes(cell_types_) +
+         Bytes(cell_sub_types_) + Bytes(cell_centroids_) +
+         Bytes(cell_vertex_offsets_) + Bytes(cell_vertex_ids_) +
+         Bytes(cell_face_offsets_) +
+         Bytes(face_vertex_offsets_) + Bytes(face_vertex_ids_) +
+         Bytes(face_normals_) + Bytes(face_centroids_) +
+         Bytes(face_areas_) + Bytes(face_neighbor_ids_) +
+         Bytes(face_neighbor_indices_) + Bytes(face_associated_faces_) +
+         face_has_neighbor_.capacity() / 8;
+}
+
+//###################################################################
+/**Estimates the number of bytes used by the chi_mesh::Cell objects of
+ * the local and ghost cells of a grid, including the heap storage of
+ * their vertex-id and face vectors. Allocator overhead is not counted.*/
+size_t chi_mesh::MeshTopology::
+  EstimateCellObjectMemory(const MeshContinuum& grid)
+{
+  auto CellBytes = [](const chi_mesh::Cell& cell)
+  {
+    size_t bytes = sizeof(std::unique_ptr<chi_mesh::Cell>) +
+                   sizeof(chi_mesh::Cell) +
+                   cell.vertex_ids_.capacity() * sizeof(uint64_t) +
+                   cell.faces_.capacity() * sizeof(chi_mesh::CellFace);
+    for (const auto& face : cell.faces_)
+      bytes += face.vertex_ids_.capacity() * sizeof(uint64_t);
+    return bytes;
+  };
+
+  size_t bytes = 0;
+  for (const auto& cell : grid.local_cells)
+    bytes += CellBytes(cell);
+  for (uint64_t ghost_id : grid.cells.GetGhostGlobalIDs())
+    bytes += CellBytes(grid.cells[ghost_id]);
+
+  return bytes;
+}
@@ -0,0 +1,277 @@
+#ifndef CHI_MESHCONTINUUM_TOPOLOGY_H_
+#define CHI_MESHCONTINUUM_TOPOLOGY_H_
+
+#include "mesh/Cell/cell.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace chi_mesh
+{
+class MeshTopology;
+
+//##################################################
+/**Non-owning, read-only view of a contiguous range of elements.*/
+template<typename T>
+class ConstArrayView
+{
+private:
+  const T* begin_;
+  const T* end_;
+
+public:
+  ConstArrayView(const T* begin, const T* end) : begin_(begin), end_(end) {}
+
+  const T* begin() const {return begin_;}
+  const T* end() const {return end_;}
+
+  size_t size() const {return static_cast<size_t>(end_ - begin_);}
+  bool empty() const {return begin_ == end_;}
+
+  const T& operator[](size_t i) const {return begin_[i];}
+};
+
+//##################################################
+/**Lightweight proxy for a face stored in a MeshTopology. Mirrors the
+ * data members of chi_mesh::CellFace.*/
+class FaceView
+{
+private:
+  const MeshTopology* topology_;
+  size_t face_index_;
+
+public:
+  FaceView(const MeshTopology& topology, size_t face_index) :
+    topology_(&topology), face_index_(face_index) {}
+
+  /**Index of the face in the topology's face arrays.*/
+  size_t Index() const {return face_index_;}
+
+  inline ConstArrayView<uint64_t> VertexIDs() const;
+  inline const chi_mesh::Normal& Normal() const;
+  inline const chi_mesh::Vertex& Centroid() const;
+  inline double Area() const;
+  inline bool HasNeighbor() const;
+  inline uint64_t NeighborID() const;
+
+  inline bool IsNeighborStored() const;
+  inline bool IsNeighborLocal() const;
+  inline uint64_t NeighborIndex() const;
+  inline uint64_t NeighborPartitionID() const;
+  inline int NeighborAssociatedFace() const;
+};
+
+//##################################################
+/**Lightweight proxy for a cell stored in a MeshTopology. Mirrors the
+ * data members of chi_mesh::Cell.*/
+class CellView
+{
+private:
+  const MeshTopology* topology_;
+  size_t cell_index_;
+
+public:
+  CellView(const MeshTopology& topology, size_t cell_index) :
+    topology_(&topology), cell_index_(cell_index) {}
+
+  /**Index of the cell in the topology. For local cells this is the
+   * local-id.*/
+  size_t Index() const {return cell_index_;}
+
+  inline bool IsLocal() const;
+  inline uint64_t GlobalID() const;
+  inline uint64_t PartitionID() const;
+  inline int MaterialID() const;
+  inline CellType Type() const;
+  inline CellType SubType() const;
+  inline const chi_mesh::Vertex& Centroid() const;
+  inline ConstArrayView<uint64_t> VertexIDs() const;
+
+  inline size_t NumFaces() const;
+  inline FaceView Face(size_t f) const;
+};
+
+//##################################################
+/**Compressed-sparse-row (structure of arrays) copy of the topology of
+ * the local and ghost cells of a MeshContinuum.
+ *
+ * Each chi_mesh::Cell owns its vertex-id and face vectors, and every
+ * face owns its own vertex-id vector, i.e., a hexahedron requires at
+ * least 8 heap allocations and its data is scattered across the heap.
+ * This class stores the same information in a handful of contiguous
+ * arrays indexed through cell-to-face and face-to-vertex offsets.
+ *
+ * Cells are indexed local cells first (by local-id), followed by the
+ * ghost cells in storage order. CellView and FaceView provide an API
+ * close to that of chi_mesh::Cell and chi_mesh::CellFace so that cell
+ * loops can be migrated gradually. Face areas are only computed for the
+ * faces of local cells.*/
+class MeshTopology
+{
+  friend class CellView;
+  friend class FaceView;
+public:
+  static constexpr uint64_t INVALID_INDEX = std::numeric_limits<uint64_t>::max();
+
+private:
+  size_t num_local_cells_ = 0;
+
+  //Per cell
+  std::vector<uint64_t> cell_global_ids_;
+  std::vector<uint64_t> cell_partition_ids_;
+  std::vector<int> cell_material_ids_;
+  std::vector<CellType> cell_types_;
+  std::vector<CellType> cell_sub_types_;
+  std::vector<chi_mesh::Vertex> cell_centroids_;
+  std::vector<uint64_t> cell_vertex_offsets_; ///< Size num_cells+1
+  std::vector<uint64_t> cell_vertex_ids_;
+  std::vector<uint64_t> cell_face_offsets_;   ///< Size num_cells+1
+
+  //Per face
+  std::vector<uint64_t> face_vertex_offsets_; ///< Size num_faces+1
+  std::vector<uint64_t> face_vertex_ids_;
+  std::vector<chi_mesh::Normal> face_normals_;
+  std::vector<chi_mesh::Vertex> face_centroids_;
+  std::vector<double> face_areas_;
+  std::vector<uint64_t> face_neighbor_ids_;     ///< Global-id or boundary-id
+  std::vector<uint64_t> face_neighbor_indices_; ///< Topology index or INVALID
+  std::vector<int> face_associated_faces_;      ///< Neighbor face or -1
+  std::vector<bool> face_has_neighbor_;
+
+public:
+  explicit MeshTopology(const MeshContinuum& grid);
+
+  size_t NumLocalCells() const {return num_local_cells_;}
+  size_t NumCells() const {return cell_global_ids_.size();}
+  size_t NumFaces() const {return face_neighbor_ids_.size();}
+
+  /**Returns a view of a cell given its topology index.*/
+  CellView Cell(size_t cell_index) const {return {*this, cell_index};}
+
+  //##################################### Local cell range
+  /**Iterates over the local cells as CellViews.*/
+  class LocalCellRange
+  {
+  private:
+    const MeshTopology& topology_;
+  public:
+    class iterator
+    {
+    private:
+      const MeshTopology& topology_;
+      size_t index_;
+    public:
+      iterator(const MeshTopology& topology, size_t index) :
+        topology_(topology), index_(index) {}
+
+      iterator& operator++() {++index_; return *this;}
+      CellView operator*() const {return {topology_, index_};}
+      bool operator==(const iterator& rhs) const {return index_ == rhs.index_;}
+      bool operator!=(const iterator& rhs) const {return index_ != rhs.index_;}
+    };
+
+    explicit LocalCellRange(const MeshTopology& topology) :
+      topology_(topology) {}
+
+    iterator begin() const {return {topology_, 0};}
+    iterator end() const {return {topology_, topology_.num_local_cells_};}
+    size_t size() const {return topology_.num_local_cells_;}
+  };
+
+  LocalCellRange LocalCells() const {return LocalCellRange(*this);}
+
+  size_t MemoryUsage() const;
+  static size_t EstimateCellObjectMemory(const MeshContinuum& grid);
+};
+
+//###################################################################
+// FaceView inline definitions
+ConstArrayView<uint64_t> FaceView::VertexIDs() const
+{
+  const auto& offsets = topology_->face_vertex_offsets_;
+  const uint64_t* data = topology_->face_vertex_ids_.data();
+  return {data + offsets[face_index_], data + offsets[face_index_ + 1]};
+}
+
+const chi_mesh::Normal& FaceView::Normal() const
+{return topology_->face_normals_[face_index_];}
+
+const chi_mesh::Vertex& FaceView::Centroid() const
+{return topology_->face_centroids_[face_index_];}
+
+double FaceView::Area() const
+{return topology_->face_areas_[face_index_];}
+
+bool FaceView::HasNeighbor() const
+{return topology_->face_has_neighbor_[face_index_];}
+
+uint64_t FaceView::NeighborID() const
+{return topology_->face_neighbor_ids_[face_index_];}
+
+/**Returns `true` if the neighbor is stored locally, either as a local
+ * or a ghost cell.*/
+bool FaceView::IsNeighborStored() const
+{return topology_->face_neighbor_indices_[face_index_] !=
+        MeshTopology::INVALID_INDEX;}
+
+/**Returns `true` if the neighbor is a local cell.*/
+bool FaceView::IsNeighborLocal() const
+{return topology_->face_neighbor_indices_[face_index_] <
+        topology_->num_local_cells_;}
+
+/**Topology index of the neighbor. For local neighbors this is the
+ * local-id. INVALID_INDEX if the neighbor is not stored.*/
+uint64_t FaceView::NeighborIndex() const
+{return topology_->face_neighbor_indices_[face_index_];}
+
+/**Partition-id of the neighbor. The neighbor must be stored.*/
+uint64_t FaceView::NeighborPartitionID() const
+{return topology_->cell_partition_ids_[NeighborIndex()];}
+
+/**Index of the neighbor's face sharing this face's vertices, or -1 if
+ * the neighbor is not stored.*/
+int FaceView::NeighborAssociatedFace() const
+{return topology_->face_associated_faces_[face_index_];}
+
+//###################################################################
+// CellView inline definitions
+bool CellView::IsLocal() const
+{return cell_index_ < topology_->num_local_cells_;}
+
+uint64_t CellView::GlobalID() const
+{return topology_->cell_global_ids_[cell_index_];}
+
+uint64_t CellView::PartitionID() const
+{return topology_->cell_partition_ids_[cell_index_];}
+
+int CellView::MaterialID() const
+{return topology_->cell_material_ids_[cell_index_];}
+
+CellType CellView::Type() const
+{return topology_->cell_types_[cell_index_];}
+
+CellType CellView::SubType() const
+{return topology_->cell_sub_types_[cell_index_];}
+
+const chi_mesh::Vertex& CellView::Centroid() const
+{return topology_->cell_centroids_[cell_index_];}
+
+ConstArrayView<uint64_t> CellView::VertexIDs() const
+{
+  const auto& offsets = topology_->cell_vertex_offsets_;
+  const uint64_t* data = topology_->cell_vertex_ids_.data();
+  return {data + offsets[cell_index_], data + offsets[cell_index_ + 1]};
+}
+
+size_t CellView::NumFaces() const
+{
+  const auto& offsets = topology_->cell_face_offsets_;
+  return offsets[cell_index_ + 1] - offsets[cell_index_];
+}
+
+FaceView CellView::Face(size_t f) const
+{return {*topology_, topology_->cell_face_offsets_[cell_index_] + f};}
+
+}//namespace chi_mesh
+
+#endif //CHI_MESHCONTINUUM_TOPOLOGY_H_
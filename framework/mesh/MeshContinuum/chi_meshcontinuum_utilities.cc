@@ -1,10 +1,12 @@
 #include "chi_meshcontinuum.h"
 #include "mesh/Cell/cell.h"
+#include "chi_meshcontinuum_topology.h"
 
 #include "mesh/LogicalVolume/LogicalVolume.h"
 #include "mesh/MeshContinuum/chi_grid_face_histogram.h"
 
 #include "data_types/ndarray.h"
+#include "utils/chi_memory_registry.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
@@ -123,11 +125,110 @@ chi_mesh::MeshContinuum::MakeGridFaceHistogram(double master_tolerance,
  * the native index map.*/
 bool chi_mesh::MeshContinuum::IsCellLocal(uint64_t cell_global_index) const
 {
-  auto native_index = global_cell_id_to_local_id_map_.find(cell_global_index);
+  return global_cell_id_to_local_id_map_.Find(cell_global_index) !=
+         chi_data_types::FlatIndexMap::INVALID;
+}
 
-  if (native_index != global_cell_id_to_local_id_map_.end()) return true;
+// ###################################################################
+/**Removes the grid's entries from the memory registry.*/
+chi_mesh::MeshContinuum::~MeshContinuum()
+{
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
+}
 
-  return false;
+// ###################################################################
+/**Returns the approximate number of bytes held by the local and ghost
+ * cells, including their faces, the global-id maps and, if it has been
+ * built, the CSR topology.*/
+size_t chi_mesh::MeshContinuum::CellsMemoryUsage() const
+{
+  typedef chi::MemoryRegistry MemReg;
+
+  auto CellBytes = [](const chi_mesh::Cell& cell)
+  {
+    size_t num_bytes = sizeof(chi_mesh::Cell) +
+                       MemReg::Bytes(cell.vertex_ids_) +
+                       MemReg::Bytes(cell.faces_);
+    for (const auto& face : cell.faces_)
+      num_bytes += MemReg::Bytes(face.vertex_ids_);
+    return num_bytes;
+  };
+
+  size_t num_bytes = MemReg::Bytes(local_cells_) + MemReg::Bytes(ghost_cells_);
+  for (const auto& cell : local_cells_) num_bytes += CellBytes(*cell);
+  for (const auto& cell : ghost_cells_) num_bytes += CellBytes(*cell);
+
+  if (topology_) num_bytes += topology_->MemoryUsage();
+
+  return num_bytes + global_cell_id_to_local_id_map_.MemoryUsage() +
+                     global_cell_id_to_nonlocal_id_map_.MemoryUsage();
+}
+
+// ###################################################################
+/**Registers the memory held by the cells and vertices with the
+ * chi::MemoryRegistry.*/
+void chi_mesh::MeshContinuum::RegisterMemoryUsage() const
+{
+  auto& registry = chi::MemoryRegistry::GetInstance();
+  registry.Set(chi::MemoryRegistry::MESH_CELLS, this, CellsMemoryUsage());
+  registry.Set(chi::MemoryRegistry::MESH_VERTICES, this,
+               vertices.MemoryUsage());
+}
+
+// ###################################################################
+/**Precomputes, for every face of the local and ghost cells, the storage
+ * index of the neighbor cell (see GlobalCellHandler). Faces without a
+ * neighbor, or whose neighbor is not stored on this location, get an
+ * invalid index. Must be called again after cells are added. Also
+ * invalidates the CSR topology (see GetTopology).*/
+void chi_mesh::MeshContinuum::BuildLocalIndexing()
+{
+  auto SetNeighborIndices = [this](chi_mesh::Cell& cell)
+  {
+    for (auto& face : cell.faces_)
+      face.neighbor_index_ = face.has_neighbor_ ?
+                             cells.GetStorageIndex(face.neighbor_id_) :
+                             GlobalCellHandler::INVALID_INDEX;
+  };
+
+  for (auto& cell : local_cells_) SetNeighborIndices(*cell);
+  for (auto& cell : ghost_cells_) SetNeighborIndices(*cell);
+
+  topology_ = nullptr;
+
+  const size_t map_bytes = global_cell_id_to_local_id_map_.MemoryUsage() +
+                           global_cell_id_to_nonlocal_id_map_.MemoryUsage();
+  Chi::log.Log0Verbose1()
+    << "MeshContinuum: local indexing built. Global-id maps use "
+    << map_bytes / 1024 << " kB on location 0.";
+}
+
+// ###################################################################
+/**Returns the compact, CSR-style copy of the grid's topology. The
+ * topology is built on the first call after the grid's cells have been
+ * set up, or after BuildLocalIndexing was last called.
+ *
+ * The topology is a second copy of the cell connectivity that is not used
+ * by the solvers yet. Callers that only need it temporarily should call
+ * InvalidateTopology when done.*/
+const chi_mesh::MeshTopology& chi_mesh::MeshContinuum::GetTopology() const
+{
+  if (not topology_)
+  {
+    topology_ = std::make_shared<MeshTopology>(*this);
+    RegisterMemoryUsage();
+  }
+  return *topology_;
+}
+
+// ###################################################################
+/**Discards the CSR topology. Must be called when cells are modified
+ * after the grid has been created.*/
+void chi_mesh::MeshContinuum::InvalidateTopology() const
+{
+  if (not topology_) return;
+  topology_ = nullptr;
+  RegisterMemoryUsage();
 }
 
 // ###################################################################
@@ -2,52 +2,98 @@
 #define CHI_MESHCONTINUUM_VERTEXHANDLER_H
 
 #include "mesh/chi_meshvector.h"
+#include "data_types/flat_index_map.h"
 
-#include <map>
+#include <vector>
+#include <stdexcept>
+#include <string>
 
 namespace chi_mesh
 {
 
-/**Manages a vertex map with custom calls.*/
+/**Manages the locally stored vertices with custom calls. Vertices are
+ * stored contiguously, in insertion order, as (global-id, vertex) pairs
+ * and a flat hash map provides the global-id to local index mapping.*/
 class VertexHandler
 {
-  typedef std::map<uint64_t, chi_mesh::Vector3> GlobalIDMap;
+  typedef std::vector<std::pair<uint64_t, chi_mesh::Vector3>> VertexList;
 private:
-  std::map<uint64_t, chi_mesh::Vector3> m_global_id_vertex_map;
+  VertexList m_vertices;
+  chi_data_types::FlatIndexMap m_global_id_to_local_index;
 
 public:
   // Iterators
-  GlobalIDMap::iterator begin() {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::iterator end() {return m_global_id_vertex_map.end();}
+  VertexList::iterator begin() {return m_vertices.begin();}
+  VertexList::iterator end() {return m_vertices.end();}
 
-  GlobalIDMap::const_iterator begin() const {return m_global_id_vertex_map.begin();}
-  GlobalIDMap::const_iterator end() const {return m_global_id_vertex_map.end();}
+  VertexList::const_iterator begin() const {return m_vertices.begin();}
+  VertexList::const_iterator end() const {return m_vertices.end();}
 
   // Accessors
   chi_mesh::Vector3& operator[](const uint64_t global_id)
   {
-    return m_global_id_vertex_map.at(global_id);
+    return m_vertices[GetLocalIndex(global_id)].second;
   }
 
   const chi_mesh::Vector3& operator[](const uint64_t global_id) const
   {
-    return m_global_id_vertex_map.at(global_id);
+    return m_vertices[GetLocalIndex(global_id)].second;
+  }
+
+  /**Returns the contiguous local index of a vertex. Throws
+   * std::out_of_range if the vertex is not stored locally.*/
+  size_t GetLocalIndex(const uint64_t global_id) const
+  {
+    const uint64_t index = m_global_id_to_local_index.Find(global_id);
+    if (index == chi_data_types::FlatIndexMap::INVALID)
+      throw std::out_of_range("VertexHandler: vertex " +
+                              std::to_string(global_id) +
+                              " is not stored locally.");
+    return index;
+  }
+
+  /**Returns a vertex given its local index. No bounds checking.*/
+  const chi_mesh::Vector3& GetByLocalIndex(const size_t local_index) const
+  {
+    return m_vertices[local_index].second;
+  }
+
+  /**Returns the global-id of a vertex given its local index.*/
+  uint64_t GetGlobalID(const size_t local_index) const
+  {
+    return m_vertices[local_index].first;
   }
 
   // Utilities
   void Insert(const uint64_t global_id, const chi_mesh::Vector3& vec)
   {
-    m_global_id_vertex_map.insert(std::make_pair(global_id, vec));
+    if (m_global_id_to_local_index.Insert(global_id, m_vertices.size()))
+      m_vertices.emplace_back(global_id, vec);
+  }
+
+  void Reserve(const size_t num_vertices)
+  {
+    m_vertices.reserve(num_vertices);
+    m_global_id_to_local_index.Reserve(num_vertices);
   }
 
   size_t NumLocallyStored() const
   {
-    return m_global_id_vertex_map.size();
+    return m_vertices.size();
+  }
+
+  /**Returns the number of bytes allocated by the vertices and the
+   * global-id map.*/
+  size_t MemoryUsage() const
+  {
+    return m_vertices.capacity() * sizeof(VertexList::value_type) +
+           m_global_id_to_local_index.MemoryUsage();
   }
 
   void Clear()
   {
-    m_global_id_vertex_map.clear();
+    VertexList().swap(m_vertices);
+    m_global_id_to_local_index.clear();
   }
 };
 
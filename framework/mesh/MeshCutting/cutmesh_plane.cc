@@ -244,6 +244,8 @@ void chi_mesh::mesh_cutting::
     }//for cell_ptr
   }
 
+  mesh.BuildLocalIndexing();
+
   Chi::log.Log() << "Done cutting mesh with plane. Num cells = "
                 << mesh.local_cells.size();
 }
\ No newline at end of file
@@ -98,4 +98,33 @@ int chiMeshHandlerExportMeshToExodus(lua_State* L)
   grid->ExportCellsToExodus(file_name, suppress_nodesets, suppress_sidesets);
 
   return 0;
-}
\ No newline at end of file
+}
+
+//###################################################################
+/**Exports the mesh, as partitioned and connected on each process, to the
+native binary format. Each process writes `<FileName>_<location_id>.cmsh`.
+The mesh can be loaded again, with the same number of processes, using
+`chiVolumeMesherCreate(VOLUMEMESHER_BINARY, FileName)`, skipping mesh
+reading, connectivity and partitioning.
+\param FileName char Base name of the files to be used.
+\ingroup LuaMeshHandler
+*/
+int chiMeshHandlerExportMeshToBinary(lua_State* L)
+{
+  //============================================= Check arguments
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args != 1)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckStringValue(fname, L, 1);
+  const std::string file_name = lua_tostring(L,1);
+
+  //============================================= Get current handler
+  auto& cur_hndlr = chi_mesh::GetCurrentHandler();
+
+  auto& grid = cur_hndlr.GetGrid();
+  grid->ExportCellsToBinary(file_name);
+
+  return 0;
+}
@@ -14,6 +14,7 @@ RegisterLuaFunctionAsIs(chiMeshHandlerSetCurrent);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToObj);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToVTK);
 RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToExodus);
+RegisterLuaFunctionAsIs(chiMeshHandlerExportMeshToBinary);
 
 //#############################################################################
 /** Creates a mesh handler and sets it as "current".
@@ -8,5 +8,6 @@ int chiMeshHandlerSetCurrent(lua_State *L);
 int chiMeshHandlerExportMeshToObj(lua_State* L);
 int chiMeshHandlerExportMeshToVTK(lua_State* L);
 int chiMeshHandlerExportMeshToExodus(lua_State* L);
+int chiMeshHandlerExportMeshToBinary(lua_State* L);
 
 #endif //CHITECH_MESHHANDLER_LUA_H
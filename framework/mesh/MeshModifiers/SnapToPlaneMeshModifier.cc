@@ -117,6 +117,8 @@ void SnapToPlaneMeshModifier::Apply()
     //  chi::log.Log() << face.normal_.PrintStr();
   }
 
+  grid.InvalidateTopology();
+
   Chi::log.Log0Verbose1() << "Number of cells modified "
                           << cell_ids_modified.size();
 }
@@ -12,6 +12,7 @@
 RegisterLuaFunctionAsIs(chiMeshCreateUnpartitioned1DOrthoMesh);
 RegisterLuaFunctionAsIs(chiMeshCreateUnpartitioned2DOrthoMesh);
 RegisterLuaFunctionAsIs(chiMeshCreateUnpartitioned3DOrthoMesh);
+RegisterLuaFunctionAsIs(chiMeshCreateDistributedOrthoMesh);
 
 //###################################################################
 /** Creates a 1D Mesh from an array of 1D vertices.
@@ -278,4 +279,50 @@ int chiMeshCreateUnpartitioned3DOrthoMesh(lua_State* L)
   lua_pushnumber(L,0);
 
   return 2;
-}
\ No newline at end of file
+}
+
+//###################################################################
+/** Creates a 1D, 2D or 3D orthogonal mesh directly in distributed form.
+ * Each location only generates its own cells, ghost cells and vertices,
+ * with neighbors computed from the IJK indices, so that meshes with
+ * billions of cells can be created without ever building the global mesh.
+ * The mesh is generated by chiVolumeMesherExecute. With KBA_STYLE_XYZ
+ * partitioning the KBA parameters and cuts are used, all other partition
+ * types use a block decomposition of the IJK index space.
+
+\param x_nodes array_float Nodes along the x-axis (along z for 1D meshes).
+\param y_nodes array_float (Optional) Nodes along the y-axis.
+\param z_nodes array_float (Optional) Nodes along the z-axis.
+
+\ingroup LuaMeshMacros
+
+##_
+
+### Example
+An example 3D mesh creation below:
+\code
+chiMeshHandlerCreate()
+nodes={0.0,0.1,0.2,0.3,0.4,0.5,0.6,0.7,0.8,0.9,1.0}
+chiMeshCreateDistributedOrthoMesh(nodes,nodes,nodes)
+chiVolumeMesherExecute();
+\endcode*/
+int chiMeshCreateDistributedOrthoMesh(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args < 1 or num_args > 3)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  //=================================== Get node arrays
+  std::vector<std::vector<double>> node_sets(num_args);
+  for (int a = 1; a <= num_args; ++a)
+  {
+    LuaCheckTableValue(fname, L, a);
+    LuaPopulateVectorFrom1DArray(fname, L, a, node_sets[a-1]);
+  }
+
+  //=================================== Create mesher
+  chi_mesh::CreateDistributedOrthoMesh(std::move(node_sets));
+
+  return 0;
+}
@@ -4,5 +4,6 @@
 int chiMeshCreateUnpartitioned1DOrthoMesh(lua_State* L);
 int chiMeshCreateUnpartitioned2DOrthoMesh(lua_State* L);
 int chiMeshCreateUnpartitioned3DOrthoMesh(lua_State* L);
+int chiMeshCreateDistributedOrthoMesh(lua_State* L);
 
 #endif //CHITECH_LUA_MESH_ORTHOMACROS_H
@@ -0,0 +1,34 @@
+#include "mesh/chi_mesh.h"
+
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/SurfaceMesher/Predefined/surfmesher_predefined.h"
+#include "mesh/VolumeMesher/Orthogonal/volmesher_orthogonal.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+//###################################################################
+/**Sets up the current mesh handler to generate an orthogonal mesh
+ * directly in distributed form. One, two or three node sets create a 1D
+ * (along z), 2D or 3D mesh respectively. Contrary to the unpartitioned
+ * ortho macros no global mesh is ever built, which makes this suitable
+ * for meshes with billions of cells. The mesh is generated when the
+ * volume mesher is executed, using the partitioning options set on it.
+\code
+std::vector<double> nodes = {0.0,1.0,2.0};
+chi_mesh::CreateDistributedOrthoMesh({nodes,nodes,nodes});
+chi_mesh::GetCurrentHandler().GetVolumeMesher().Execute();
+\endcode*/
+void chi_mesh::CreateDistributedOrthoMesh(
+  std::vector<std::vector<double>> node_sets)
+{
+  //======================================== Get current mesh handler
+  auto& handler = chi_mesh::GetCurrentHandler();
+
+  //======================================== Create meshers
+  handler.SetSurfaceMesher(std::make_shared<chi_mesh::SurfaceMesherPredefined>());
+  handler.SetVolumeMesher(
+    std::make_shared<chi_mesh::VolumeMesherOrthogonal>(std::move(node_sets)));
+
+  handler.GetSurfaceMesher().Execute();
+}
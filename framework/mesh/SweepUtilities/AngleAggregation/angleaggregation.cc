@@ -3,6 +3,7 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 #include "chi_mpi.h"
+#include "utils/chi_memory_registry.h"
 
 #define ExceptionReflectedAngleError \
 std::logic_error(fname + \
@@ -232,6 +233,13 @@ void chi_mesh::sweep_management::AngleAggregation::InitializeReflectingBCs()
       if (rbndry.IsOpposingReflected())
         rbndry.GetHeteroBoundaryFluxOld() = rbndry.GetHeteroBoundaryFluxNew();
 
+      //========================================= Register memory
+      // The old fluxes become a copy of the new fluxes after the first sweep
+      typedef chi::MemoryRegistry MemReg;
+      MemReg::GetInstance().Set(
+        MemReg::REFLECTING_BOUNDARIES, &rbndry,
+        2 * MemReg::Bytes(rbndry.GetHeteroBoundaryFluxNew()));
+
       reflecting_bcs_initialized = true;
     }//if reflecting
   }//for bndry
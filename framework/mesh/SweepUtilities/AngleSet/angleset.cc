@@ -8,6 +8,8 @@
 #include "chi_runtime.h"
 #include "chi_mpi.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
+#include "utils/chi_memory_registry.h"
 
 
 //###################################################################
@@ -30,6 +32,32 @@ AngleSet(size_t in_numgrps,
   ref_subset(in_ref_subset)
 {
   sweep_buffer.BuildMessageStructure();
+
+  //================================================ Register memory
+  // The FLUDS buffers are sized by the FLUDS alone, hence the angleset's
+  // peak footprint is registered once here even though the local and
+  // outgoing buffers are only allocated when the angleset executes.
+  const size_t num_psi = num_grps * angles.size();
+  size_t num_values = 2 * fluds->delayed_local_psi_stride *
+                      fluds->delayed_local_psi_max_elements;
+  for (size_t fc = 0; fc < fluds->num_face_categories; ++fc)
+    num_values += fluds->local_psi_stride[fc] *
+                  fluds->local_psi_max_elements[fc];
+  for (const int face_dof_count : fluds->deplocI_face_dof_count)
+    num_values += face_dof_count;
+  for (const int face_dof_count : fluds->delayed_prelocI_face_dof_count)
+    num_values += 2 * face_dof_count;
+
+  typedef chi::MemoryRegistry MemReg;
+  MemReg::GetInstance().Set(MemReg::FLUDS_BUFFERS, this,
+                            num_values * num_psi * sizeof(double));
+}
+
+//###################################################################
+/**Removes the angleset's FLUDS buffers from the memory registry.*/
+chi_mesh::sweep_management::AngleSet::~AngleSet()
+{
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
 }
 
 //###################################################################
@@ -74,7 +102,10 @@ chi_mesh::sweep_management::AngleSet::
     sweep_buffer.InitializeLocalAndDownstreamBuffers();
 
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_BEGIN);
-    sweep_chunk.Sweep(this); //Execute chunk
+    {
+      chi::PerfRegion perf_region("SweepChunk");
+      sweep_chunk.Sweep(this); //Execute chunk
+    }
     Chi::log.LogEvent(timing_tags[0], chi::ChiLog::EventType::EVENT_END);
 
     //Send outgoing psi and clear local and receive buffers
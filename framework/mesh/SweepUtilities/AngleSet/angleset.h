@@ -51,6 +51,8 @@ public:
            int sweep_eager_limit,
            const chi::ChiMPICommunicatorSet& in_comm_set);
 
+  ~AngleSet();
+
   void InitializeDelayedUpstreamData();
 
   const chi_mesh::sweep_management::SPDS& GetSPDS() const;
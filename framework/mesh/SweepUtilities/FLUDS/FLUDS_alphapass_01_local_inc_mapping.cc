@@ -44,7 +44,7 @@ LocalIncidentMapping(const chi_mesh::Cell& cell,
 
         //======================================== Find associated face
         //                                         counter for slot lookup
-        const auto& adj_cell = grid->cells[face.neighbor_id_];
+        const auto& adj_cell = grid->cells.GetNeighbor(face);
         const int adj_so_index = local_so_cell_mapping[adj_cell.local_id_];
         const auto& face_oris = spds.cell_face_orientations_[adj_cell.local_id_];
         int ass_f_counter = -1;
@@ -2,6 +2,14 @@
 
 #include "chi_log.h"
 #include "chi_mpi.h"
+#include "utils/chi_memory_registry.h"
+
+//###################################################################
+/**Removes the boundary's flux storage from the memory registry.*/
+chi_mesh::sweep_management::BoundaryReflecting::~BoundaryReflecting()
+{
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
+}
 
 //###################################################################
 /**Returns a pointer to a reflected flux storage location.*/
@@ -157,6 +157,8 @@ public:
     normal_(in_normal)
   {}
 
+  ~BoundaryReflecting() override;
+
   const chi_mesh::Vector3& Normal() const {return normal_;}
   bool IsOpposingReflected() const {return opposing_reflected_;}
   void SetOpposingReflected(bool value) { opposing_reflected_ = value;}
@@ -2,12 +2,15 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 //###################################################################
 /**This is the entry point for sweeping.*/
 void chi_mesh::sweep_management::SweepScheduler::
      Sweep()
 {
+  chi::PerfRegion perf_region("Sweep");
+
   if (scheduler_type == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(m_sweep_chunk);
   else if (scheduler_type == SchedulingAlgorithm::DEPTH_OF_GRAPH)
@@ -49,7 +49,7 @@ void chi_mesh::sweep_management::PopulateCellRelationships(
 
         if (face.has_neighbor_ and grid.IsCellLocal(face.neighbor_id_))
         {
-          const auto& adj_cell = grid.cells[face.neighbor_id_];
+          const auto& adj_cell = grid.cells.GetNeighbor(face);
           const auto ass_face = face.GetNeighborAssociatedFace(grid);
           auto& adj_face_ori =
             cell_face_orientations[adj_cell.local_id_][ass_face];
@@ -65,7 +65,7 @@ void chi_mesh::sweep_management::PopulateCellRelationships(
       } // if face owned
       else if (face.has_neighbor_ and not grid.IsCellLocal(face.neighbor_id_))
       {
-        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        const auto& adj_cell = grid.cells.GetNeighbor(face);
         const auto ass_face = face.GetNeighborAssociatedFace(grid);
         const auto& adj_face = adj_cell.faces_[ass_face];
 
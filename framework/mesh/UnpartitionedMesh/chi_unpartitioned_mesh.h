@@ -53,6 +53,9 @@ public:
     size_t ortho_Nx = 0;
     size_t ortho_Ny = 0;
     size_t ortho_Nz = 0;
+    /**When true, each location only retains a contiguous slice of the
+     * cells (and the vertices they reference) after reading.*/
+    bool distributed = false;
 
     std::map<uint64_t, std::string> boundary_id_map;
   };
@@ -74,6 +77,15 @@ protected:
   Options mesh_options_;
   std::shared_ptr<BoundBox> bound_box_ = nullptr;
 
+  //Distributed ingestion. raw_cells_ then only holds the cells with
+  //global ids [slice_first_cell_id_, slice_first_cell_id_ + size) and
+  //vertices_ is replaced by the slice-referenced vertices.
+  bool is_distributed_ = false;
+  uint64_t slice_first_cell_id_ = 0;
+  uint64_t global_num_cells_ = 0;
+  uint64_t global_num_vertices_ = 0;
+  std::map<uint64_t, chi_mesh::Vertex> slice_vertices_;
+
 protected:
   static LightWeightCell* CreateCellFromVTKPolyhedron(vtkCell* vtk_cell);
   static LightWeightCell* CreateCellFromVTKPolygon(vtkCell* vtk_cell);
@@ -90,6 +102,24 @@ protected:
   void SetBoundaryIDsFromBlocks(
     std::vector<vtkUGridPtrAndName>& bndry_grid_blocks);
 
+  void CopyUGridCellsAndPointsSlice(vtkUnstructuredGrid& ugrid,
+                                    double scale);
+
+  const chi_mesh::Vertex& GetVertex(uint64_t vid) const
+  {
+    return is_distributed_ ? slice_vertices_.at(vid) : vertices_[vid];
+  }
+
+  void BuildDistributedMeshConnectivity();
+
+  static size_t ConnectFacesByHash(const std::vector<LightWeightCell*>& cells,
+                                   uint64_t cell_id_offset,
+                                   size_t num_threads);
+  static size_t AssignBoundaryIDsByHash(
+    const std::vector<LightWeightCell*>& cells,
+    const std::vector<LightWeightCell*>& bndry_cells,
+    size_t num_threads);
+
 
 public:
   const BoundBox& GetBoundBox() const {return *bound_box_;}
@@ -116,6 +146,19 @@ public:
   void BuildMeshConnectivity();
   void ComputeCentroidsAndCheckQuality();
 
+  bool IsDistributed() const {return is_distributed_;}
+  uint64_t GetSliceFirstCellID() const {return slice_first_cell_id_;}
+  uint64_t GetGlobalNumberOfCells() const
+  {return is_distributed_ ? global_num_cells_ : raw_cells_.size();}
+  uint64_t GetGlobalNumberOfVertices() const
+  {return is_distributed_ ? global_num_vertices_ : vertices_.size();}
+  const std::map<uint64_t, chi_mesh::Vertex>&
+  GetSliceVertices() const {return slice_vertices_;}
+
+  static std::pair<uint64_t, uint64_t>
+  GetSliceBounds(uint64_t num_items, int location_id, int num_locations);
+  void ExtractLocalSlice();
+
   void ReadFromVTU(const Options& options);
   void ReadFromPVTU(const Options& options);
   void ReadFromEnsightGold(const Options& options);
@@ -141,6 +184,7 @@ public:
     raw_cells_.clear(); raw_cells_.shrink_to_fit();
     raw_boundary_cells_.clear(); raw_boundary_cells_.shrink_to_fit();
     vertex_cell_subscriptions_.clear(); vertex_cell_subscriptions_.shrink_to_fit();
+    slice_vertices_.clear();
   }
 };
 
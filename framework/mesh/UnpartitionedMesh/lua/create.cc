@@ -96,6 +96,8 @@ int chiDestroyUnpartitionedMesh(lua_State* L)
 \param file_name char Filename of the .vtu file.
 \param field char Name of the cell data field from which to read
                   material and boundary identifiers (optional).
+\param distributed bool If true, each location only retains a slice of
+                       the cells (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -130,12 +132,15 @@ int chiUnpartitionedMeshFromVTU(lua_State* L)
   const char* temp = lua_tostring(L,1);
   const char* field = "";
   if (num_args >= 2) field = lua_tostring(L,2);
+  bool distributed = false;
+  if (num_args >= 3) distributed = lua_toboolean(L,3);
   auto new_object = new chi_mesh::UnpartitionedMesh;
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
   options.material_id_fieldname = field;
   options.boundary_id_fieldname = field;
+  options.distributed = distributed;
 
   new_object->ReadFromVTU(options);
 
@@ -154,6 +159,8 @@ int chiUnpartitionedMeshFromVTU(lua_State* L)
 \param file_name char Filename of the .vtu file.
 \param field char Name of the cell data field from which to read
                   material and boundary identifiers (optional).
+\param distributed bool If true, each location only retains a slice of
+                       the cells (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -188,12 +195,15 @@ chiVolumeMesherExecute()
     const char* temp = lua_tostring(L,1);
     const char* field = "";
     if (num_args >= 2) field = lua_tostring(L,2);
+    bool distributed = false;
+    if (num_args >= 3) distributed = lua_toboolean(L,3);
     auto new_object = new chi_mesh::UnpartitionedMesh;
 
     chi_mesh::UnpartitionedMesh::Options options;
     options.file_name = std::string(temp);
     options.material_id_fieldname = field;
     options.boundary_id_fieldname = field;
+    options.distributed = distributed;
 
     new_object->ReadFromPVTU(options);
 
@@ -211,6 +221,8 @@ Ensight Gold mesh files.
 
 \param file_name char Filename of the .case file.
 \param scale float Scale to apply to the mesh
+\param distributed bool If true, each location only retains a slice of
+                       the cells (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -244,11 +256,14 @@ int chiUnpartitionedMeshFromEnsightGold(lua_State* L)
   const char* temp = lua_tostring(L,1);
   double scale = 1.0;
   if (num_args >= 2) scale = lua_tonumber(L,2);
+  bool distributed = false;
+  if (num_args >= 3) distributed = lua_toboolean(L,3);
   auto new_object = new chi_mesh::UnpartitionedMesh;
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
   options.scale = scale;
+  options.distributed = distributed;
 
   new_object->ReadFromEnsightGold(options);
 
@@ -264,6 +279,8 @@ int chiUnpartitionedMeshFromEnsightGold(lua_State* L)
 /**Creates an unpartitioned mesh from a wavefront .obj file.
 
 \param file_name char Filename of the .case file.
+\param distributed bool If true, each location only retains a slice of
+                       the cells (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -292,13 +309,17 @@ int chiUnpartitionedMeshFromWavefrontOBJ(lua_State* L)
     LuaPostArgAmountError(func_name,1,num_args);
 
   LuaCheckNilValue(func_name,L,1);
+  if (num_args >= 2) LuaCheckNilValue(func_name,L,2);
 
   const char* temp = lua_tostring(L,1);
+  bool distributed = false;
+  if (num_args >= 2) distributed = lua_toboolean(L,2);
 
   auto new_object = new chi_mesh::UnpartitionedMesh;
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
+  options.distributed = distributed;
 
   new_object->ReadFromWavefrontOBJ(options);
 
@@ -314,6 +335,9 @@ int chiUnpartitionedMeshFromWavefrontOBJ(lua_State* L)
 /**Creates an unpartitioned mesh from a .msh file.
 
 \param file_name char Filename of the .msh file.
+\param distributed bool If true, each location only reads a slice of
+                       the elements and the nodes they reference
+                       (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -343,13 +367,17 @@ int chiUnpartitionedMeshFromMshFormat(lua_State* L)
     LuaPostArgAmountError(func_name,1,num_args);
 
   LuaCheckNilValue(func_name,L,1);
+  if (num_args >= 2) LuaCheckNilValue(func_name,L,2);
 
   const char* temp = lua_tostring(L,1);
+  bool distributed = false;
+  if (num_args >= 2) distributed = lua_toboolean(L,2);
 
   auto new_object = new chi_mesh::UnpartitionedMesh;
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
+  options.distributed = distributed;
 
   new_object->ReadFromMsh(options);
 
@@ -367,6 +395,8 @@ int chiUnpartitionedMeshFromMshFormat(lua_State* L)
 
 \param file_name char Filename of the .case file.
 \param scale float Scale to apply to the mesh
+\param distributed bool If true, each location only retains a slice of
+                       the cells (optional, default false).
 
 \ingroup LuaUnpartitionedMesh
 
@@ -400,11 +430,14 @@ int chiUnpartitionedMeshFromExodusII(lua_State* L)
   const char* temp = lua_tostring(L,1);
   double scale = 1.0;
   if (num_args >= 2) scale = lua_tonumber(L,2);
+  bool distributed = false;
+  if (num_args >= 3) distributed = lua_toboolean(L,3);
   auto new_object = new chi_mesh::UnpartitionedMesh;
 
   chi_mesh::UnpartitionedMesh::Options options;
   options.file_name = std::string(temp);
   options.scale = scale;
+  options.distributed = distributed;
 
   new_object->ReadFromExodus(options);
 
@@ -7,18 +7,305 @@
 
 #include "chi_mpi.h"
 
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+namespace
+{
+
+//###################################################################
+/**Sorted vertex-id tuples of a list of faces stored contiguously,
+ * together with a hash of each tuple.*/
+struct FaceKeyList
+{
+  std::vector<uint64_t> offsets = {0};
+  std::vector<uint64_t> vids;
+  std::vector<uint64_t> hashes;
+
+  size_t Size() const {return hashes.size();}
+
+  bool Equal(size_t a, const FaceKeyList& other, size_t b) const
+  {
+    if (hashes[a] != other.hashes[b]) return false;
+    const uint64_t len_a = offsets[a + 1] - offsets[a];
+    const uint64_t len_b = other.offsets[b + 1] - other.offsets[b];
+    if (len_a != len_b) return false;
+    return std::equal(vids.begin() + static_cast<long>(offsets[a]),
+                      vids.begin() + static_cast<long>(offsets[a + 1]),
+                      other.vids.begin() + static_cast<long>(other.offsets[b]));
+  }
+};
+
+//###################################################################
+/**Runs `function(thread_id)` on the requested number of threads.*/
+template<typename F>
+void ParallelForThreads(size_t num_threads, const F& function)
+{
+  if (num_threads <= 1) { function(size_t(0)); return; }
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; ++t)
+    threads.emplace_back(function, t);
+  for (auto& thread : threads)
+    thread.join();
+}
+
+//###################################################################
+/**Builds the keys of a list of vertex-id lists. Sorting and hashing is
+ * threaded over contiguous ranges of faces.*/
+FaceKeyList BuildFaceKeys(const std::vector<const std::vector<uint64_t>*>& faces,
+                          size_t num_threads)
+{
+  const size_t num_faces = faces.size();
+
+  FaceKeyList keys;
+  keys.offsets.resize(num_faces + 1, 0);
+  for (size_t f = 0; f < num_faces; ++f)
+    keys.offsets[f + 1] = keys.offsets[f] + faces[f]->size();
+  keys.vids.resize(keys.offsets.back());
+  keys.hashes.resize(num_faces);
+
+  ParallelForThreads(num_threads, [&](size_t t)
+  {
+    const size_t f0 = num_faces * t / num_threads;
+    const size_t f1 = num_faces * (t + 1) / num_threads;
+    for (size_t f = f0; f < f1; ++f)
+    {
+      auto begin = keys.vids.begin() + static_cast<long>(keys.offsets[f]);
+      std::copy(faces[f]->begin(), faces[f]->end(), begin);
+      std::sort(begin, begin + static_cast<long>(faces[f]->size()));
+
+      //splitmix64 finalizer combined over the tuple
+      uint64_t hash = 0x9e3779b97f4a7c15ULL * (faces[f]->size() + 1);
+      for (auto it = begin; it != begin + static_cast<long>(faces[f]->size());
+           ++it)
+      {
+        uint64_t z = *it + 0x9e3779b97f4a7c15ULL + hash;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        hash = z ^ (z >> 31);
+      }
+      keys.hashes[f] = hash;
+    }
+  });
+
+  return keys;
+}
+
+//###################################################################
+/**Flat open-addressing (linear probing) table of face indices keyed
+ * by the face keys in a FaceKeyList.*/
+class FaceHashTable
+{
+public:
+  static constexpr uint64_t EMPTY = std::numeric_limits<uint64_t>::max();
+
+private:
+  std::vector<uint64_t> slots_;
+  uint64_t mask_ = 0;
+
+public:
+  explicit FaceHashTable(size_t num_entries)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * num_entries) capacity <<= 1;
+    slots_.assign(capacity, EMPTY);
+    mask_ = capacity - 1;
+  }
+
+  /**Returns the slot holding a face with a key equal to that of
+   * `query_keys[q]`, or the empty slot where it should be inserted.*/
+  uint64_t& Probe(const FaceKeyList& table_keys,
+                  const FaceKeyList& query_keys, size_t q)
+  {
+    uint64_t i = (query_keys.hashes[q] >> 7) & mask_;
+    while (true)
+    {
+      uint64_t& slot = slots_[i];
+      if (slot == EMPTY or table_keys.Equal(slot, query_keys, q))
+        return slot;
+      i = (i + 1) & mask_;
+    }
+  }
+};
+
+}//namespace
+
+//###################################################################
+/**Connects the faces of the given cells that share the same set of
+ * vertices. Faces already having a neighbor are ignored. Neighbor ids
+ * are set to `cell_id_offset` plus the index of the neighbor in `cells`.
+ *
+ * Every face key is hashed into a flat open-addressing table and faces
+ * are matched in a single pass. With more than one thread the faces are
+ * bucketed by hash over per-thread tables so that no locking is required.
+ * Returns the number of face pairs connected.*/
+size_t chi_mesh::UnpartitionedMesh::
+  ConnectFacesByHash(const std::vector<LightWeightCell*>& cells,
+                     uint64_t cell_id_offset,
+                     size_t num_threads)
+{
+  num_threads = std::max<size_t>(num_threads, 1);
+
+  //======================================== Gather unconnected faces
+  std::vector<LightWeightFace*> faces;
+  std::vector<uint64_t> face_cell_ids;
+  std::vector<const std::vector<uint64_t>*> face_vids;
+  for (size_t c = 0; c < cells.size(); ++c)
+    for (auto& face : cells[c]->faces)
+      if (not face.has_neighbor)
+      {
+        faces.push_back(&face);
+        face_cell_ids.push_back(cell_id_offset + c);
+        face_vids.push_back(&face.vertex_ids);
+      }
+
+  const auto keys = BuildFaceKeys(face_vids, num_threads);
+  face_vids.clear(); face_vids.shrink_to_fit();
+
+  const size_t num_faces = keys.Size();
+  auto ThreadOf = [num_threads, &keys](size_t f)
+  {
+    return static_cast<size_t>(keys.hashes[f] % num_threads);
+  };
+
+  //======================================== Bucket faces by thread
+  // Counting pass and prefix sum. Faces keep their relative order within
+  // a bucket, which makes the matching independent of the thread count.
+  std::vector<size_t> bucket_offsets(num_threads + 1, 0);
+  for (size_t f = 0; f < num_faces; ++f)
+    ++bucket_offsets[ThreadOf(f) + 1];
+  for (size_t t = 0; t < num_threads; ++t)
+    bucket_offsets[t + 1] += bucket_offsets[t];
+
+  std::vector<size_t> bucket_faces(num_faces);
+  {
+    std::vector<size_t> next_slot(bucket_offsets.begin(),
+                                  bucket_offsets.end() - 1);
+    for (size_t f = 0; f < num_faces; ++f)
+      bucket_faces[next_slot[ThreadOf(f)]++] = f;
+  }
+
+  //======================================== Match faces
+  std::vector<size_t> thread_num_pairs(num_threads, 0);
+  ParallelForThreads(num_threads, [&](size_t t)
+  {
+    const size_t b0 = bucket_offsets[t];
+    const size_t b1 = bucket_offsets[t + 1];
+
+    FaceHashTable table(b1 - b0);
+    for (size_t b = b0; b < b1; ++b)
+    {
+      const size_t f = bucket_faces[b];
+
+      uint64_t& slot = table.Probe(keys, keys, f);
+      //Empty slot, or the face in the slot already found its
+      //neighbor (non-manifold), then this face takes the slot.
+      if (slot == FaceHashTable::EMPTY or faces[slot]->has_neighbor)
+      {
+        slot = f;
+        continue;
+      }
+
+      auto& face_a = *faces[slot];
+      auto& face_b = *faces[f];
+      face_a.neighbor = face_cell_ids[f];
+      face_b.neighbor = face_cell_ids[slot];
+      face_a.has_neighbor = true;
+      face_b.has_neighbor = true;
+      ++thread_num_pairs[t];
+    }
+  });
+
+  size_t num_pairs = 0;
+  for (size_t n : thread_num_pairs) num_pairs += n;
+
+  return num_pairs;
+}
+
+//###################################################################
+/**Sets the neighbor of every unconnected face of `cells` to the
+ * material-id (i.e., boundary-id) of the first boundary cell having the
+ * same set of vertices. Returns the number of faces assigned.*/
+size_t chi_mesh::UnpartitionedMesh::
+  AssignBoundaryIDsByHash(const std::vector<LightWeightCell*>& cells,
+                          const std::vector<LightWeightCell*>& bndry_cells,
+                          size_t num_threads)
+{
+  num_threads = std::max<size_t>(num_threads, 1);
+
+  if (bndry_cells.empty()) return 0;
+
+  //======================================== Build boundary cell table
+  std::vector<const std::vector<uint64_t>*> bndry_vids;
+  bndry_vids.reserve(bndry_cells.size());
+  for (const auto& cell : bndry_cells)
+    bndry_vids.push_back(&cell->vertex_ids);
+
+  const auto bndry_keys = BuildFaceKeys(bndry_vids, num_threads);
+  FaceHashTable table(bndry_keys.Size());
+  for (size_t b = 0; b < bndry_keys.Size(); ++b)
+  {
+    uint64_t& slot = table.Probe(bndry_keys, bndry_keys, b);
+    if (slot == FaceHashTable::EMPTY) slot = b;
+  }
+
+  //======================================== Look up unconnected faces
+  std::vector<LightWeightFace*> faces;
+  std::vector<const std::vector<uint64_t>*> face_vids;
+  for (auto& cell : cells)
+    for (auto& face : cell->faces)
+      if (not face.has_neighbor)
+      {
+        faces.push_back(&face);
+        face_vids.push_back(&face.vertex_ids);
+      }
+
+  const auto keys = BuildFaceKeys(face_vids, num_threads);
+  const size_t num_faces = keys.Size();
+
+  std::vector<size_t> thread_num_assigned(num_threads, 0);
+  ParallelForThreads(num_threads, [&](size_t t)
+  {
+    const size_t f0 = num_faces * t / num_threads;
+    const size_t f1 = num_faces * (t + 1) / num_threads;
+    for (size_t f = f0; f < f1; ++f)
+    {
+      //Probe only reads the table when the key is present
+      const uint64_t slot = table.Probe(bndry_keys, keys, f);
+      if (slot == FaceHashTable::EMPTY) continue;
+
+      faces[f]->neighbor = bndry_cells[slot]->material_id;
+      ++thread_num_assigned[t];
+    }
+  });
+
+  size_t num_assigned = 0;
+  for (size_t n : thread_num_assigned) num_assigned += n;
+
+  return num_assigned;
+}
+
 //###################################################################
 /**Establishes neighbor connectivity for the light-weight mesh.*/
 void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
 {
-  const size_t num_raw_cells = raw_cells_.size();
+  if (is_distributed_) { BuildDistributedMeshConnectivity(); return; }
+
   const size_t num_raw_vertices = vertices_.size();
+  const size_t num_threads = Chi::run_time::num_mesh_threads_;
 
   //======================================== Reset all cell neighbors
   int num_bndry_faces = 0;
+  size_t num_faces = 0;
   for (auto& cell : raw_cells_)
     for (auto& face : cell->faces)
+    {
       if (not face.has_neighbor) ++num_bndry_faces;
+      ++num_faces;
+    }
 
   Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
                               << " Number of unconnected faces "
@@ -27,8 +314,7 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Establishing cell connectivity.";
 
-  //======================================== Establish internal connectivity
-  // Populate vertex subscriptions to internal cells
+  //======================================== Populate vertex subscriptions
   vertex_cell_subscriptions_.resize(num_raw_vertices);
   {
     uint64_t cur_cell_id=0;
@@ -43,118 +329,30 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Vertex cell subscriptions complete.";
 
-  // Process raw cells
-  {
-    uint64_t aux_counter = 0;
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_cells_)
-    {
-      for (auto& cur_cell_face : cell->faces)
-      {
-        if (cur_cell_face.has_neighbor) {continue;}
-        const std::set<uint64_t> cfvids(cur_cell_face.vertex_ids.begin(),
-                                        cur_cell_face.vertex_ids.end());
-
-        std::set<size_t> cells_to_search;
-        for (uint64_t vid : cfvids)
-          for (uint64_t cell_id : vertex_cell_subscriptions_.at(vid))
-            if (cell_id != cur_cell_id)
-              cells_to_search.insert(cell_id);
-
-        for (uint64_t adj_cell_id : cells_to_search)
-        {
-          auto adj_cell = raw_cells_.at(adj_cell_id);
-
-          for (auto& adj_cell_face : adj_cell->faces)
-          {
-            if (adj_cell_face.has_neighbor) {continue;}
-            const std::set<uint64_t> afvids(adj_cell_face.vertex_ids.begin(),
-                                            adj_cell_face.vertex_ids.end());
-
-            if (cfvids == afvids)
-            {
-              cur_cell_face.neighbor = adj_cell_id;
-              adj_cell_face.neighbor = cur_cell_id;
-
-              cur_cell_face.has_neighbor = true;
-              adj_cell_face.has_neighbor = true;
-
-              goto face_neighbor_found;
-            }
-          }//for adjacent cell face
-        }
-        face_neighbor_found:;
-      }//for face
-
-      ++cur_cell_id;
-      const double fraction_complete = static_cast<double>(cur_cell_id)/
-                                       static_cast<double>(num_raw_cells);
-      if (fraction_complete >= static_cast<double>(aux_counter+1)*0.1)
-      {
-        Chi::log.Log() << Chi::program_timer.GetTimeString()
-                      << " Surpassing cell " << cur_cell_id
-                      << " of " << num_raw_cells
-                      << " (" << (aux_counter+1)*10 << "%)";
-        ++aux_counter;
-      }
-    }//for cell
-  }
+  //======================================== Establish internal connectivity
+  chi::Timer timer;
+  const size_t num_pairs = ConnectFacesByHash(raw_cells_, 0, num_threads);
+  const double internal_time = timer.GetTime() / 1000.0;
 
   Chi::log.Log() << Chi::program_timer.GetTimeString()
-                << " Establishing cell boundary connectivity.";
+                 << " Connected " << num_pairs << " face pairs out of "
+                 << num_faces << " faces in " << internal_time << " s ("
+                 << static_cast<double>(num_faces) /
+                    std::max(internal_time, 1.0e-12)
+                 << " faces/s, " << num_threads << " thread(s)).";
 
   //======================================== Establish boundary connectivity
-  // Make list of internal cells on the boundary
-  std::vector<LightWeightCell*> internal_cells_on_boundary;
-  for (auto& cell : raw_cells_)
-  {
-    bool cell_on_boundary = false;
-    for (auto& face : cell->faces)
-      if (not face.has_neighbor)
-      { cell_on_boundary = true; break; }
-
-    if (cell_on_boundary) internal_cells_on_boundary.push_back(cell);
-  }
-
-  // Populate vertex subscriptions to boundary cells
-  std::vector<std::set<uint64_t>> vertex_bndry_cell_subscriptions(vertices_.size());
-  {
-    uint64_t cur_cell_id=0;
-    for (auto& cell : raw_boundary_cells_)
-    {
-      for (auto vid : cell->vertex_ids)
-        vertex_bndry_cell_subscriptions.at(vid).insert(cur_cell_id);
-      ++cur_cell_id;
-    }
-  }
-
-  // Process boundary cells
-  for (auto& cell : internal_cells_on_boundary)
-    for (auto& face : cell->faces)
-    {
-      if (face.has_neighbor) continue;
-      std::set<uint64_t> cfvids(face.vertex_ids.begin(),
-                                face.vertex_ids.end());
-
-      std::set<size_t> cells_to_search;
-      for (uint64_t vid : face.vertex_ids)
-        for (uint64_t cell_id : vertex_bndry_cell_subscriptions[vid])
-          cells_to_search.insert(cell_id);
-
-      for (uint64_t adj_cell_id : cells_to_search)
-      {
-        auto& adj_cell = raw_boundary_cells_[adj_cell_id];
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                << " Establishing cell boundary connectivity.";
 
-        std::set<uint64_t> afvids(adj_cell->vertex_ids.begin(),
-                                  adj_cell->vertex_ids.end());
+  timer.Reset();
+  const size_t num_assigned =
+    AssignBoundaryIDsByHash(raw_cells_, raw_boundary_cells_, num_threads);
 
-        if (cfvids == afvids)
-        {
-          face.neighbor = adj_cell->material_id;
-          break;
-        }
-      }//for adj_cell_id
-    }//for face
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Assigned " << num_assigned
+                          << " boundary faces in "
+                          << timer.GetTime() / 1000.0 << " s.";
 
   num_bndry_faces = 0;
   for (auto cell : raw_cells_)
@@ -169,4 +367,4 @@ void chi_mesh::UnpartitionedMesh::BuildMeshConnectivity()
   Chi::log.Log() << Chi::program_timer.GetTimeString()
                 << " Done establishing cell connectivity.";
 
-}
\ No newline at end of file
+}
@@ -8,6 +8,9 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <limits>
 
 // ###################################################################
 /**Copies the vtk data structures to the current object's internal
@@ -185,6 +188,140 @@ void chi_mesh::UnpartitionedMesh::CopyUGridCellsAndPoints(
   Chi::log.Log() << fname + ": Done";
 }
 
+// ###################################################################
+/**Copies the vtk data structures of one location's piece of a
+ * distributed grid. The pieces must carry point global-ids so that
+ * vertices shared between pieces can be identified. Cells are numbered
+ * contiguously in location order.*/
+void chi_mesh::UnpartitionedMesh::CopyUGridCellsAndPointsSlice(
+  vtkUnstructuredGrid& ugrid, const double scale)
+{
+  const std::string fname =
+    "chi_mesh::UnpartitionedMesh::CopyUGridCellsAndPointsSlice";
+
+  const vtkIdType total_cell_count = ugrid.GetNumberOfCells();
+  const vtkIdType total_point_count = ugrid.GetNumberOfPoints();
+
+  auto pnts_gids =
+    vtkIdTypeArray::SafeDownCast(ugrid.GetPointData()->GetGlobalIds());
+  if (not pnts_gids)
+    throw std::logic_error(fname + ": Distributed reading requires point "
+                                   "global-ids.");
+
+  const auto& block_id_array_name = mesh_options_.material_id_fieldname;
+  auto block_id_array = vtkIntArray::SafeDownCast(
+    ugrid.GetCellData()->GetArray(block_id_array_name.c_str()));
+  if (not block_id_array)
+    throw std::logic_error(fname + ": grid had not \"" + block_id_array_name +
+                           "\" array.");
+
+  //=========================================== Determine id offset and
+  //                                            global vertex count
+  int64_t local_min_max[2] = {std::numeric_limits<int64_t>::max(), 0};
+  for (vtkIdType p = 0; p < total_point_count; ++p)
+  {
+    local_min_max[0] = std::min<int64_t>(local_min_max[0],
+                                         pnts_gids->GetValue(p));
+    local_min_max[1] = std::max<int64_t>(local_min_max[1],
+                                         pnts_gids->GetValue(p));
+  }
+  int64_t global_min = 0, global_max = 0;
+  MPI_Allreduce(&local_min_max[0], // sendbuf
+                &global_min,       // recvbuf
+                1, MPI_INT64_T,    // count+datatype
+                MPI_MIN,           // operation
+                Chi::mpi.comm);    // comm
+  MPI_Allreduce(&local_min_max[1], // sendbuf
+                &global_max,       // recvbuf
+                1, MPI_INT64_T,    // count+datatype
+                MPI_MAX,           // operation
+                Chi::mpi.comm);    // comm
+
+  global_num_vertices_ = static_cast<uint64_t>(global_max - global_min + 1);
+
+  //=========================================== Determine cell offset
+  const auto num_local_cells = static_cast<uint64_t>(total_cell_count);
+  uint64_t cell_offset = 0;
+  MPI_Exscan(&num_local_cells, // sendbuf
+             &cell_offset,     // recvbuf
+             1, MPI_UINT64_T,  // count+datatype
+             MPI_SUM,          // operation
+             Chi::mpi.comm);   // comm
+  if (Chi::mpi.location_id == 0) cell_offset = 0;
+
+  MPI_Allreduce(&num_local_cells,   // sendbuf
+                &global_num_cells_, // recvbuf
+                1, MPI_UINT64_T,    // count+datatype
+                MPI_SUM,            // operation
+                Chi::mpi.comm);     // comm
+  slice_first_cell_id_ = cell_offset;
+
+  //=========================================== Load cells
+  for (vtkIdType c = 0; c < total_cell_count; ++c)
+  {
+    auto vtk_cell = ugrid.GetCell(static_cast<vtkIdType>(c));
+    auto vtk_celldim = vtk_cell->GetCellDimension();
+
+    LightWeightCell* raw_cell;
+    if (vtk_celldim == 3) raw_cell = CreateCellFromVTKPolyhedron(vtk_cell);
+    else if (vtk_celldim == 2)
+      raw_cell = CreateCellFromVTKPolygon(vtk_cell);
+    else if (vtk_celldim == 1)
+      raw_cell = CreateCellFromVTKLine(vtk_cell);
+    else if (vtk_celldim == 0)
+      raw_cell = CreateCellFromVTKVertex(vtk_cell);
+    else
+      throw std::logic_error(fname + ": Unsupported cell dimension.");
+
+    for (uint64_t& vid : raw_cell->vertex_ids)
+      vid = pnts_gids->GetValue(static_cast<vtkIdType>(vid)) - global_min;
+
+    for (auto& face : raw_cell->faces)
+      for (uint64_t& vid : face.vertex_ids)
+        vid = pnts_gids->GetValue(static_cast<vtkIdType>(vid)) - global_min;
+
+    raw_cell->material_id = block_id_array->GetValue(c);
+
+    raw_cells_.push_back(raw_cell);
+  } // for cell c
+
+  //=========================================== Load points
+  for (vtkIdType p = 0; p < total_point_count; ++p)
+  {
+    auto point = ugrid.GetPoint(static_cast<vtkIdType>(p));
+    const uint64_t point_gid = pnts_gids->GetValue(p) - global_min;
+
+    slice_vertices_[point_gid] =
+      chi_mesh::Vector3(point[0], point[1], point[2]) * scale;
+  } // for point p
+
+  //================================================== Determine bound box
+  double local_bounds[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  ugrid.GetBounds(local_bounds);
+  double local_mins[3], local_maxs[3], global_mins[3], global_maxs[3];
+  for (int d = 0; d < 3; ++d)
+  {
+    local_mins[d] = scale * local_bounds[2 * d];
+    local_maxs[d] = scale * local_bounds[2 * d + 1];
+  }
+  MPI_Allreduce(local_mins,       // sendbuf
+                global_mins,      // recvbuf
+                3, MPI_DOUBLE,    // count+datatype
+                MPI_MIN,          // operation
+                Chi::mpi.comm);   // comm
+  MPI_Allreduce(local_maxs,       // sendbuf
+                global_maxs,      // recvbuf
+                3, MPI_DOUBLE,    // count+datatype
+                MPI_MAX,          // operation
+                Chi::mpi.comm);   // comm
+
+  bound_box_ = std::shared_ptr<BoundBox>(
+    new BoundBox{global_mins[0], global_maxs[0], global_mins[1],
+                 global_maxs[1], global_mins[2], global_maxs[2]});
+
+  Chi::log.Log() << fname + ": Done";
+}
+
 // ###################################################################
 /**Set material-ids from list.*/
 void chi_mesh::UnpartitionedMesh::SetMaterialIDsFromList(
@@ -0,0 +1,223 @@
+#include "chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
+#include "utils/chi_timer.h"
+
+#include <algorithm>
+
+//###################################################################
+/**Returns the contiguous range [first,last) of items owned by a location
+ * when `num_items` are split as evenly as possible over `num_locations`.*/
+std::pair<uint64_t, uint64_t> chi_mesh::UnpartitionedMesh::
+  GetSliceBounds(uint64_t num_items, int location_id, int num_locations)
+{
+  const auto loc = static_cast<uint64_t>(location_id);
+  const auto num_locs = static_cast<uint64_t>(num_locations);
+
+  return {num_items * loc / num_locs, num_items * (loc + 1) / num_locs};
+}
+
+//###################################################################
+/**Converts a fully read (replicated) mesh into a distributed one by
+ * keeping only this location's slice of cells and the vertices they
+ * reference. Connectivity and boundary-ids must already be established
+ * because neighbor information is no longer available afterwards.*/
+void chi_mesh::UnpartitionedMesh::ExtractLocalSlice()
+{
+  if (is_distributed_) return;
+
+  const uint64_t num_cells = raw_cells_.size();
+  const auto [c0, c1] = GetSliceBounds(num_cells,
+                                       Chi::mpi.location_id,
+                                       Chi::mpi.process_count);
+
+  std::vector<LightWeightCell*> slice_cells;
+  slice_cells.reserve(c1 - c0);
+  for (uint64_t c = 0; c < num_cells; ++c)
+    if (c >= c0 and c < c1) slice_cells.push_back(raw_cells_[c]);
+    else delete raw_cells_[c];
+  raw_cells_ = std::move(slice_cells);
+
+  for (auto& cell : raw_boundary_cells_) delete cell;
+  raw_boundary_cells_.clear(); raw_boundary_cells_.shrink_to_fit();
+
+  slice_vertices_.clear();
+  for (const auto& cell : raw_cells_)
+    for (uint64_t vid : cell->vertex_ids)
+      slice_vertices_.insert(std::make_pair(vid, vertices_[vid]));
+
+  slice_first_cell_id_ = c0;
+  global_num_cells_ = num_cells;
+  global_num_vertices_ = vertices_.size();
+
+  vertices_.clear(); vertices_.shrink_to_fit();
+  vertex_cell_subscriptions_.clear(); vertex_cell_subscriptions_.shrink_to_fit();
+
+  is_distributed_ = true;
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Unpartitioned mesh reduced to local slices of "
+                 << "approximately " << num_cells / Chi::mpi.process_count
+                 << " cells.";
+}
+
+//###################################################################
+/**Establishes neighbor connectivity when each location only holds a
+ * slice of the cells. Faces are first matched within the slice. The
+ * remaining unmatched faces, together with the boundary cells, are sent
+ * to a location determined by a hash of their sorted vertex-ids where
+ * they are paired and the outcome is returned to the originating
+ * locations. No location ever requires the global cell list.*/
+void chi_mesh::UnpartitionedMesh::BuildDistributedMeshConnectivity()
+{
+  const int num_locations = Chi::mpi.process_count;
+  const size_t num_local_cells = raw_cells_.size();
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Establishing distributed cell connectivity.";
+
+  //======================================== Establish slice connectivity
+  ConnectFacesByHash(raw_cells_, slice_first_cell_id_,
+                     Chi::run_time::num_mesh_threads_);
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Slice connectivity complete.";
+
+  //======================================== Lambda to determine the
+  //                                         location matching a face
+  auto FaceMatchingLocation = [num_locations](
+    const std::vector<uint64_t>& sorted_vids)
+  {
+    uint64_t hash = 0;
+    for (uint64_t vid : sorted_vids)
+      hash ^= vid + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return static_cast<int>(hash % static_cast<uint64_t>(num_locations));
+  };
+
+  //======================================== Serialize unmatched faces and
+  //                                         boundary cells
+  // Record: [num_verts, sorted vids..., tag, a, b]. With tag 0 the
+  // record is a cell face with a=cell global-id and b=face index. With
+  // tag 1 it is a boundary cell with a=boundary-id.
+  const uint64_t CELL_FACE = 0, BNDRY_CELL = 1;
+  std::map<int, std::vector<uint64_t>> face_records_to_send;
+  auto PackRecord = [&face_records_to_send, &FaceMatchingLocation](
+    std::vector<uint64_t> vids, uint64_t tag, uint64_t a, uint64_t b)
+  {
+    std::sort(vids.begin(), vids.end());
+    auto& data = face_records_to_send[FaceMatchingLocation(vids)];
+    data.push_back(vids.size());
+    data.insert(data.end(), vids.begin(), vids.end());
+    data.push_back(tag);
+    data.push_back(a);
+    data.push_back(b);
+  };
+
+  for (size_t lc = 0; lc < num_local_cells; ++lc)
+  {
+    const auto& faces = raw_cells_[lc]->faces;
+    for (size_t f = 0; f < faces.size(); ++f)
+      if (not faces[f].has_neighbor)
+        PackRecord(faces[f].vertex_ids, CELL_FACE,
+                   slice_first_cell_id_ + lc, f);
+  }
+
+  for (const auto& cell : raw_boundary_cells_)
+    PackRecord(cell->vertex_ids, BNDRY_CELL,
+               static_cast<uint64_t>(cell->material_id), 0);
+
+  const auto face_records_received =
+    chi_mpi_utils::MapAllToAll(face_records_to_send, MPI_UINT64_T);
+  face_records_to_send.clear();
+
+  //======================================== Match faces
+  struct FaceRecord
+  {
+    int location = 0;
+    uint64_t tag = 0, a = 0, b = 0;
+  };
+  std::map<std::vector<uint64_t>, std::vector<FaceRecord>> face_records;
+  for (const auto& [location, data] : face_records_received)
+  {
+    size_t k = 0;
+    while (k < data.size())
+    {
+      const size_t num_verts = data[k++];
+      std::vector<uint64_t> vids(data.begin() + static_cast<long>(k),
+                                 data.begin() + static_cast<long>(k +
+                                                                  num_verts));
+      k += num_verts;
+      FaceRecord record{location, data[k], data[k + 1], data[k + 2]};
+      k += 3;
+      face_records[vids].push_back(record);
+    }
+  }
+
+  // Reply: [cell global-id, face index, has_neighbor, neighbor]
+  std::map<int, std::vector<uint64_t>> face_replies_to_send;
+  for (const auto& [vids, records] : face_records)
+  {
+    std::vector<const FaceRecord*> cell_faces;
+    const FaceRecord* bndry_cell = nullptr;
+    for (const auto& record : records)
+      if (record.tag == CELL_FACE) cell_faces.push_back(&record);
+      else if (not bndry_cell)     bndry_cell = &record;
+
+    if (cell_faces.size() >= 2)
+    {
+      const auto& r0 = *cell_faces[0];
+      const auto& r1 = *cell_faces[1];
+      auto& data0 = face_replies_to_send[r0.location];
+      data0.insert(data0.end(), {r0.a, r0.b, 1, r1.a});
+      auto& data1 = face_replies_to_send[r1.location];
+      data1.insert(data1.end(), {r1.a, r1.b, 1, r0.a});
+    }
+    else if (cell_faces.size() == 1 and bndry_cell)
+    {
+      const auto& r0 = *cell_faces[0];
+      auto& data0 = face_replies_to_send[r0.location];
+      data0.insert(data0.end(), {r0.a, r0.b, 0, bndry_cell->a});
+    }
+  }
+  face_records.clear();
+
+  const auto face_replies_received =
+    chi_mpi_utils::MapAllToAll(face_replies_to_send, MPI_UINT64_T);
+
+  for (const auto& [location, data] : face_replies_received)
+    for (size_t k = 0; k < data.size(); k += 4)
+    {
+      const uint64_t lc = data[k] - slice_first_cell_id_;
+      auto& face = raw_cells_.at(lc)->faces.at(data[k + 1]);
+      face.has_neighbor = data[k + 2] == 1;
+      face.neighbor = data[k + 3];
+    }
+
+  //======================================== Boundary cells are no longer
+  //                                         needed
+  for (auto& cell : raw_boundary_cells_) delete cell;
+  raw_boundary_cells_.clear(); raw_boundary_cells_.shrink_to_fit();
+
+  uint64_t num_local_bndry_faces = 0;
+  for (const auto& cell : raw_cells_)
+    for (const auto& face : cell->faces)
+      if (not face.has_neighbor) ++num_local_bndry_faces;
+
+  uint64_t num_globl_bndry_faces = 0;
+  MPI_Allreduce(&num_local_bndry_faces,  // sendbuf
+                &num_globl_bndry_faces,  // recvbuf
+                1, MPI_UINT64_T,         // count+datatype
+                MPI_SUM,                 // operation
+                Chi::mpi.comm);          // comm
+
+  Chi::log.Log0Verbose1() << Chi::program_timer.GetTimeString()
+                          << " Number of boundary faces "
+                             "after connectivity: " << num_globl_bndry_faces;
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Done establishing distributed cell connectivity.";
+}
@@ -88,5 +88,8 @@ void chi_mesh::UnpartitionedMesh::ReadFromVTU(
   ComputeCentroidsAndCheckQuality();
   BuildMeshConnectivity();
 
+  //======================================== Keep only the local slice
+  if (options.distributed) ExtractLocalSlice();
+
   Chi::log.Log() << "Done reading VTU file: " << options.file_name << ".";
 }
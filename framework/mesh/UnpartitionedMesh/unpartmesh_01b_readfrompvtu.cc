@@ -10,6 +10,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
 
 #define ErrorReadingFile(fname) \
 std::runtime_error("Failed to open file: " + options.file_name + \
@@ -19,7 +20,9 @@ std::runtime_error("Failed to open file: " + options.file_name + \
 /**Reads a VTK unstructured mesh. This reader will use the following
  * options:
  * - `file_name`, of course.
- * - `material_id_fieldname`, cell data for material_id.*/
+ * - `material_id_fieldname`, cell data for material_id.
+ * - `distributed`, each location reads only a contiguous range of the
+ *   pieces. The pieces must then carry point global-ids.*/
 void chi_mesh::UnpartitionedMesh::
   ReadFromPVTU(const chi_mesh::UnpartitionedMesh::Options &options)
 {
@@ -39,7 +42,14 @@ void chi_mesh::UnpartitionedMesh::
   if (not reader->CanReadFile(options.file_name.c_str()))
     throw std::logic_error("Unable to read file-type with this routine");
   reader->UpdateInformation();
-  reader->Update();
+
+  //======================================== In distributed mode each
+  //                                         location reads a contiguous
+  //                                         range of the pieces
+  if (options.distributed)
+    reader->UpdatePiece(Chi::mpi.location_id, Chi::mpi.process_count, 0);
+  else
+    reader->Update();
 
   //======================================== Get all the grid blocks
   // For vtu files this is very simple. The
@@ -58,7 +68,13 @@ void chi_mesh::UnpartitionedMesh::
   auto ugrid = chi_mesh::ConsolidateGridBlocks(domain_grid_blocks);
 
   //======================================== Copy Data
-  CopyUGridCellsAndPoints(*ugrid, options.scale);
+  if (options.distributed)
+  {
+    is_distributed_ = true;
+    CopyUGridCellsAndPointsSlice(*ugrid, options.scale);
+  }
+  else
+    CopyUGridCellsAndPoints(*ugrid, options.scale);
 
   //======================================== Set material ids
   const auto material_ids = chi_mesh::BuildCellMaterialIDsFromField(
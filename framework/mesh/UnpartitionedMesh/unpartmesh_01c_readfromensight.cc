@@ -105,6 +105,9 @@ void chi_mesh::UnpartitionedMesh::
   //======================================== Set boundary ids
   SetBoundaryIDsFromBlocks(bndry_grid_blocks);
 
+  //======================================== Keep only the local slice
+  if (options.distributed) ExtractLocalSlice();
+
   Chi::log.Log() << "Done reading Ensight-Gold file: "
                  << options.file_name << ".";
 }
\ No newline at end of file
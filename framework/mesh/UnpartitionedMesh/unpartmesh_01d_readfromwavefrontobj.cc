@@ -367,4 +367,8 @@ void chi_mesh::UnpartitionedMesh::ReadFromWavefrontOBJ(const Options &options)
       ++bndry_id;
     }//for boundary block
   }
+
+  //======================================================= Keep only the local
+  //                                                        slice
+  if (options.distributed) ExtractLocalSlice();
 }
\ No newline at end of file
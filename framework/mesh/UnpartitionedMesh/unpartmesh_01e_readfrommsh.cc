@@ -63,10 +63,15 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
     throw std::logic_error(fname + ": Failed while trying to read "
                                    "the number of nodes.");
 
+  //In distributed mode the nodes are only read once the local slice of
+  //elements is known
+  is_distributed_ = options.distributed;
+  global_num_vertices_ = num_nodes;
+
   vertices_.clear();
-  vertices_.resize(num_nodes);
+  if (not is_distributed_) vertices_.resize(num_nodes);
 
-  for (int n=0; n<num_nodes; n++)
+  for (int n=0; n<num_nodes and not is_distributed_; n++)
   {
     std::getline(file, file_line);
     iss = std::istringstream(file_line);
@@ -201,6 +206,62 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
       throw std::logic_error(fname + ": Unsupported element encountered.");
   }//for n
 
+  //================================================== Lambdas for volume and
+  //                                                   boundary elements
+  auto IsVolumeElement = [&](int element_type)
+  {
+    return mesh_is_2D_assumption ? IsElementType2D(element_type) :
+                                   IsElementType3D(element_type);
+  };
+  auto IsBoundaryElement = [&](int element_type)
+  {
+    return mesh_is_2D_assumption ? IsElementType1D(element_type) :
+                                   IsElementType2D(element_type);
+  };
+
+  //================================================== Determine slices
+  // In distributed mode each location only keeps a contiguous slice of
+  // the volume elements and a contiguous slice of the boundary elements.
+  std::pair<uint64_t,uint64_t> volume_slice, bndry_slice;
+  if (is_distributed_)
+  {
+    file.seekg(0);
+    while (std::getline(file, file_line))
+      if ( elements_section_name == file_line ) break;
+
+    std::getline(file, file_line);
+    iss = std::istringstream(file_line);
+    if (!(iss >> num_elems))
+      throw std::logic_error(fname + ": Failed to read number of elements.");
+
+    uint64_t num_volume_elems = 0, num_bndry_elems = 0;
+    for (int n=0; n<num_elems; n++)
+    {
+      int element_index, elem_type;
+      std::getline(file, file_line);
+      iss = std::istringstream(file_line);
+      if ( !(iss >> element_index >> elem_type) )
+        throw std::logic_error(fname + ": Failed while reading element index "
+                                       "and element type.");
+      if (IsVolumeElement(elem_type))   ++num_volume_elems;
+      if (IsBoundaryElement(elem_type)) ++num_bndry_elems;
+    }
+
+    volume_slice = GetSliceBounds(num_volume_elems,
+                                  Chi::mpi.location_id,
+                                  Chi::mpi.process_count);
+    bndry_slice = GetSliceBounds(num_bndry_elems,
+                                 Chi::mpi.location_id,
+                                 Chi::mpi.process_count);
+    slice_first_cell_id_ = volume_slice.first;
+    global_num_cells_ = num_volume_elems;
+  }
+  uint64_t volume_elem_counter = 0, bndry_elem_counter = 0;
+  auto InSlice = [](uint64_t index, const std::pair<uint64_t,uint64_t>& slice)
+  {
+    return index >= slice.first and index < slice.second;
+  };
+
   //================================================== Return to the element
   //                                                   listing section
   // Now we will actually read the elements.
@@ -252,6 +313,14 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
     else
       continue;
 
+    if (is_distributed_)
+    {
+      if (IsVolumeElement(elem_type) and
+          not InSlice(volume_elem_counter++, volume_slice)) continue;
+      if (IsBoundaryElement(elem_type) and
+          not InSlice(bndry_elem_counter++, bndry_slice)) continue;
+    }
+
     //====================================== Make the cell on either the volume
     //                                       or the boundary
     LightWeightCell* raw_cell = nullptr;
@@ -349,6 +418,38 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
 
   }//for elements
 
+  //======================================== Read the nodes referenced by
+  //                                         the local slice
+  if (is_distributed_)
+  {
+    for (const auto& cell : raw_cells_)
+      for (uint64_t vid : cell->vertex_ids)
+        slice_vertices_[vid] = chi_mesh::Vertex();
+
+    file.clear();
+    file.seekg(0);
+    while (std::getline(file, file_line))
+      if ( node_section_name == file_line ) break;
+    std::getline(file, file_line);
+
+    for (int n=0; n<num_nodes; n++)
+    {
+      std::getline(file, file_line);
+      iss = std::istringstream(file_line);
+
+      int vert_index;
+      if ( !(iss >> vert_index) )
+        throw std::logic_error(fname + ": Failed to read vertex index.");
+
+      auto vertex = slice_vertices_.find(vert_index - 1);
+      if (vertex == slice_vertices_.end()) continue;
+
+      if (!(iss >> vertex->second.x >> vertex->second.y >> vertex->second.z))
+        throw std::logic_error(fname + ": Failed while reading the vertex "
+                                       "coordinates.");
+    }
+  }
+
   file.close();
 
   //======================================== Remap material-ids
@@ -364,6 +465,40 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
   for (auto& cell : raw_boundary_cells_)
     boundary_ids_set_as_read.insert(cell->material_id);
 
+  // The mapping must be identical on all locations when each
+  // location only saw a slice of the elements
+  auto AllgatherIDSet = [](std::set<int>& id_set)
+  {
+    const std::vector<int> local_ids(id_set.begin(), id_set.end());
+    const int local_count = static_cast<int>(local_ids.size());
+    std::vector<int> recv_counts(Chi::mpi.process_count, 0);
+    MPI_Allgather(&local_count, 1, MPI_INT,        // send
+                  recv_counts.data(), 1, MPI_INT,  // recv
+                  Chi::mpi.comm);                  // comm
+
+    std::vector<int> recv_displs(Chi::mpi.process_count, 0);
+    int total_count = 0;
+    for (int p = 0; p < Chi::mpi.process_count; ++p)
+    {
+      recv_displs[p] = total_count;
+      total_count += recv_counts[p];
+    }
+
+    std::vector<int> global_ids(total_count, 0);
+    MPI_Allgatherv(local_ids.data(), local_count, MPI_INT,  // send
+                   global_ids.data(),                       // recv
+                   recv_counts.data(), recv_displs.data(), MPI_INT,
+                   Chi::mpi.comm);                          // comm
+
+    id_set.insert(global_ids.begin(), global_ids.end());
+  };
+
+  if (is_distributed_)
+  {
+    AllgatherIDSet(material_ids_set_as_read);
+    AllgatherIDSet(boundary_ids_set_as_read);
+  }
+
   {
     int m=0;
     for (const auto& mat_id : material_ids_set_as_read)
@@ -390,8 +525,9 @@ void chi_mesh::UnpartitionedMesh::ReadFromMsh(const Options &options)
   BuildMeshConnectivity();
 
   Chi::log.Log() << "Done processing " << options.file_name << ".\n"
-                 << "Number of nodes read: " << vertices_.size() << "\n"
-                 << "Number of cells read: " << raw_cells_.size();
+                 << "Number of nodes read: " << GetGlobalNumberOfVertices()
+                 << "\n"
+                 << "Number of cells read: " << GetGlobalNumberOfCells();
 }
 
 
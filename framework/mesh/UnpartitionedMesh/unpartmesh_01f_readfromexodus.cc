@@ -128,6 +128,9 @@ void chi_mesh::UnpartitionedMesh::
   //======================================== Set boundary ids
   SetBoundaryIDsFromBlocks(bndry_grid_blocks);
 
+  //======================================== Keep only the local slice
+  if (options.distributed) ExtractLocalSlice();
+
   Chi::log.Log() << "Done reading Exodus file: "
                  << options.file_name << ".";
 }
\ No newline at end of file
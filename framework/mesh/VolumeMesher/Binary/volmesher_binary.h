@@ -0,0 +1,26 @@
+#ifndef CHI_MESH_VOLMESHER_BINARY_H
+#define CHI_MESH_VOLMESHER_BINARY_H
+
+#include "mesh/VolumeMesher/chi_volumemesher.h"
+
+//###################################################################
+/**A volume mesher that loads a mesh previously exported with
+ * MeshContinuum::ExportCellsToBinary. Each location memory-maps its own
+ * file and creates its local and ghost cells directly from the stored
+ * arrays, i.e., no text parsing, connectivity or partitioning is done.
+ * The number of locations must match the number of files written.*/
+class chi_mesh::VolumeMesherBinary : public chi_mesh::VolumeMesher
+{
+private:
+  const std::string file_base_name_;
+
+public:
+  explicit VolumeMesherBinary(std::string file_base_name) :
+    VolumeMesher(VolumeMesherType::BINARY),
+    file_base_name_(std::move(file_base_name))
+  {}
+
+  void Execute() override;
+};
+
+#endif //CHI_MESH_VOLMESHER_BINARY_H
@@ -0,0 +1,264 @@
+#include "volmesher_binary.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_binary.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "chi_log_exceptions.h"
+
+#include "utils/chi_timer.h"
+#include "console/chi_console.h"
+
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+//###################################################################
+/**Read-only memory mapping of a file. Unmapped on destruction.*/
+class MappedFile
+{
+private:
+  void* data_ = MAP_FAILED;
+  size_t size_ = 0;
+
+public:
+  explicit MappedFile(const std::string& file_name)
+  {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error("Failed to open binary mesh file " +
+                               file_name + ".");
+
+    struct stat file_stat{};
+    if (fstat(fd, &file_stat) != 0)
+    {
+      close(fd);
+      throw std::runtime_error("Failed to stat binary mesh file " +
+                               file_name + ".");
+    }
+    size_ = static_cast<size_t>(file_stat.st_size);
+
+    if (size_ > 0)
+      data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data_ == MAP_FAILED)
+      throw std::runtime_error("Failed to memory map binary mesh file " +
+                               file_name + ".");
+  }
+
+  ~MappedFile() { if (data_ != MAP_FAILED) munmap(data_, size_); }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const char* Data() const {return static_cast<const char*>(data_);}
+  size_t Size() const {return size_;}
+};
+
+//###################################################################
+/**Sequentially hands out typed pointers into a mapped file. Every array
+ * is checked to lie within the mapped bytes.*/
+class ArrayCursor
+{
+private:
+  const char* position_;
+  const char* const end_;
+  const std::string& file_name_;
+
+public:
+  ArrayCursor(const char* begin, const char* end,
+              const std::string& file_name) :
+    position_(begin), end_(end), file_name_(file_name) {}
+
+  template<typename T>
+  const T* Next(uint64_t count)
+  {
+    const auto num_remaining = static_cast<uint64_t>(end_ - position_);
+    ChiInvalidArgumentIf(count > num_remaining / sizeof(T),
+                         "File " + file_name_ + " is truncated or corrupt.");
+
+    const auto* array = reinterpret_cast<const T*>(position_);
+    position_ += count * sizeof(T);
+    return array;
+  }
+};
+
+//###################################################################
+/**Checks that an offsets array of `num_items + 1` entries starts at 0, is
+ * non-decreasing and ends at `num_values`, i.e., that every range it
+ * defines lies within the indexed array.*/
+void CheckOffsets(const uint64_t* offsets,
+                  uint64_t num_items,
+                  uint64_t num_values,
+                  const std::string& array_name,
+                  const std::string& file_name)
+{
+  bool valid = offsets[0] == 0 and offsets[num_items] == num_values;
+  for (uint64_t i = 0; i < num_items and valid; ++i)
+    valid = offsets[i] <= offsets[i + 1];
+
+  ChiInvalidArgumentIf(not valid, "File " + file_name + " has invalid " +
+                                  array_name + " offsets.");
+}
+}//namespace
+
+//###################################################################
+/**Loads the local and ghost cells of this location from its binary
+ * mesh file.*/
+void chi_mesh::VolumeMesherBinary::Execute()
+{
+  Chi::log.Log()
+    << Chi::program_timer.GetTimeString()
+    << " VolumeMesherBinary executing. Memory in use = "
+    << chi::Console::GetMemoryUsageInMB() << " MB"
+    << std::endl;
+
+  const std::string file_name =
+    MakeBinaryMeshFileName(file_base_name_, Chi::mpi.location_id);
+  const MappedFile file(file_name);
+
+  //======================================== Check header
+  ChiInvalidArgumentIf(file.Size() < sizeof(BinaryMeshHeader),
+                    "File " + file_name + " is not a binary mesh file.");
+
+  BinaryMeshHeader header;
+  std::memcpy(&header, file.Data(), sizeof(BinaryMeshHeader));
+
+  ChiInvalidArgumentIf(std::memcmp(header.magic, BinaryMeshHeader::MAGIC,
+                                sizeof(header.magic)) != 0,
+                    "File " + file_name + " is not a binary mesh file.");
+  ChiInvalidArgumentIf(header.version != BinaryMeshHeader::VERSION,
+                    "File " + file_name + " has unsupported version " +
+                    std::to_string(header.version) + ".");
+  ChiInvalidArgumentIf(header.byte_order_mark != BinaryMeshHeader::BYTE_ORDER_MARK,
+                    "File " + file_name + " was written with a different "
+                    "byte order.");
+  ChiInvalidArgumentIf(header.num_locations !=
+                    static_cast<uint64_t>(Chi::mpi.process_count),
+                    "File " + file_name + " was written for " +
+                    std::to_string(header.num_locations) + " locations "
+                    "but the current number of locations is " +
+                    std::to_string(Chi::mpi.process_count) + ".");
+  ChiInvalidArgumentIf(header.location_id !=
+                    static_cast<uint64_t>(Chi::mpi.location_id),
+                    "File " + file_name + " belongs to another location.");
+  ChiInvalidArgumentIf(file.Size() != header.FileSize(),
+                    "File " + file_name + " is truncated or corrupt.");
+  ChiInvalidArgumentIf(header.num_local_cells > header.num_cells,
+                    "File " + file_name + " has inconsistent local cells.");
+
+  //======================================== Map arrays
+  const uint64_t Nc = header.num_cells;
+  const uint64_t Nf = header.num_faces;
+  const uint64_t Nv = header.num_vertices;
+  const uint64_t Nb = header.num_boundaries;
+
+  // FileSize can wrap around for corrupt counts, hence every array is
+  // also checked against the mapped size
+  ArrayCursor cursor(file.Data() + sizeof(BinaryMeshHeader),
+                     file.Data() + file.Size(), file_name);
+  const auto* cell_global_ids     = cursor.Next<uint64_t>(Nc);
+  const auto* cell_partition_ids  = cursor.Next<uint64_t>(Nc);
+  const auto* cell_info           = cursor.Next<int32_t>(4 * Nc);
+  const auto* cell_centroids      = cursor.Next<double>(3 * Nc);
+  const auto* cell_vertex_offsets = cursor.Next<uint64_t>(Nc + 1);
+  const auto* cell_vertex_ids     = cursor.Next<uint64_t>(header.num_cell_vertex_ids);
+  const auto* cell_face_offsets   = cursor.Next<uint64_t>(Nc + 1);
+  const auto* face_vertex_offsets = cursor.Next<uint64_t>(Nf + 1);
+  const auto* face_vertex_ids     = cursor.Next<uint64_t>(header.num_face_vertex_ids);
+  const auto* face_normals        = cursor.Next<double>(3 * Nf);
+  const auto* face_centroids      = cursor.Next<double>(3 * Nf);
+  const auto* face_neighbor_ids   = cursor.Next<uint64_t>(Nf);
+  const auto* vertex_global_ids   = cursor.Next<uint64_t>(Nv);
+  const auto* vertex_coordinates  = cursor.Next<double>(3 * Nv);
+  const auto* boundary_ids        = cursor.Next<uint64_t>(Nb);
+  const auto* boundary_name_offsets = cursor.Next<uint64_t>(Nb + 1);
+  const auto* face_has_neighbor   = cursor.Next<uint8_t>(Nf);
+  const auto* boundary_names      = cursor.Next<char>(header.boundary_names_size);
+
+  //======================================== Check offsets
+  CheckOffsets(cell_vertex_offsets, Nc, header.num_cell_vertex_ids,
+               "cell vertex", file_name);
+  CheckOffsets(cell_face_offsets, Nc, Nf, "cell face", file_name);
+  CheckOffsets(face_vertex_offsets, Nf, header.num_face_vertex_ids,
+               "face vertex", file_name);
+  CheckOffsets(boundary_name_offsets, Nb, header.boundary_names_size,
+               "boundary name", file_name);
+
+  //======================================== Create grid
+  auto grid = chi_mesh::MeshContinuum::New();
+
+  auto& bndry_map = grid->GetBoundaryIDMap();
+  for (uint64_t b = 0; b < Nb; ++b)
+    bndry_map[boundary_ids[b]] =
+      std::string(boundary_names + boundary_name_offsets[b],
+                  boundary_names + boundary_name_offsets[b + 1]);
+
+  grid->vertices.Reserve(Nv);
+  for (uint64_t v = 0; v < Nv; ++v)
+    grid->vertices.Insert(vertex_global_ids[v],
+                          chi_mesh::Vector3(vertex_coordinates[3 * v + 0],
+                                            vertex_coordinates[3 * v + 1],
+                                            vertex_coordinates[3 * v + 2]));
+
+  for (uint64_t c = 0; c < Nc; ++c)
+  {
+    auto cell = std::make_unique<chi_mesh::Cell>(
+      static_cast<CellType>(cell_info[4 * c + 0]),
+      static_cast<CellType>(cell_info[4 * c + 1]));
+    cell->global_id_ = cell_global_ids[c];
+    cell->partition_id_ = cell_partition_ids[c];
+    cell->material_id_ = cell_info[4 * c + 2];
+    cell->centroid_ = chi_mesh::Vector3(cell_centroids[3 * c + 0],
+                                        cell_centroids[3 * c + 1],
+                                        cell_centroids[3 * c + 2]);
+    cell->vertex_ids_.assign(cell_vertex_ids + cell_vertex_offsets[c],
+                             cell_vertex_ids + cell_vertex_offsets[c + 1]);
+
+    cell->faces_.resize(cell_face_offsets[c + 1] - cell_face_offsets[c]);
+    for (uint64_t f = cell_face_offsets[c]; f < cell_face_offsets[c + 1]; ++f)
+    {
+      auto& face = cell->faces_[f - cell_face_offsets[c]];
+      face.vertex_ids_.assign(face_vertex_ids + face_vertex_offsets[f],
+                              face_vertex_ids + face_vertex_offsets[f + 1]);
+      face.normal_ = chi_mesh::Vector3(face_normals[3 * f + 0],
+                                       face_normals[3 * f + 1],
+                                       face_normals[3 * f + 2]);
+      face.centroid_ = chi_mesh::Vector3(face_centroids[3 * f + 0],
+                                         face_centroids[3 * f + 1],
+                                         face_centroids[3 * f + 2]);
+      face.has_neighbor_ = face_has_neighbor[f] != 0;
+      face.neighbor_id_ = face_neighbor_ids[f];
+    }
+
+    grid->cells.push_back(std::move(cell));
+  }//for cell
+
+  ChiInvalidArgumentIf(grid->local_cells.size() != header.num_local_cells,
+                    "File " + file_name + " has inconsistent local cells.");
+
+  grid->SetGlobalVertexCount(header.global_vertex_count);
+
+  SetContinuum(grid);
+  SetGridAttributes(static_cast<MeshAttributes>(header.attributes),
+                    {header.ortho_Nx, header.ortho_Ny, header.ortho_Nz});
+
+  //======================================== Concluding messages
+  Chi::log.LogAllVerbose1()
+    << "### LOCATION[" << Chi::mpi.location_id
+    << "] amount of local cells="
+    << grid->local_cells.size();
+
+  Chi::log.Log()
+    << "VolumeMesherBinary: Cells loaded = "
+    << grid->GetGlobalNumberOfCells()
+    << std::endl;
+}
@@ -7,6 +7,8 @@
 
 #include "chi_mpi.h"
 
+#include <algorithm>
+
 
 //###################################################################
 /** Creates nodes that are owned locally from the 2D template grid.*/
@@ -39,14 +41,32 @@ CreateLocalNodes(chi_mesh::MeshContinuum& template_grid,
     }//for template cell
   }//for layer
 
+  //============================================= Order template vertices
+  //                                              by global-id
+  // The vertex handler stores vertices in insertion order, whereas the
+  // extruded vertex-ids assume template vertices ordered by global-id.
+  std::vector<const chi_mesh::Vector3*> template_vertices;
+  {
+    std::vector<std::pair<uint64_t, const chi_mesh::Vector3*>> id_vertex_ptrs;
+    id_vertex_ptrs.reserve(template_grid.vertices.NumLocallyStored());
+    for (const auto& id_vertex : template_grid.vertices)
+      id_vertex_ptrs.emplace_back(id_vertex.first, &id_vertex.second);
+    std::sort(id_vertex_ptrs.begin(), id_vertex_ptrs.end());
+
+    template_vertices.reserve(id_vertex_ptrs.size());
+    for (const auto& id_vertex_ptr : id_vertex_ptrs)
+      template_vertices.push_back(id_vertex_ptr.second);
+  }
+
   //============================================= Now add all nodes
   //                                              that are local or neighboring
   uint64_t vid = 0;
+  grid.vertices.Reserve(vertex_ids_with_local_scope.size());
   for (auto layer_z_level : vertex_layers_)
   {
-    for (auto& id_vertex : template_grid.vertices)
+    for (const auto* template_vertex : template_vertices)
     {
-      const auto& vertex = id_vertex.second;
+      const auto& vertex = *template_vertex;
       auto local_scope = vertex_ids_with_local_scope.find(vid);
 
       if (local_scope != vertex_ids_with_local_scope.end())
@@ -127,6 +127,7 @@ void chi_mesh::VolumeMesherExtruder::Execute()
   }//if mesh-global
 
   Chi::log.LogAllVerbose1() << "Building local cell indices";
+  SetContinuum(grid);
 
   //================================== Print info
   Chi::log.LogAllVerbose1()
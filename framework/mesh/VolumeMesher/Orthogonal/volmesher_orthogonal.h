@@ -0,0 +1,46 @@
+#ifndef CHI_MESH_VOLMESHER_ORTHOGONAL_H
+#define CHI_MESH_VOLMESHER_ORTHOGONAL_H
+
+#include "mesh/VolumeMesher/chi_volumemesher.h"
+
+#include <array>
+
+//###################################################################
+/**A volume mesher that generates an orthogonal (structured) mesh
+ * directly in distributed form. Each location only creates its local
+ * cells, the ghost cells sharing a vertex with them and the associated
+ * vertices. Cell/vertex global-ids, neighbors and partition-ids are all
+ * computed arithmetically from the IJK indices, hence no location ever
+ * holds the global mesh.
+ *
+ * The node sets are given per dimension. A single set defines a 1D mesh
+ * along z, two sets a 2D mesh in xy and three sets a 3D mesh. Cell and
+ * vertex numbering is identical to that of the unpartitioned ortho mesh
+ * macros.*/
+class chi_mesh::VolumeMesherOrthogonal : public chi_mesh::VolumeMesher
+{
+private:
+  /**Node coordinates along x, y and z. Unused dimensions hold a single
+   * node at zero.*/
+  std::array<std::vector<double>, 3> nodes_;
+  const int dimension_;
+
+public:
+  explicit
+  VolumeMesherOrthogonal(std::vector<std::vector<double>> node_sets);
+
+  void Execute() override;
+
+  /**Returns the number of cells along each dimension.*/
+  std::array<size_t, 3> GetNumberOfCellsPerDimension() const;
+
+private:
+  std::array<std::vector<int>, 3>
+  GetIndexPartitionIDs(std::array<int, 3>& num_partitions) const;
+
+  static std::array<int, 3>
+  ComputeBlockDecomposition(const std::array<size_t, 3>& num_cells,
+                            int num_locations);
+};
+
+#endif //CHI_MESH_VOLMESHER_ORTHOGONAL_H
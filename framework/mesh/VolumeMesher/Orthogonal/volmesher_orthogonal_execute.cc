@@ -0,0 +1,277 @@
+#include "volmesher_orthogonal.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "utils/chi_timer.h"
+#include "console/chi_console.h"
+
+#include <algorithm>
+
+namespace
+{
+typedef std::array<int, 3> IJKOffset;
+
+/**Describes a cell face relative to the cell's lower IJK corner.*/
+struct FaceTemplate
+{
+  std::vector<IJKOffset> vertices;
+  IJKOffset neighbor;
+  uint64_t boundary_id;
+  chi_mesh::Vector3 normal;
+};
+
+/**Describes a cell relative to its lower IJK corner. Vertex and face
+ * ordering matches the unpartitioned ortho mesh macros.*/
+struct CellTemplate
+{
+  chi_mesh::CellType type;
+  chi_mesh::CellType sub_type;
+  std::vector<IJKOffset> vertices;
+  std::vector<FaceTemplate> faces;
+};
+
+//###################################################################
+/**Returns the cell template for the given dimension.*/
+CellTemplate GetCellTemplate(int dimension)
+{
+  using chi_mesh::CellType;
+  typedef chi_mesh::Vector3 Vec3;
+
+  if (dimension == 1)
+    return {CellType::SLAB, CellType::SLAB,
+            {{0,0,0},{0,0,1}},
+            {{{{0,0,0}}, {0,0,-1}, 5/*ZMIN*/, Vec3(0.0,0.0,-1.0)},
+             {{{0,0,1}}, {0,0, 1}, 4/*ZMAX*/, Vec3(0.0,0.0, 1.0)}}};
+
+  if (dimension == 2)
+    return {CellType::POLYGON, CellType::QUADRILATERAL,
+            {{0,0,0},{1,0,0},{1,1,0},{0,1,0}},
+            {{{{0,0,0},{1,0,0}}, { 0,-1,0}, 3/*YMIN*/, Vec3( 0.0,-1.0,0.0)},
+             {{{1,0,0},{1,1,0}}, { 1, 0,0}, 0/*XMAX*/, Vec3( 1.0, 0.0,0.0)},
+             {{{1,1,0},{0,1,0}}, { 0, 1,0}, 2/*YMAX*/, Vec3( 0.0, 1.0,0.0)},
+             {{{0,1,0},{0,0,0}}, {-1, 0,0}, 1/*XMIN*/, Vec3(-1.0, 0.0,0.0)}}};
+
+  return {CellType::POLYHEDRON, CellType::HEXAHEDRON,
+          {{0,0,0},{1,0,0},{1,1,0},{0,1,0},
+           {0,0,1},{1,0,1},{1,1,1},{0,1,1}},
+          {//East
+           {{{1,0,0},{1,1,0},{1,1,1},{1,0,1}}, { 1, 0, 0}, 0/*XMAX*/,
+            Vec3( 1.0, 0.0, 0.0)},
+           //West
+           {{{0,0,0},{0,0,1},{0,1,1},{0,1,0}}, {-1, 0, 0}, 1/*XMIN*/,
+            Vec3(-1.0, 0.0, 0.0)},
+           //North
+           {{{0,1,0},{0,1,1},{1,1,1},{1,1,0}}, { 0, 1, 0}, 2/*YMAX*/,
+            Vec3( 0.0, 1.0, 0.0)},
+           //South
+           {{{0,0,0},{1,0,0},{1,0,1},{0,0,1}}, { 0,-1, 0}, 3/*YMIN*/,
+            Vec3( 0.0,-1.0, 0.0)},
+           //Top
+           {{{0,0,1},{1,0,1},{1,1,1},{0,1,1}}, { 0, 0, 1}, 4/*ZMAX*/,
+            Vec3( 0.0, 0.0, 1.0)},
+           //Bottom
+           {{{0,0,0},{0,1,0},{1,1,0},{1,0,0}}, { 0, 0,-1}, 5/*ZMIN*/,
+            Vec3( 0.0, 0.0,-1.0)}}};
+}
+}//namespace
+
+//###################################################################
+/**Generates the local and ghost cells of this location.*/
+void chi_mesh::VolumeMesherOrthogonal::Execute()
+{
+  Chi::log.Log()
+    << Chi::program_timer.GetTimeString()
+    << " VolumeMesherOrthogonal executing. Memory in use = "
+    << chi::Console::GetMemoryUsageInMB() << " MB"
+    << std::endl;
+
+  //======================================== Check partitioning params
+  if (options.partition_type == KBA_STYLE_XYZ)
+  {
+    const int desired_process_count =
+      options.partition_x * options.partition_y * options.partition_z;
+
+    if (desired_process_count != Chi::mpi.process_count)
+    {
+      Chi::log.LogAllError()
+        << "ERROR: Number of processors available ("
+        << Chi::mpi.process_count <<
+        ") does not match amount of processors "
+        "required by partitioning parameters ("
+        << desired_process_count << ").";
+      Chi::Exit(EXIT_FAILURE);
+    }
+  }
+
+  //======================================== Determine decomposition
+  const auto num_cells = GetNumberOfCellsPerDimension();
+  const std::array<size_t, 3> num_nodes = {nodes_[0].size(),
+                                           nodes_[1].size(),
+                                           nodes_[2].size()};
+
+  std::array<int, 3> num_partitions = {1, 1, 1};
+  const auto index_pids = GetIndexPartitionIDs(num_partitions);
+
+  Chi::log.Log() << "Orthogonal mesh decomposed into "
+                 << num_partitions[0] << "x" << num_partitions[1] << "x"
+                 << num_partitions[2] << " partitions.";
+
+  const int Px = num_partitions[0];
+  const int Py = num_partitions[1];
+  const int loc = Chi::mpi.location_id;
+  const std::array<int, 3> my_pijk = {loc % Px, (loc / Px) % Py,
+                                      loc / (Px * Py)};
+
+  //======================================== Determine local and ghost
+  //                                         index ranges
+  // Ghosts are all cells sharing a vertex with a local cell, i.e., the
+  // local IJK box grown by one layer.
+  std::array<size_t, 3> lo = {0, 0, 0}, hi = {0, 0, 0};
+  bool has_local_cells = true;
+  for (int d = 0; d < 3; ++d)
+  {
+    const auto& pids = index_pids[d];
+    const auto first = std::find(pids.begin(), pids.end(), my_pijk[d]);
+    const auto last = std::find_if(first, pids.end(),
+                                   [&my_pijk, d](int p)
+                                   {return p != my_pijk[d];});
+    if (first == last) has_local_cells = false;
+
+    const auto l0 = static_cast<size_t>(first - pids.begin());
+    const auto l1 = static_cast<size_t>(last - pids.begin());
+    lo[d] = l0 > 0 ? l0 - 1 : 0;
+    hi[d] = std::min(l1 + 1, num_cells[d]);
+  }
+  if (not has_local_cells) hi = lo;
+
+  //======================================== Lambdas for global ids
+  auto CellGlobalID = [&num_cells](size_t i, size_t j, size_t k)
+  {
+    return static_cast<uint64_t>((j * num_cells[0] + i) * num_cells[2] + k);
+  };
+  auto VertexGlobalID = [&num_nodes](size_t i, size_t j, size_t k)
+  {
+    return static_cast<uint64_t>((j * num_nodes[0] + i) * num_nodes[2] + k);
+  };
+  auto CellPartitionID = [&index_pids, &num_partitions](size_t i,
+                                                        size_t j,
+                                                        size_t k)
+  {
+    return static_cast<uint64_t>(
+      index_pids[2][k] * num_partitions[0] * num_partitions[1] +
+      index_pids[1][j] * num_partitions[0] + index_pids[0][i]);
+  };
+
+  //======================================== Create cells
+  // Cells are created in global-id order (j, i, k), matching the
+  // unpartitioned ortho macros.
+  const auto cell_template = GetCellTemplate(dimension_);
+  auto grid = chi_mesh::MeshContinuum::New();
+
+  auto& bndry_map = grid->GetBoundaryIDMap();
+  if (dimension_ >= 2)
+  {
+    bndry_map[0] = "XMAX"; bndry_map[1] = "XMIN";
+    bndry_map[2] = "YMAX"; bndry_map[3] = "YMIN";
+  }
+  if (dimension_ != 2)
+  {
+    bndry_map[4] = "ZMAX"; bndry_map[5] = "ZMIN";
+  }
+
+  for (size_t j = lo[1]; j < hi[1]; ++j)
+    for (size_t i = lo[0]; i < hi[0]; ++i)
+      for (size_t k = lo[2]; k < hi[2]; ++k)
+      {
+        auto cell = std::make_unique<chi_mesh::Cell>(cell_template.type,
+                                                     cell_template.sub_type);
+        cell->global_id_ = CellGlobalID(i, j, k);
+        cell->partition_id_ = CellPartitionID(i, j, k);
+
+        cell->centroid_ = chi_mesh::Vector3(0.0, 0.0, 0.0);
+        for (const auto& v : cell_template.vertices)
+        {
+          const size_t vi = i + v[0], vj = j + v[1], vk = k + v[2];
+          const auto vertex = chi_mesh::Vector3(nodes_[0][vi],
+                                                nodes_[1][vj],
+                                                nodes_[2][vk]);
+          const uint64_t vid = VertexGlobalID(vi, vj, vk);
+          cell->vertex_ids_.push_back(vid);
+          cell->centroid_ += vertex;
+          grid->vertices.Insert(vid, vertex);
+        }
+        cell->centroid_ = cell->centroid_ /
+                          static_cast<double>(cell_template.vertices.size());
+
+        for (const auto& face_template : cell_template.faces)
+        {
+          chi_mesh::CellFace face;
+          face.centroid_ = chi_mesh::Vector3(0.0, 0.0, 0.0);
+          for (const auto& v : face_template.vertices)
+          {
+            const size_t vi = i + v[0], vj = j + v[1], vk = k + v[2];
+            face.vertex_ids_.push_back(VertexGlobalID(vi, vj, vk));
+            face.centroid_ += chi_mesh::Vector3(nodes_[0][vi],
+                                                nodes_[1][vj],
+                                                nodes_[2][vk]);
+          }
+          face.centroid_ = face.centroid_ /
+                           static_cast<double>(face_template.vertices.size());
+          face.normal_ = face_template.normal;
+
+          // Neighbor indices wrap around when below zero, hence a single
+          // upper bound check suffices.
+          const auto& nb = face_template.neighbor;
+          const size_t ni = i + nb[0], nj = j + nb[1], nk = k + nb[2];
+          if (ni < num_cells[0] and nj < num_cells[1] and nk < num_cells[2])
+          {
+            face.has_neighbor_ = true;
+            face.neighbor_id_ = CellGlobalID(ni, nj, nk);
+          }
+          else
+          {
+            face.has_neighbor_ = false;
+            face.neighbor_id_ = face_template.boundary_id;
+          }
+
+          cell->faces_.push_back(std::move(face));
+        }//for face
+
+        grid->cells.push_back(std::move(cell));
+      }//for k
+
+  grid->SetGlobalVertexCount(num_nodes[0] * num_nodes[1] * num_nodes[2]);
+
+  Chi::log.Log() << "Cells loaded.";
+  Chi::mpi.Barrier();
+
+  SetContinuum(grid);
+  const auto dim_attrib = dimension_ == 1 ? DIMENSION_1 :
+                          dimension_ == 2 ? DIMENSION_2 : DIMENSION_3;
+  SetGridAttributes(dim_attrib | ORTHOGONAL, num_cells);
+
+  //======================================== Concluding messages
+  Chi::log.LogAllVerbose1()
+    << "### LOCATION[" << Chi::mpi.location_id
+    << "] amount of local cells="
+    << grid->local_cells.size();
+
+  size_t total_local_cells = grid->local_cells.size();
+  size_t total_global_cells = 0;
+
+  MPI_Allreduce(&total_local_cells,
+                &total_global_cells,
+                1,
+                MPI_UNSIGNED_LONG_LONG,
+                MPI_SUM,
+                Chi::mpi.comm);
+
+  Chi::log.Log()
+    << "VolumeMesherOrthogonal: Cells created = "
+    << total_global_cells
+    << std::endl;
+}
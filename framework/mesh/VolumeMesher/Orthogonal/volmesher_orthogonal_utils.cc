@@ -0,0 +1,150 @@
+#include "volmesher_orthogonal.h"
+
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <limits>
+
+//###################################################################
+/**Constructor. One, two or three node sets define a 1D (along z), 2D
+ * or 3D mesh respectively.*/
+chi_mesh::VolumeMesherOrthogonal::
+  VolumeMesherOrthogonal(std::vector<std::vector<double>> node_sets) :
+  VolumeMesher(VolumeMesherType::ORTHOGONAL),
+  dimension_(static_cast<int>(node_sets.size()))
+{
+  ChiInvalidArgumentIf(node_sets.empty() or node_sets.size() > 3,
+                       "Orthogonal meshes require 1, 2 or 3 node sets.");
+  for (const auto& node_set : node_sets)
+    ChiInvalidArgumentIf(node_set.size() < 2,
+                         "Each node set requires at least 2 nodes.");
+
+  nodes_.fill({0.0});
+  if (dimension_ == 1)
+    nodes_[2] = std::move(node_sets[0]);
+  else
+    for (int d = 0; d < dimension_; ++d)
+      nodes_[d] = std::move(node_sets[d]);
+}
+
+//###################################################################
+/**Returns the number of cells along each dimension. Unused dimensions
+ * count as a single layer of cells.*/
+std::array<size_t, 3> chi_mesh::VolumeMesherOrthogonal::
+  GetNumberOfCellsPerDimension() const
+{
+  std::array<size_t, 3> num_cells = {1, 1, 1};
+  for (int d = 0; d < 3; ++d)
+    num_cells[d] = std::max<size_t>(1, nodes_[d].size() - 1);
+  return num_cells;
+}
+
+//###################################################################
+/**Determines, for each dimension, the partition index of every 1D cell
+ * index, together with the number of partitions per dimension. The
+ * partition-id of cell (i,j,k) is then
+ * `pz[k]*Px*Py + py[j]*Px + px[i]`.
+ *
+ * KBA_STYLE_XYZ partitioning uses the KBA parameters and cuts of the
+ * volume mesher. All other partition types use a block decomposition
+ * minimizing the number of inter-partition faces.*/
+std::array<std::vector<int>, 3> chi_mesh::VolumeMesherOrthogonal::
+  GetIndexPartitionIDs(std::array<int, 3>& num_partitions) const
+{
+  const auto num_cells = GetNumberOfCellsPerDimension();
+  std::array<std::vector<int>, 3> index_pids;
+  for (int d = 0; d < 3; ++d)
+    index_pids[d].assign(num_cells[d], 0);
+
+  if (options.partition_type == KBA_STYLE_XYZ)
+  {
+    num_partitions = {options.partition_x,
+                      options.partition_y,
+                      options.partition_z};
+
+    //======================================== Reference centroid
+    chi_mesh::Vector3 ref_centroid;
+    for (int d = 0; d < 3; ++d)
+      ref_centroid(d) = nodes_[d].size() > 1 ?
+                        0.5 * (nodes_[d][0] + nodes_[d][1]) : nodes_[d][0];
+
+    //======================================== Classify 1D cell indices
+    chi_mesh::Cell temp_cell(CellType::GHOST, CellType::GHOST);
+    for (int d = 0; d < 3; ++d)
+    {
+      if (nodes_[d].size() < 2) continue;
+      for (size_t c = 0; c < num_cells[d]; ++c)
+      {
+        temp_cell.centroid_ = ref_centroid;
+        temp_cell.centroid_(d) = 0.5 * (nodes_[d][c] + nodes_[d][c + 1]);
+
+        const auto xyz = GetCellXYZPartitionID(&temp_cell);
+        index_pids[d][c] = d == 0 ? std::get<0>(xyz) :
+                           d == 1 ? std::get<1>(xyz) : std::get<2>(xyz);
+      }
+    }
+  }
+  else
+  {
+    num_partitions = ComputeBlockDecomposition(num_cells,
+                                               Chi::mpi.process_count);
+
+    for (int d = 0; d < 3; ++d)
+      for (int p = 0; p < num_partitions[d]; ++p)
+      {
+        const auto [c0, c1] = UnpartitionedMesh::GetSliceBounds(
+          num_cells[d], p, num_partitions[d]);
+        for (uint64_t c = c0; c < c1; ++c)
+          index_pids[d][c] = p;
+      }
+  }
+
+  return index_pids;
+}
+
+//###################################################################
+/**Factors the number of locations into Px*Py*Pz such that no dimension
+ * has more partitions than cells and the total area of the partition
+ * interfaces, measured in cell faces, is minimal.*/
+std::array<int, 3> chi_mesh::VolumeMesherOrthogonal::
+  ComputeBlockDecomposition(const std::array<size_t, 3>& num_cells,
+                            int num_locations)
+{
+  const auto nx = static_cast<double>(num_cells[0]);
+  const auto ny = static_cast<double>(num_cells[1]);
+  const auto nz = static_cast<double>(num_cells[2]);
+
+  std::array<int, 3> best = {0, 0, 0};
+  double best_cost = std::numeric_limits<double>::max();
+  for (int px = 1; px <= num_locations; ++px)
+  {
+    if (num_locations % px != 0) continue;
+    for (int py = 1; py <= num_locations / px; ++py)
+    {
+      if ((num_locations / px) % py != 0) continue;
+      const int pz = num_locations / px / py;
+
+      if (static_cast<size_t>(px) > num_cells[0] or
+          static_cast<size_t>(py) > num_cells[1] or
+          static_cast<size_t>(pz) > num_cells[2]) continue;
+
+      const double cost = (px - 1) * ny * nz +
+                          (py - 1) * nx * nz +
+                          (pz - 1) * nx * ny;
+      if (cost < best_cost)
+      {
+        best_cost = cost;
+        best = {px, py, pz};
+      }
+    }
+  }
+
+  ChiInvalidArgumentIf(best[0] == 0,
+                       "The orthogonal mesh cannot be decomposed over " +
+                       std::to_string(num_locations) + " locations.");
+
+  return best;
+}
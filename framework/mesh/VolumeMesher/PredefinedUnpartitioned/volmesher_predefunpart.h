@@ -34,11 +34,41 @@ public:
   static
   std::vector<int64_t> PARMETIS(const UnpartitionedMesh &umesh);
 
+  static
+  std::vector<int64_t> SFC(const UnpartitionedMesh &umesh, bool hilbert);
+
+  static
+  std::pair<uint64_t, uint64_t>
+  GetPartitioningSlice(const UnpartitionedMesh &umesh);
+
+  static
+  std::vector<int64_t>
+  GatherPartitionIDs(const UnpartitionedMesh &umesh,
+                     const std::vector<int64_t>& slice_cell_pids);
+
+  static int64_t CellPartitionWeight(
+    const chi_mesh::UnpartitionedMesh::LightWeightCell& raw_cell);
+
+  static int64_t FacePartitionWeight(
+    const chi_mesh::UnpartitionedMesh::LightWeightFace& raw_face);
+
   static std::unique_ptr<chi_mesh::Cell>
   MakeCell(
     const chi_mesh::UnpartitionedMesh::LightWeightCell& raw_cell,
     uint64_t global_id,
     uint64_t partition_id,
     const std::vector<chi_mesh::Vector3>& vertices);
+
+  static std::unique_ptr<chi_mesh::Cell>
+  MakeCell(
+    const chi_mesh::UnpartitionedMesh::LightWeightCell& raw_cell,
+    uint64_t global_id,
+    uint64_t partition_id,
+    const std::map<uint64_t, chi_mesh::Vector3>& vertices);
+
+  static
+  void LoadDistributedCells(const chi_mesh::UnpartitionedMesh& umesh,
+                            const std::vector<int64_t>& slice_cell_pids,
+                            chi_mesh::MeshContinuum& grid);
 };
 #endif //VOLMESHER_PREDEFUNPART_H
\ No newline at end of file
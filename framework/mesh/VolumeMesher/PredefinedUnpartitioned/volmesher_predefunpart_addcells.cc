@@ -2,15 +2,20 @@
 #include "mesh/Cell/cell.h"
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
+namespace
+{
 //###################################################################
-/**Adds a cell to the grid from a light-weight cell.*/
-std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
-  MakeCell(
-    const chi_mesh::UnpartitionedMesh::LightWeightCell &raw_cell,
-    uint64_t global_id,
-    uint64_t partition_id,
-    const std::vector<chi_mesh::Vector3>& vertices)
+/**Makes a cell from a light-weight cell. Vertex coordinates are
+ * obtained from the supplied lookup.*/
+template<typename VertexLookup>
+std::unique_ptr<chi_mesh::Cell> MakeCellImpl(
+  const chi_mesh::UnpartitionedMesh::LightWeightCell &raw_cell,
+  uint64_t global_id,
+  uint64_t partition_id,
+  const VertexLookup& vertices)
 {
+  using chi_mesh::CellType;
+
   auto cell = std::make_unique<chi_mesh::Cell>(raw_cell.type, raw_cell.sub_type);
   cell->centroid_     = raw_cell.centroid;
   cell->global_id_    = global_id;
@@ -30,7 +35,7 @@ std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
     newFace.vertex_ids_ = raw_face.vertex_ids;
     auto vfc = chi_mesh::Vertex(0.0, 0.0, 0.0);
     for (auto fvid : newFace.vertex_ids_)
-      vfc = vfc + vertices[fvid];
+      vfc = vfc + vertices(fvid);
     newFace.centroid_ = vfc / static_cast<double>(newFace.vertex_ids_.size());
 
     if (cell->Type() == CellType::SLAB)
@@ -50,7 +55,7 @@ std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
       // centroid. The normal is then just khat
       // cross-product with this vector.
       uint64_t fvid = newFace.vertex_ids_[0];
-      auto vec_vvc = vertices[fvid] - newFace.centroid_;
+      auto vec_vvc = vertices(fvid) - newFace.centroid_;
 
       newFace.normal_ = chi_mesh::Vector3(0.0, 0.0, 1.0).Cross(vec_vvc);
       newFace.normal_.Normalize();
@@ -70,8 +75,8 @@ std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
         uint64_t fvid_m = newFace.vertex_ids_[fv  ];
         uint64_t fvid_p = newFace.vertex_ids_[fvp1];
 
-        auto leg_m = vertices[fvid_m] - newFace.centroid_;
-        auto leg_p = vertices[fvid_p] - newFace.centroid_;
+        auto leg_m = vertices(fvid_m) - newFace.centroid_;
+        auto leg_p = vertices(fvid_p) - newFace.centroid_;
 
         auto vn = leg_m.Cross(leg_p);
 
@@ -89,4 +94,35 @@ std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
   }
 
   return cell;
-}
\ No newline at end of file
+}
+
+}//namespace
+
+//###################################################################
+/**Adds a cell to the grid from a light-weight cell.*/
+std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  MakeCell(
+    const chi_mesh::UnpartitionedMesh::LightWeightCell &raw_cell,
+    uint64_t global_id,
+    uint64_t partition_id,
+    const std::vector<chi_mesh::Vector3>& vertices)
+{
+  return MakeCellImpl(raw_cell, global_id, partition_id,
+                      [&vertices](uint64_t vid) -> const chi_mesh::Vector3&
+                      { return vertices[vid]; });
+}
+
+//###################################################################
+/**Adds a cell to the grid from a light-weight cell with the vertices
+ * supplied as a map from global vertex-id.*/
+std::unique_ptr<chi_mesh::Cell> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  MakeCell(
+    const chi_mesh::UnpartitionedMesh::LightWeightCell &raw_cell,
+    uint64_t global_id,
+    uint64_t partition_id,
+    const std::map<uint64_t, chi_mesh::Vector3>& vertices)
+{
+  return MakeCellImpl(raw_cell, global_id, partition_id,
+                      [&vertices](uint64_t vid) -> const chi_mesh::Vector3&
+                      { return vertices.at(vid); });
+}
@@ -0,0 +1,243 @@
+#include "volmesher_predefunpart.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
+#include "utils/chi_timer.h"
+
+//###################################################################
+/**Migrates the cells of a distributed unpartitioned mesh to the
+ * locations that need them, i.e., the owning location and every location
+ * owning a cell that shares a vertex with it (ghosts). Each location only
+ * provides its slice of cells and the partition-ids of that slice. All
+ * communication is done with all-to-all exchanges so that no location
+ * ever holds more than its own cells plus ghosts.*/
+void chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  LoadDistributedCells(const chi_mesh::UnpartitionedMesh& umesh,
+                       const std::vector<int64_t>& slice_cell_pids,
+                       chi_mesh::MeshContinuum& grid)
+{
+  const int num_locations = Chi::mpi.process_count;
+  const auto& raw_cells = umesh.GetRawCells();
+  const auto& slice_vertices = umesh.GetSliceVertices();
+  const uint64_t first_gid = umesh.GetSliceFirstCellID();
+  const size_t num_slice_cells = raw_cells.size();
+
+  ChiLogicalErrorIf(slice_cell_pids.size() != num_slice_cells,
+                    "Partition-id list does not match the local slice.");
+
+  auto VertexOwner = [num_locations](uint64_t vid)
+  {
+    return static_cast<int>(vid % static_cast<uint64_t>(num_locations));
+  };
+
+  //======================================== Determine the partitions
+  //                                         subscribing to each vertex
+  // Each vertex has an owning location that gathers the partition-ids
+  // of all the cells using it, and returns the union.
+  std::map<uint64_t, std::set<uint64_t>> vertex_pids;
+  for (size_t c = 0; c < num_slice_cells; ++c)
+    for (uint64_t vid : raw_cells[c]->vertex_ids)
+      vertex_pids[vid].insert(static_cast<uint64_t>(slice_cell_pids[c]));
+
+  std::map<int, std::vector<uint64_t>> vertex_queries;
+  for (const auto& [vid, pids] : vertex_pids)
+  {
+    auto& data = vertex_queries[VertexOwner(vid)];
+    data.push_back(vid);
+    data.push_back(pids.size());
+    data.insert(data.end(), pids.begin(), pids.end());
+  }
+
+  const auto vertex_queries_received =
+    chi_mpi_utils::MapAllToAll(vertex_queries, MPI_UINT64_T);
+  vertex_queries.clear();
+
+  std::map<uint64_t, std::set<uint64_t>> owned_vertex_pids;
+  for (const auto& [location, data] : vertex_queries_received)
+    for (size_t k = 0; k < data.size(); k += 2 + data[k + 1])
+      owned_vertex_pids[data[k]].insert(
+        data.begin() + static_cast<long>(k + 2),
+        data.begin() + static_cast<long>(k + 2 + data[k + 1]));
+
+  // Replies are in the order of the queries
+  std::map<int, std::vector<uint64_t>> vertex_replies;
+  for (const auto& [location, data] : vertex_queries_received)
+  {
+    auto& reply = vertex_replies[location];
+    for (size_t k = 0; k < data.size(); k += 2 + data[k + 1])
+    {
+      const auto& pids = owned_vertex_pids.at(data[k]);
+      reply.push_back(pids.size());
+      reply.insert(reply.end(), pids.begin(), pids.end());
+    }
+  }
+  owned_vertex_pids.clear();
+
+  const auto vertex_replies_received =
+    chi_mpi_utils::MapAllToAll(vertex_replies, MPI_UINT64_T);
+  vertex_replies.clear();
+
+  {
+    std::map<int, size_t> reply_offsets;
+    for (auto& [vid, pids] : vertex_pids)
+    {
+      const int owner = VertexOwner(vid);
+      const auto& reply = vertex_replies_received.at(owner);
+      size_t& k = reply_offsets[owner];
+      const size_t num_pids = reply[k];
+      pids.insert(reply.begin() + static_cast<long>(k + 1),
+                  reply.begin() + static_cast<long>(k + 1 + num_pids));
+      k += 1 + num_pids;
+    }
+  }
+
+  //======================================== Serialize cells
+  // [global_id, partition_id, type, sub_type, material_id,
+  //  num_verts, vids..., num_faces,
+  //  {has_neighbor, neighbor, num_face_verts, face vids...}...]
+  std::map<int, std::vector<uint64_t>> cell_data_to_send;
+  std::map<int, std::set<uint64_t>> vids_to_send;
+  for (size_t c = 0; c < num_slice_cells; ++c)
+  {
+    const auto& raw_cell = *raw_cells[c];
+    const auto pid = static_cast<uint64_t>(slice_cell_pids[c]);
+
+    std::set<uint64_t> destinations = {pid};
+    for (uint64_t vid : raw_cell.vertex_ids)
+    {
+      const auto& pids = vertex_pids.at(vid);
+      destinations.insert(pids.begin(), pids.end());
+    }
+
+    for (uint64_t dest : destinations)
+    {
+      const auto location = static_cast<int>(dest);
+      auto& data = cell_data_to_send[location];
+      data.push_back(first_gid + c);
+      data.push_back(pid);
+      data.push_back(static_cast<uint64_t>(raw_cell.type));
+      data.push_back(static_cast<uint64_t>(raw_cell.sub_type));
+      data.push_back(static_cast<uint64_t>(
+                       static_cast<int64_t>(raw_cell.material_id)));
+      data.push_back(raw_cell.vertex_ids.size());
+      data.insert(data.end(), raw_cell.vertex_ids.begin(),
+                              raw_cell.vertex_ids.end());
+      data.push_back(raw_cell.faces.size());
+      for (const auto& face : raw_cell.faces)
+      {
+        data.push_back(face.has_neighbor ? 1 : 0);
+        data.push_back(face.neighbor);
+        data.push_back(face.vertex_ids.size());
+        data.insert(data.end(), face.vertex_ids.begin(),
+                                face.vertex_ids.end());
+      }
+
+      auto& dest_vids = vids_to_send[location];
+      dest_vids.insert(raw_cell.vertex_ids.begin(),
+                       raw_cell.vertex_ids.end());
+    }
+  }//for slice cell
+  vertex_pids.clear();
+
+  std::map<int, std::vector<uint64_t>> vertex_ids_to_send;
+  std::map<int, std::vector<double>> vertex_coords_to_send;
+  for (const auto& [location, vids] : vids_to_send)
+  {
+    auto& ids = vertex_ids_to_send[location];
+    auto& coords = vertex_coords_to_send[location];
+    ids.assign(vids.begin(), vids.end());
+    coords.reserve(3 * vids.size());
+    for (uint64_t vid : vids)
+    {
+      const auto& vertex = slice_vertices.at(vid);
+      coords.insert(coords.end(), {vertex.x, vertex.y, vertex.z});
+    }
+  }
+  vids_to_send.clear();
+
+  //======================================== Exchange
+  const auto cell_data_received =
+    chi_mpi_utils::MapAllToAll(cell_data_to_send, MPI_UINT64_T);
+  cell_data_to_send.clear();
+  const auto vertex_ids_received =
+    chi_mpi_utils::MapAllToAll(vertex_ids_to_send, MPI_UINT64_T);
+  vertex_ids_to_send.clear();
+  const auto vertex_coords_received =
+    chi_mpi_utils::MapAllToAll(vertex_coords_to_send, MPI_DOUBLE);
+  vertex_coords_to_send.clear();
+
+  //======================================== Deserialize vertices
+  std::map<uint64_t, chi_mesh::Vector3> vertices;
+  for (const auto& [location, ids] : vertex_ids_received)
+  {
+    const auto& coords = vertex_coords_received.at(location);
+    for (size_t v = 0; v < ids.size(); ++v)
+      vertices[ids[v]] = chi_mesh::Vector3(coords[3 * v],
+                                           coords[3 * v + 1],
+                                           coords[3 * v + 2]);
+  }
+
+  //======================================== Deserialize cells
+  // Cells are added in global-id order, as in the replicated case.
+  typedef chi_mesh::UnpartitionedMesh::LightWeightCell LWCell;
+  std::map<uint64_t, std::unique_ptr<chi_mesh::Cell>> received_cells;
+  for (const auto& [location, data] : cell_data_received)
+  {
+    size_t k = 0;
+    while (k < data.size())
+    {
+      const uint64_t global_id = data[k++];
+      const uint64_t partition_id = data[k++];
+      const auto type = static_cast<chi_mesh::CellType>(data[k++]);
+      const auto sub_type = static_cast<chi_mesh::CellType>(data[k++]);
+
+      LWCell raw_cell(type, sub_type);
+      raw_cell.material_id = static_cast<int>(
+        static_cast<int64_t>(data[k++]));
+
+      const size_t num_verts = data[k++];
+      raw_cell.vertex_ids.assign(
+        data.begin() + static_cast<long>(k),
+        data.begin() + static_cast<long>(k + num_verts));
+      k += num_verts;
+
+      const size_t num_faces = data[k++];
+      raw_cell.faces.resize(num_faces);
+      for (auto& face : raw_cell.faces)
+      {
+        face.has_neighbor = data[k++] == 1;
+        face.neighbor = data[k++];
+        const size_t num_face_verts = data[k++];
+        face.vertex_ids.assign(
+          data.begin() + static_cast<long>(k),
+          data.begin() + static_cast<long>(k + num_face_verts));
+        k += num_face_verts;
+      }
+
+      raw_cell.centroid = chi_mesh::Vertex(0.0, 0.0, 0.0);
+      for (uint64_t vid : raw_cell.vertex_ids)
+        raw_cell.centroid += vertices.at(vid);
+      raw_cell.centroid =
+        raw_cell.centroid / static_cast<double>(raw_cell.vertex_ids.size());
+
+      received_cells[global_id] =
+        MakeCell(raw_cell, global_id, partition_id, vertices);
+    }
+  }
+
+  for (auto& [global_id, cell] : received_cells)
+  {
+    for (uint64_t vid : cell->vertex_ids_)
+      grid.vertices.Insert(vid, vertices.at(vid));
+
+    grid.cells.push_back(std::move(cell));
+  }
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Distributed cells migrated.";
+}
@@ -60,29 +60,39 @@ void chi_mesh::VolumeMesherPredefinedUnpartitioned::Execute()
 
   if (options.partition_type == PartitionType::KBA_STYLE_XYZ)
     cell_pids = KBA(*umesh_ptr_);
+  else if (options.partition_type == PartitionType::SFC_HILBERT)
+    cell_pids = SFC(*umesh_ptr_, /*hilbert=*/true);
+  else if (options.partition_type == PartitionType::SFC_MORTON)
+    cell_pids = SFC(*umesh_ptr_, /*hilbert=*/false);
   else
     cell_pids = PARMETIS(*umesh_ptr_);
 
   //======================================== Load up the cells
-  auto& vertex_subs = umesh_ptr_->GetVertextCellSubscriptions();
-  size_t cell_globl_id = 0;
-  for (auto raw_cell : umesh_ptr_->GetRawCells())
+  if (umesh_ptr_->IsDistributed())
+    LoadDistributedCells(*umesh_ptr_, cell_pids, *grid);
+  else
   {
-    if (CellHasLocalScope(*raw_cell, cell_globl_id, vertex_subs, cell_pids))
+    auto& vertex_subs = umesh_ptr_->GetVertextCellSubscriptions();
+    size_t cell_globl_id = 0;
+    for (auto raw_cell : umesh_ptr_->GetRawCells())
     {
-      auto cell = MakeCell(*raw_cell, cell_globl_id,
-                           cell_pids[cell_globl_id], umesh_ptr_->GetVertices());
+      if (CellHasLocalScope(*raw_cell, cell_globl_id, vertex_subs, cell_pids))
+      {
+        auto cell = MakeCell(*raw_cell, cell_globl_id,
+                             cell_pids[cell_globl_id],
+                             umesh_ptr_->GetVertices());
 
-      for (uint64_t vid : cell->vertex_ids_)
-        grid->vertices.Insert(vid, umesh_ptr_->GetVertices()[vid]);
+        for (uint64_t vid : cell->vertex_ids_)
+          grid->vertices.Insert(vid, umesh_ptr_->GetVertices()[vid]);
 
-      grid->cells.push_back(std::move(cell));
-    }
+        grid->cells.push_back(std::move(cell));
+      }
 
-    ++cell_globl_id;
-  }//for raw_cell
+      ++cell_globl_id;
+    }//for raw_cell
+  }
 
-  grid->SetGlobalVertexCount(umesh_ptr_->GetVertices().size());
+  grid->SetGlobalVertexCount(umesh_ptr_->GetGlobalNumberOfVertices());
 
   Chi::log.Log() << "Cells loaded.";
   Chi::mpi.Barrier();
@@ -12,7 +12,8 @@
 
 
 //###################################################################
-/** Applies KBA-style partitioning to the mesh.*/
+/** Applies KBA-style partitioning to the mesh. For distributed meshes
+ * the returned partition-ids only cover the local slice of cells.*/
 std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
   KBA(const chi_mesh::UnpartitionedMesh& umesh)
 {
@@ -41,6 +42,19 @@ std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
     return nzi*Px*Py + nyi*Px + nxi;
   };
 
+  //======================================== Distributed meshes only
+  //                                         partition the local slice
+  if (umesh.IsDistributed())
+  {
+    std::vector<int64_t> slice_cell_pids;
+    slice_cell_pids.reserve(num_raw_cells);
+    for (auto& raw_cell : umesh.GetRawCells())
+      slice_cell_pids.push_back(GetPIDFromCentroid(raw_cell->centroid));
+
+    Chi::log.Log() << "Done partitioning mesh.";
+    return slice_cell_pids;
+  }
+
   //======================================== Determine cell partition-IDs
   //                                         only on home location
   std::vector<int64_t> cell_pids(num_raw_cells, 0);
@@ -7,111 +7,168 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 
+#include "utils/chi_timer.h"
 
 #include "petsc.h"
 
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+
 //###################################################################
-/** Applies KBA-style partitioning to the mesh.*/
-std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
-  PARMETIS(const UnpartitionedMesh &umesh)
+/**Builds the dual graph rows of the raw cells [c0,c1) and partitions the
+ * graph, of which these rows are the local part, with ParMETIS over the
+ * locations of `comm`. Returns the partition-id of each row.*/
+std::vector<int64_t>
+  PartitionDualGraph(const chi_mesh::UnpartitionedMesh& umesh,
+                     uint64_t c0, uint64_t c1,
+                     bool use_weights, MPI_Comm comm)
 {
-  Chi::log.Log() << "Partitioning mesh with ParMETIS.";
-
-  //================================================== Determine avg num faces
-  //                                                   per cell
-  const size_t num_raw_cells = umesh.GetNumberOfCells();
-  size_t num_raw_faces = 0;
-  for (auto& cell : umesh.GetRawCells())
-    num_raw_faces += cell->faces.size();
-  size_t avg_num_face_per_cell =
-    std::ceil(static_cast<double>(num_raw_faces)/
-              static_cast<double>(num_raw_cells));
-
-  //================================================== Start building indices
-  std::vector<int64_t> cell_pids(num_raw_cells, 0);
-  if (Chi::mpi.location_id == 0)
+  typedef chi_mesh::VolumeMesherPredefinedUnpartitioned VMPU;
+
+  const auto& raw_cells = umesh.GetRawCells();
+  const uint64_t num_globl_cells = umesh.GetGlobalNumberOfCells();
+  const size_t num_rows = c1 - c0;
+
+  //================================================== Build indices
+  size_t num_edges = 0;
+  for (uint64_t c = c0; c < c1; ++c)
+    for (const auto& face : raw_cells[c]->faces)
+      if (face.has_neighbor) ++num_edges;
+
+  int64_t* i_indices_raw;
+  int64_t* j_indices_raw;
+  int64_t* edge_weights_raw = nullptr;
+  PetscMalloc((num_rows+1)*sizeof(int64_t),&i_indices_raw);
+  PetscMalloc(std::max<size_t>(num_edges,1)*sizeof(int64_t),&j_indices_raw);
+  if (use_weights)
+    PetscMalloc(std::max<size_t>(num_edges,1)*sizeof(int64_t),
+                &edge_weights_raw);
+
+  int64_t icount = 0;
+  size_t i = 0;
+  for (uint64_t c = c0; c < c1; ++c)
   {
-    if (num_raw_cells > 1)
-    {
-      //======================================== Build indices
-      std::vector<int64_t> i_indices(num_raw_cells+1,0);
-      std::vector<int64_t> j_indices;
-      j_indices.reserve(num_raw_cells * avg_num_face_per_cell);
+    i_indices_raw[i++] = icount;
+    for (const auto& face : raw_cells[c]->faces)
+      if (face.has_neighbor)
       {
-        int64_t i=0;
-        int64_t icount = 0;
-        for (auto cell : umesh.GetRawCells())
-        {
-          i_indices[i] = icount;
-
-          for (auto& face : cell->faces)
-            if (face.has_neighbor)
-            {
-              j_indices.push_back(static_cast<int64_t>(face.neighbor));
-              ++icount;
-            }
-          ++i;
-        }
-        i_indices[i] = icount;
+        if (use_weights)
+          edge_weights_raw[icount] = VMPU::FacePartitionWeight(face);
+        j_indices_raw[icount++] = static_cast<int64_t>(face.neighbor);
       }
+  }
+  i_indices_raw[i] = icount;
+
+  Chi::log.Log0Verbose1() << "Done building indices.";
+
+  //================================================== Create adjacency matrix
+  Mat Adj;
+  MatCreateMPIAdj(comm,
+                  static_cast<int64_t>(num_rows),
+                  static_cast<int64_t>(num_globl_cells),
+                  i_indices_raw, j_indices_raw, edge_weights_raw, &Adj);
+
+  Chi::log.Log0Verbose1() << "Done creating adjacency matrix.";
+
+  //================================================== Create partitioning
+  MatPartitioning part;
+  IS is;
+  MatPartitioningCreate(comm,&part);
+  MatPartitioningSetAdjacency(part,Adj);
+  MatPartitioningSetType(part,"parmetis");
+  MatPartitioningSetNParts(part, Chi::mpi.process_count);
+  if (use_weights)
+  {
+    int64_t* vertex_weights_raw;
+    PetscMalloc(std::max<size_t>(num_rows,1)*sizeof(int64_t),
+                &vertex_weights_raw);
+    for (uint64_t c = c0; c < c1; ++c)
+      vertex_weights_raw[c - c0] = VMPU::CellPartitionWeight(*raw_cells[c]);
+    MatPartitioningSetVertexWeights(part, vertex_weights_raw);
+  }
+  MatPartitioningApply(part,&is);
+  MatPartitioningDestroy(&part);
+  MatDestroy(&Adj);
+
+  //================================================== Get partition-ids
+  std::vector<int64_t> row_pids(num_rows, 0);
+  const int64_t* cell_pids_raw;
+  ISGetIndices(is,&cell_pids_raw);
+  for (size_t r=0; r<num_rows; ++r)
+    row_pids[r] = cell_pids_raw[r];
+  ISRestoreIndices(is,&cell_pids_raw);
+  ISDestroy(&is);
+
+  return row_pids;
+}
+
+}//namespace
+
+//###################################################################
+/** Applies ParMETIS partitioning to the mesh. A replicated mesh is
+ * partitioned on location 0 and the result is broadcast, unless the
+ * volume mesher's `parallel_partitioning` option is set. Distributed
+ * meshes, and replicated meshes with `parallel_partitioning`, distribute
+ * the dual graph by slices over all locations (see GetPartitioningSlice)
+ * and execute ParMETIS in parallel on PETSC_COMM_WORLD. When the volume
+ * mesher's `partition_weights` option is set, cells are weighted with
+ * their estimated sweep work and edges with their face communication
+ * volume.*/
+std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  PARMETIS(const UnpartitionedMesh &umesh)
+{
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Partitioning mesh with ParMETIS.";
 
-      Chi::log.Log0Verbose1() << "Done building indices.";
-
-      //======================================== Copy to raw arrays
-      int64_t* i_indices_raw;
-      int64_t* j_indices_raw;
-      PetscMalloc(i_indices.size()*sizeof(int64_t),&i_indices_raw);
-      PetscMalloc(j_indices.size()*sizeof(int64_t),&j_indices_raw);
-
-      for (int64_t j=0; j<static_cast<int64_t>(i_indices.size()); ++j)
-        i_indices_raw[j] = i_indices[j];
-
-      for (int64_t j=0; j<static_cast<int64_t>(j_indices.size()); ++j)
-        j_indices_raw[j] = j_indices[j];
-
-      Chi::log.Log0Verbose1() << "Done copying to raw indices.";
-
-      //========================================= Create adjacency matrix
-      Mat Adj; //Adjacency matrix
-      MatCreateMPIAdj(PETSC_COMM_SELF,
-                      (int64_t)num_raw_cells,
-                      (int64_t)num_raw_cells,
-                      i_indices_raw, j_indices_raw, nullptr, &Adj);
-
-      Chi::log.Log0Verbose1() << "Done creating adjacency matrix.";
-
-      //========================================= Create partitioning
-      MatPartitioning part;
-      IS is,isg;
-      MatPartitioningCreate(MPI_COMM_SELF,&part);
-      MatPartitioningSetAdjacency(part,Adj);
-      MatPartitioningSetType(part,"parmetis");
-      MatPartitioningSetNParts(part, Chi::mpi.process_count);
-      MatPartitioningApply(part,&is);
-      MatPartitioningDestroy(&part);
-      MatDestroy(&Adj);
-      ISPartitioningToNumbering(is,&isg);
-      Chi::log.Log0Verbose1() << "Done building paritioned index set.";
-
-      //========================================= Get cell global indices
-      const int64_t* cell_pids_raw;
-      ISGetIndices(is,&cell_pids_raw);
-      for (size_t i=0; i<num_raw_cells; ++i)
-        cell_pids[i] = cell_pids_raw[i];
-      ISRestoreIndices(is,&cell_pids_raw);
-
-      Chi::log.Log0Verbose1() << "Done retrieving cell global indices.";
-    }//if more than 1 cell
-  }//if home location
-
-  //======================================== Broadcast partitioning to all
-  //                                         locations
-  MPI_Bcast(cell_pids.data(),                 //buffer [IN/OUT]
-            static_cast<int>(num_raw_cells),  //count
-            MPI_LONG_LONG_INT,                //data type
-            0,                                //root
-            Chi::mpi.comm);                  //communicator
-  Chi::log.Log() << "Done partitioning mesh.";
-
-  return cell_pids;
-}
\ No newline at end of file
+  const auto& mesher = chi_mesh::GetCurrentHandler().GetVolumeMesher();
+  const bool use_weights = mesher.options.partition_weights;
+
+  const uint64_t num_globl_cells = umesh.GetGlobalNumberOfCells();
+  const int num_locations = Chi::mpi.process_count;
+
+  //================================================== Serial partitioning
+  //                                                   of replicated meshes
+  if (not umesh.IsDistributed() and
+      not mesher.options.parallel_partitioning)
+  {
+    std::vector<int64_t> cell_pids(num_globl_cells, 0);
+    if (Chi::mpi.location_id == 0 and num_globl_cells > 1)
+      cell_pids = PartitionDualGraph(umesh, 0, num_globl_cells,
+                                     use_weights, PETSC_COMM_SELF);
+
+    MPI_Bcast(cell_pids.data(),                   //buffer [IN/OUT]
+              static_cast<int>(num_globl_cells),  //count
+              MPI_LONG_LONG_INT,                  //data type
+              0,                                  //root
+              Chi::mpi.comm);                     //communicator
+
+    Chi::log.Log() << Chi::program_timer.GetTimeString()
+                   << " Done partitioning mesh.";
+    return cell_pids;
+  }
+
+  //================================================== Parallel partitioning
+  const auto [c0, c1] = GetPartitioningSlice(umesh);
+  const size_t num_slice_cells = c1 - c0;
+  const uint64_t slice_first_gid = umesh.IsDistributed() ?
+                                   umesh.GetSliceFirstCellID() : c0;
+
+  std::vector<int64_t> slice_cell_pids(num_slice_cells, 0);
+
+  // ParMETIS cannot handle more parts than vertices
+  if (num_globl_cells <= static_cast<uint64_t>(num_locations))
+    for (size_t c = 0; c < num_slice_cells; ++c)
+      slice_cell_pids[c] = static_cast<int64_t>(
+        (slice_first_gid + c) * num_locations / num_globl_cells);
+  else
+    slice_cell_pids = PartitionDualGraph(umesh, c0, c1,
+                                         use_weights, PETSC_COMM_WORLD);
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Done partitioning mesh.";
+
+  return GatherPartitionIDs(umesh, slice_cell_pids);
+}
@@ -0,0 +1,51 @@
+#include "volmesher_predefunpart.h"
+
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/chi_mesh_sfc.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "utils/chi_timer.h"
+
+//###################################################################
+/** Partitions the mesh along a Hilbert (or Morton) space-filling curve
+ * through the cell centroids (see chi_mesh::sfc::PartitionPoints). Each
+ * location only supplies its slice of cells (see GetPartitioningSlice).
+ * Cell weights are the estimated sweep work when the volume mesher's
+ * `partition_weights` option is set, otherwise unity.*/
+std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  SFC(const UnpartitionedMesh &umesh, bool hilbert)
+{
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Partitioning mesh with "
+                 << (hilbert ? "Hilbert" : "Morton")
+                 << " space-filling curve.";
+
+  const auto& mesher = chi_mesh::GetCurrentHandler().GetVolumeMesher();
+  const bool use_weights = mesher.options.partition_weights;
+
+  const auto& raw_cells = umesh.GetRawCells();
+
+  const auto [c0, c1] = GetPartitioningSlice(umesh);
+  const size_t num_slice_cells = c1 - c0;
+
+  std::vector<chi_mesh::Vector3> centroids(num_slice_cells);
+  std::vector<double> weights(num_slice_cells, 1.0);
+  for (uint64_t c = c0; c < c1; ++c)
+  {
+    centroids[c - c0] = raw_cells[c]->centroid;
+    if (use_weights)
+      weights[c - c0] =
+        static_cast<double>(CellPartitionWeight(*raw_cells[c]));
+  }
+
+  const auto slice_cell_pids =
+    sfc::PartitionPoints(centroids, weights, hilbert);
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Done partitioning mesh.";
+
+  return GatherPartitionIDs(umesh, slice_cell_pids);
+}
@@ -34,4 +34,82 @@ bool chi_mesh::VolumeMesherPredefinedUnpartitioned::
     }
 
   return false;
-}
\ No newline at end of file
+}
+//###################################################################
+/**Returns the range [first,last) of the umesh raw cells for which this
+ * location computes partition-ids. For a distributed mesh this is the
+ * entire local slice, whereas for a replicated mesh the global cell list
+ * is split evenly over all locations so that the partitioners always
+ * execute in parallel.*/
+std::pair<uint64_t, uint64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  GetPartitioningSlice(const UnpartitionedMesh &umesh)
+{
+  if (umesh.IsDistributed())
+    return {0, umesh.GetNumberOfCells()};
+
+  return UnpartitionedMesh::GetSliceBounds(umesh.GetNumberOfCells(),
+                                           Chi::mpi.location_id,
+                                           Chi::mpi.process_count);
+}
+
+//###################################################################
+/**Converts the partition-ids computed for the slice returned by
+ * GetPartitioningSlice into the list expected by the cell loaders, i.e.,
+ * the slice itself for distributed meshes and the partition-ids of all
+ * cells for replicated meshes.*/
+std::vector<int64_t> chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  GatherPartitionIDs(const UnpartitionedMesh &umesh,
+                     const std::vector<int64_t>& slice_cell_pids)
+{
+  if (umesh.IsDistributed()) return slice_cell_pids;
+
+  const int num_locations = Chi::mpi.process_count;
+  const uint64_t num_cells = umesh.GetNumberOfCells();
+
+  std::vector<int> recv_counts(num_locations, 0);
+  std::vector<int> recv_displs(num_locations, 0);
+  for (int loc = 0; loc < num_locations; ++loc)
+  {
+    const auto [c0, c1] =
+      UnpartitionedMesh::GetSliceBounds(num_cells, loc, num_locations);
+    recv_counts[loc] = static_cast<int>(c1 - c0);
+    recv_displs[loc] = static_cast<int>(c0);
+  }
+
+  std::vector<int64_t> cell_pids(num_cells, 0);
+  MPI_Allgatherv(slice_cell_pids.data(),                  // sendbuf
+                 static_cast<int>(slice_cell_pids.size()),// sendcount
+                 MPI_INT64_T,                             // sendtype
+                 cell_pids.data(),                        // recvbuf
+                 recv_counts.data(),                      // recvcounts
+                 recv_displs.data(),                      // displs
+                 MPI_INT64_T,                             // recvtype
+                 Chi::mpi.comm);                          // comm
+
+  return cell_pids;
+}
+
+//###################################################################
+/**Estimated relative sweep work of a cell, used as a partitioning vertex
+ * weight. The local transport system of a cell is dense in its nodes,
+ * hence the work is taken proportional to the square of the number of
+ * vertices.*/
+int64_t chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  CellPartitionWeight(
+    const chi_mesh::UnpartitionedMesh::LightWeightCell& raw_cell)
+{
+  const auto num_verts = static_cast<int64_t>(raw_cell.vertex_ids.size());
+  return std::max<int64_t>(1, num_verts * num_verts);
+}
+
+//###################################################################
+/**Estimated relative communication volume across a face, used as a
+ * partitioning edge weight. Upwind data is exchanged per face node,
+ * hence the number of face vertices.*/
+int64_t chi_mesh::VolumeMesherPredefinedUnpartitioned::
+  FacePartitionWeight(
+    const chi_mesh::UnpartitionedMesh::LightWeightFace& raw_face)
+{
+  return std::max<int64_t>(1,
+                           static_cast<int64_t>(raw_face.vertex_ids.size()));
+}
@@ -14,7 +14,9 @@ namespace chi_mesh
   enum class VolumeMesherType
   {
     EXTRUDER      = 4,
-    UNPARTITIONED = 6
+    UNPARTITIONED = 6,
+    ORTHOGONAL    = 7,
+    BINARY        = 8
   };
   enum VolumeMesherProperty
   {
@@ -31,7 +33,10 @@ namespace chi_mesh
     MATID_FROMLOGICAL         = 11,
     BNDRYID_FROMLOGICAL       = 12,
     MATID_FROM_LUA_FUNCTION   = 13,
-    BNDRYID_FROM_LUA_FUNCTION = 14
+    BNDRYID_FROM_LUA_FUNCTION = 14,
+    PARTITION_WEIGHTS         = 15,
+    LOCAL_CELL_ORDERING       = 16,
+    PARALLEL_PARTITIONING     = 17
   };
 }
 
@@ -46,7 +51,15 @@ public:
   enum PartitionType
   {
     KBA_STYLE_XYZ = 2,
-    PARMETIS      = 3
+    PARMETIS      = 3,
+    SFC_HILBERT   = 4,
+    SFC_MORTON    = 5
+  };
+  enum LocalCellOrdering
+  {
+    LOCAL_ORDERING_NONE    = 0,
+    LOCAL_ORDERING_RCM     = 1,
+    LOCAL_ORDERING_HILBERT = 2
   };
   struct VOLUME_MESHER_OPTIONS
   {
@@ -60,6 +73,9 @@ public:
     std::vector<double> ycuts;
     std::vector<double> zcuts;
     PartitionType partition_type = PARMETIS;
+    bool         partition_weights = false;
+    bool         parallel_partitioning = false;
+    LocalCellOrdering local_cell_ordering = LOCAL_ORDERING_NONE;
   };
   VOLUME_MESHER_OPTIONS options;
 public:
@@ -72,6 +88,9 @@ public:
   void SetGridAttributes(MeshAttributes new_attribs,
                          std::array<size_t,3> ortho_Nis={0,0,0});
   VolumeMesherType Type() const;
+private:
+  void ApplyLocalCellOrdering();
+public:
 
   //01a
   static
@@ -188,7 +188,8 @@ GetCellXYZPartitionID(chi_mesh::Cell *cell)
       zmin = zmax;
     }
   }//if typeid
-  else if (vol_mesher.Type() == VolumeMesherType::UNPARTITIONED)
+  else if (vol_mesher.Type() == VolumeMesherType::UNPARTITIONED or
+           vol_mesher.Type() == VolumeMesherType::ORTHOGONAL)
   {
     if (vol_mesher.options.zcuts.empty())
     {
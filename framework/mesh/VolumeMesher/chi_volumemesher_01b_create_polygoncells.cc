@@ -13,6 +13,9 @@ void chi_mesh::VolumeMesher::
 CreatePolygonCells(const chi_mesh::UnpartitionedMesh& umesh,
                    chi_mesh::MeshContinuumPtr& grid)
 {
+  ChiInvalidArgumentIf(umesh.IsDistributed(),
+                       "Template meshes cannot be read in distributed mode.");
+
   //=================================== Copy nodes
   {
     uint64_t id = 0;
@@ -43,6 +43,7 @@ void chi_mesh::VolumeMesher::
     if (log_vol.Inside(cell.centroid_) && sense)
       cell.material_id_ = mat_id;
   }
+  vol_cont->InvalidateTopology();
 
   int global_num_cells_modified;
   MPI_Allreduce(&num_cells_modified,        //sendbuf
@@ -129,6 +130,7 @@ void chi_mesh::VolumeMesher::SetMatIDToAll(int mat_id)
   const auto& ghost_ids = vol_cont->cells.GetGhostGlobalIDs();
   for (uint64_t ghost_id : ghost_ids)
     vol_cont->cells[ghost_id].material_id_ = mat_id;
+  vol_cont->InvalidateTopology();
 
   Chi::mpi.Barrier();
   Chi::log.Log()
@@ -226,6 +228,7 @@ void chi_mesh::VolumeMesher::
       ++local_num_cells_modified;
     }
   }//for ghost cell id
+  grid.InvalidateTopology();
 
   int globl_num_cells_modified;
   MPI_Allreduce(&local_num_cells_modified, //sendbuf
@@ -357,6 +360,7 @@ void chi_mesh::VolumeMesher::
         }
       }//for bndry face
   }//for ghost cell id
+  grid.InvalidateTopology();
 
   int globl_num_faces_modified;
   MPI_Allreduce(&local_num_faces_modified, //sendbuf
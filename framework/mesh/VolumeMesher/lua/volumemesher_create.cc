@@ -1,6 +1,7 @@
 #include "chi_lua.h"
 #include "mesh/VolumeMesher/Extruder/volmesher_extruder.h"
 #include "mesh/VolumeMesher/PredefinedUnpartitioned/volmesher_predefunpart.h"
+#include "mesh/VolumeMesher/Binary/volmesher_binary.h"
 
 #include "mesh/MeshHandler/chi_meshhandler.h"
 #include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
@@ -15,6 +16,7 @@
 RegisterLuaFunctionAsIs(chiVolumeMesherCreate);
 RegisterLuaConstantAsIs(VOLUMEMESHER_EXTRUDER, chi_data_types::Varying(4));
 RegisterLuaConstantAsIs(VOLUMEMESHER_UNPARTITIONED, chi_data_types::Varying(6));
+RegisterLuaConstantAsIs(VOLUMEMESHER_BINARY, chi_data_types::Varying(8));
 
 RegisterLuaConstant(ExtruderTemplateType,
                     SURFACE_MESH,
@@ -35,6 +37,10 @@ Remesher types:\n
  VOLUMEMESHER_UNPARTITIONED = Create the mesh from the latest UnpartitionedMesh.
  Requires a single additional argument, `handle`, which is a handle to
  a valid unpartitioned mesh.\n
+ VOLUMEMESHER_BINARY = Loads a mesh previously exported with
+ chiMeshHandlerExportMeshToBinary. Requires a single additional argument,
+ the base name of the files, and the same number of processes as was used
+ to export the mesh.\n
 
 ##_
 
@@ -122,12 +128,29 @@ int chiVolumeMesherCreate(lua_State* L)
     new_mesher =
       std::make_shared<chi_mesh::VolumeMesherPredefinedUnpartitioned>(p_umesh);
   }
+  else if (mesher_type == chi_mesh::VolumeMesherType::BINARY)
+  {
+    if (num_args != 2)
+    {
+      Chi::log.LogAllError()
+        << fname + ": "
+                   "When specifying VOLUMEMESHER_BINARY, the "
+                   "file base name must also be supplied.";
+      Chi::Exit(EXIT_FAILURE);
+    }
+
+    LuaCheckStringValue(fname, L, 2);
+    const std::string file_base_name = lua_tostring(L, 2);
+
+    new_mesher = std::make_shared<chi_mesh::VolumeMesherBinary>(file_base_name);
+  }
   else
   {
     Chi::log.Log0Error() << "Invalid Volume mesher type in function "
                             "chiVolumeMesherCreate. Allowed options are"
-                            "VOLUMEMESHER_EXTRUDER or "
-                            "VOLUMEMESHER_UNPARTITIONED";
+                            "VOLUMEMESHER_EXTRUDER, "
+                            "VOLUMEMESHER_UNPARTITIONED or "
+                            "VOLUMEMESHER_BINARY";
     Chi::Exit(EXIT_FAILURE);
   }
 
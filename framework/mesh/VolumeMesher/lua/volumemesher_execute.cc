@@ -2,11 +2,13 @@
 
 #include "mesh/MeshHandler/chi_meshhandler.h"
 #include "mesh/VolumeMesher/chi_volumemesher.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
 
 #include "utils/chi_timer.h"
+#include "utils/chi_perf_region.h"
 
 #include "volumemesher_lua.h"
 #include "console/chi_console.h"
@@ -28,7 +30,11 @@ int chiVolumeMesherExecute(lua_State *L)
   //Get memory before
   chi::CSTMemory mem_before = chi::Console::GetMemoryUsage();
 
-  cur_hndlr.GetVolumeMesher().Execute();
+  {
+    chi::PerfRegion perf_region("Mesh::VolumeMesherExecute");
+    cur_hndlr.GetVolumeMesher().Execute();
+  }
+  cur_hndlr.GetGrid()->RegisterMemoryUsage();
 
   //Get memory usage
   chi::CSTMemory mem_after = chi::Console::GetMemoryUsage();
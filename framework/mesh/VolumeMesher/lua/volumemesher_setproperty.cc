@@ -24,11 +24,19 @@ RegisterLuaConstantAsIs(CUTS_X, chi_data_types::Varying(8));
 RegisterLuaConstantAsIs(PARTITION_TYPE, chi_data_types::Varying(9));
 RegisterLuaConstantAsIs(KBA_STYLE_XYZ, chi_data_types::Varying(2));
 RegisterLuaConstantAsIs(PARMETIS, chi_data_types::Varying(3));
+RegisterLuaConstantAsIs(SFC_HILBERT, chi_data_types::Varying(4));
+RegisterLuaConstantAsIs(SFC_MORTON, chi_data_types::Varying(5));
 RegisterLuaConstantAsIs(EXTRUSION_LAYER, chi_data_types::Varying(10));
 RegisterLuaConstantAsIs(MATID_FROMLOGICAL, chi_data_types::Varying(11));
 RegisterLuaConstantAsIs(BNDRYID_FROMLOGICAL, chi_data_types::Varying(12));
 RegisterLuaConstantAsIs(MATID_FROM_LUA_FUNCTION, chi_data_types::Varying(13));
 RegisterLuaConstantAsIs(BNDRYID_FROM_LUA_FUNCTION, chi_data_types::Varying(14));
+RegisterLuaConstantAsIs(PARTITION_WEIGHTS, chi_data_types::Varying(15));
+RegisterLuaConstantAsIs(LOCAL_CELL_ORDERING, chi_data_types::Varying(16));
+RegisterLuaConstantAsIs(LOCAL_ORDERING_NONE, chi_data_types::Varying(0));
+RegisterLuaConstantAsIs(LOCAL_ORDERING_RCM, chi_data_types::Varying(1));
+RegisterLuaConstantAsIs(LOCAL_ORDERING_HILBERT, chi_data_types::Varying(2));
+RegisterLuaConstantAsIs(PARALLEL_PARTITIONING, chi_data_types::Varying(17));
 
 RegisterLuaFunctionAsIs(chiVolumeMesherSetKBAPartitioningPxPyPz);
 RegisterLuaFunctionAsIs(chiVolumeMesherSetKBACutsX);
@@ -50,6 +58,21 @@ RegisterLuaFunctionAsIs(chiVolumeMesherSetKBACutsZ);
  MESH_GLOBAL = <B>PropertyValue:[bool]</B> Generate/Read the full mesh at each
                location. Expects a boolean value [Default=true].\n
  PARTITION_TYPE = <B>PartitionType</B>. See below.\n
+ PARTITION_WEIGHTS = <B>PropertyValue:[bool]</B> Weights the graph used by
+                     PARMETIS and the curve used by the SFC partitioners with
+                     an estimate of the per-cell sweep work (proportional to
+                     the square of the number of cell vertices) and, for
+                     PARMETIS, the per-face communication volume.
+                     [Default=false].\n
+ PARALLEL_PARTITIONING = <B>PropertyValue:[bool]</B> Runs PARMETIS in parallel
+                         on slices of the graph of a replicated mesh instead
+                         of on location 0. Distributed meshes, and the SFC
+                         partitioners, always partition in parallel. Note
+                         that the parallel partition of a replicated mesh
+                         differs from the serial one. [Default=false].\n
+ LOCAL_CELL_ORDERING = <B>LocalCellOrdering</B>. Renumbers the local cells of
+                       each location after partitioning to improve memory
+                       locality. See below. [Default=LOCAL_ORDERING_NONE].\n
  EXTRUSION_LAYER = <B>PropertyValue:[double,(int),(char)]</B> Adds a layer to
 the extruder volume mesher if it exists. Expects 1 required parameter, the layer
 height, followed by 2 optional parameters: number of subdivisions (defaults to
@@ -100,6 +123,17 @@ is
 Can be any of the following:
  - KBA_STYLE_XYZ
  - PARMETIS
+ - SFC_HILBERT, partitions cells along a Hilbert space-filling curve through
+   the cell centroids. Requires no external library.
+ - SFC_MORTON, same as SFC_HILBERT but with a Morton (Z-order) curve.
+
+### LocalCellOrdering
+Can be any of the following:
+ - LOCAL_ORDERING_NONE, keeps the order in which the mesher created the cells.
+ - LOCAL_ORDERING_RCM, reverse Cuthill-McKee ordering of the local
+   face-neighbor graph.
+ - LOCAL_ORDERING_HILBERT, orders the local cells along a Hilbert curve
+   through their centroids.
 
 \ingroup LuaVolumeMesher
 \author Jan*/
@@ -173,7 +207,7 @@ int chiVolumeMesherSetProperty(lua_State* L)
   {
     int p = lua_tonumber(L, 2);
     if (p >= chi_mesh::VolumeMesher::PartitionType::KBA_STYLE_XYZ and
-        p <= chi_mesh::VolumeMesher::PartitionType::PARMETIS)
+        p <= chi_mesh::VolumeMesher::PartitionType::SFC_MORTON)
       volume_mesher.options.partition_type =
         (chi_mesh::VolumeMesher::PartitionType)p;
     else
@@ -183,6 +217,32 @@ int chiVolumeMesherSetProperty(lua_State* L)
       Chi::Exit(EXIT_FAILURE);
     }
   }
+  else if (property_index == VMP::PARTITION_WEIGHTS)
+  {
+    bool p = lua_toboolean(L, 2);
+    volume_mesher.options.partition_weights = p;
+    Chi::log.LogAllVerbose1() << "Partition weights set to " << p;
+  }
+  else if (property_index == VMP::PARALLEL_PARTITIONING)
+  {
+    bool p = lua_toboolean(L, 2);
+    volume_mesher.options.parallel_partitioning = p;
+    Chi::log.LogAllVerbose1() << "Parallel partitioning set to " << p;
+  }
+  else if (property_index == VMP::LOCAL_CELL_ORDERING)
+  {
+    int p = lua_tonumber(L, 2);
+    if (p >= chi_mesh::VolumeMesher::LOCAL_ORDERING_NONE and
+        p <= chi_mesh::VolumeMesher::LOCAL_ORDERING_HILBERT)
+      volume_mesher.options.local_cell_ordering =
+        (chi_mesh::VolumeMesher::LocalCellOrdering)p;
+    else
+    {
+      Chi::log.LogAllError()
+        << "Unsupported local cell ordering used in call to " << fname << ".";
+      Chi::Exit(EXIT_FAILURE);
+    }
+  }
 
   else if (property_index == VMP::EXTRUSION_LAYER)
   {
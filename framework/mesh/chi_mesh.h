@@ -65,6 +65,8 @@ namespace chi_mesh
   class VolumeMesher;
   class VolumeMesherExtruder;
   class VolumeMesherPredefinedUnpartitioned;
+  class VolumeMesherOrthogonal;
+  class VolumeMesherBinary;
 
   enum MeshAttributes : int
   {
@@ -102,6 +104,8 @@ namespace chi_mesh
   size_t CreateUnpartitioned3DOrthoMesh(std::vector<double>& vertices_1d_x,
                                         std::vector<double>& vertices_1d_y,
                                         std::vector<double>& vertices_1d_z);
+
+  void CreateDistributedOrthoMesh(std::vector<std::vector<double>> node_sets);
 }
 
 #include "chi_meshvector.h"
@@ -0,0 +1,162 @@
+#include "chi_mesh_sfc.h"
+
+#include "chi_runtime.h"
+#include "chi_mpi.h"
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+#include <limits>
+
+//###################################################################
+/**Makes the curve box of the given bounds. Dimensions with zero extent
+ * are dropped, e.g., a 2D mesh is traced with a 2D curve.*/
+chi_mesh::sfc::CurveBox chi_mesh::sfc::
+  MakeCurveBox(const chi_mesh::Vector3& xmin, const chi_mesh::Vector3& xmax)
+{
+  CurveBox box{xmin, xmax, {}};
+  for (int d = 0; d < 3; ++d)
+    if (xmax[d] - xmin[d] > 0.0) box.dims.push_back(d);
+  if (box.dims.empty()) box.dims.push_back(0);
+
+  return box;
+}
+
+//###################################################################
+/**Returns the Hilbert or Morton key of a point. The coordinates are
+ * quantized to SFC_BITS bits over the box's active dimensions.*/
+uint64_t chi_mesh::sfc::ComputePointKey(const CurveBox& box,
+                                        const chi_mesh::Vector3& point,
+                                        bool hilbert)
+{
+  const double max_quantum = static_cast<double>(SFC_MAX_QUANTUM);
+  const int num_dims = box.NumDims();
+
+  std::array<uint64_t, 3> X = {0, 0, 0};
+  for (int i = 0; i < num_dims; ++i)
+  {
+    const int d = box.dims[i];
+    const double extent = box.xmax[d] - box.xmin[d];
+    const double s = extent > 0.0 ? (point[d] - box.xmin[d]) / extent : 0.0;
+    X[i] = static_cast<uint64_t>(std::clamp(s, 0.0, 1.0) * max_quantum);
+  }
+
+  return ComputeKey(X, num_dims, hilbert);
+}
+
+//###################################################################
+/**Partitions a distributed set of weighted points along a Hilbert (or
+ * Morton) space-filling curve. Each location supplies its own points,
+ * after which P-1 weighted splitters are determined by a parallel
+ * bisection on the key range so that no location ever sorts or holds
+ * global data. Returns the partition-id of each local point.
+ * Collective.*/
+std::vector<int64_t> chi_mesh::sfc::
+  PartitionPoints(const std::vector<chi_mesh::Vector3>& points,
+                  const std::vector<double>& weights,
+                  bool hilbert)
+{
+  ChiInvalidArgumentIf(points.size() != weights.size(),
+                       "Number of weights does not match number of points.");
+
+  const int num_locations = Chi::mpi.process_count;
+  const size_t num_points = points.size();
+
+  std::vector<int64_t> pids(num_points, 0);
+  if (num_locations == 1) return pids;
+
+  //================================================== Global bounding box
+  // Maxima are negated so that a single MIN reduction suffices
+  std::array<double, 6> local_bounds, globl_bounds;
+  local_bounds.fill(std::numeric_limits<double>::max());
+  for (const auto& xc : points)
+    for (int d = 0; d < 3; ++d)
+    {
+      local_bounds[d]     = std::min(local_bounds[d], xc[d]);
+      local_bounds[d + 3] = std::min(local_bounds[d + 3], -xc[d]);
+    }
+  MPI_Allreduce(local_bounds.data(),   // sendbuf
+                globl_bounds.data(),   // recvbuf
+                6, MPI_DOUBLE,         // count+datatype
+                MPI_MIN,               // operation
+                Chi::mpi.comm);        // comm
+
+  const auto box = MakeCurveBox(
+    chi_mesh::Vector3(globl_bounds[0], globl_bounds[1], globl_bounds[2]),
+    chi_mesh::Vector3(-globl_bounds[3], -globl_bounds[4], -globl_bounds[5]));
+  const int num_dims = box.NumDims();
+
+  //================================================== Compute keys
+  std::vector<std::pair<uint64_t, double>> keys_weights(num_points);
+  std::vector<uint64_t> keys(num_points, 0);
+  for (size_t c = 0; c < num_points; ++c)
+  {
+    keys[c] = ComputePointKey(box, points[c], hilbert);
+    keys_weights[c] = {keys[c], weights[c]};
+  }
+  std::sort(keys_weights.begin(), keys_weights.end());
+
+  std::vector<double> cumulative_weights(num_points + 1, 0.0);
+  for (size_t k = 0; k < num_points; ++k)
+    cumulative_weights[k + 1] = cumulative_weights[k] +
+                                keys_weights[k].second;
+
+  double globl_weight = 0.0;
+  MPI_Allreduce(&cumulative_weights.back(), // sendbuf
+                &globl_weight,              // recvbuf
+                1, MPI_DOUBLE,              // count+datatype
+                MPI_SUM,                    // operation
+                Chi::mpi.comm);             // comm
+
+  //================================================== Lambda for the local
+  //                                                   weight below a key
+  auto LocalWeightBelow = [&keys_weights, &cumulative_weights](uint64_t s)
+  {
+    const auto it = std::lower_bound(
+      keys_weights.begin(), keys_weights.end(), s,
+      [](const std::pair<uint64_t, double>& kw, uint64_t key)
+      {return kw.first < key;});
+    return cumulative_weights[it - keys_weights.begin()];
+  };
+
+  //================================================== Bisect for splitters
+  // Splitter p is the smallest key s for which the global weight of points
+  // with keys below s reaches p/P of the total weight.
+  const size_t num_splitters = num_locations - 1;
+  const int num_key_bits = SFC_BITS * num_dims;
+  std::vector<uint64_t> lo(num_splitters, 0);
+  std::vector<uint64_t> hi(num_splitters, uint64_t(1) << num_key_bits);
+  std::vector<uint64_t> mid(num_splitters, 0);
+  std::vector<double> local_below(num_splitters, 0.0);
+  std::vector<double> globl_below(num_splitters, 0.0);
+
+  for (int iter = 0; iter <= num_key_bits; ++iter)
+  {
+    for (size_t p = 0; p < num_splitters; ++p)
+    {
+      mid[p] = lo[p] + (hi[p] - lo[p]) / 2;
+      local_below[p] = LocalWeightBelow(mid[p]);
+    }
+
+    MPI_Allreduce(local_below.data(),                // sendbuf
+                  globl_below.data(),                // recvbuf
+                  static_cast<int>(num_splitters),   // count
+                  MPI_DOUBLE,                        // datatype
+                  MPI_SUM,                           // operation
+                  Chi::mpi.comm);                    // comm
+
+    for (size_t p = 0; p < num_splitters; ++p)
+    {
+      const double target = globl_weight *
+                            static_cast<double>(p + 1) / num_locations;
+      if (globl_below[p] >= target) hi[p] = mid[p];
+      else                          lo[p] = mid[p] + 1;
+    }
+  }//for iter
+
+  //================================================== Assign partition-ids
+  for (size_t c = 0; c < num_points; ++c)
+    pids[c] = static_cast<int64_t>(
+      std::upper_bound(hi.begin(), hi.end(), keys[c]) - hi.begin());
+
+  return pids;
+}
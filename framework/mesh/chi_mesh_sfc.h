@@ -0,0 +1,97 @@
+#ifndef CHI_MESH_SFC_H
+#define CHI_MESH_SFC_H
+
+#include "mesh/chi_mesh.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+//###################################################################
+/**Space-filling curve keys, used for partitioning and for ordering
+ * cells.*/
+namespace chi_mesh::sfc
+{
+/**Number of bits per dimension used to quantize coordinates. With three
+ * dimensions this yields 63-bit curve keys.*/
+constexpr int SFC_BITS = 21;
+
+/**Largest quantized coordinate.*/
+constexpr uint64_t SFC_MAX_QUANTUM = (uint64_t(1) << SFC_BITS) - 1;
+
+/**Converts quantized coordinates, in place, to the transposed Hilbert
+ * index (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc.
+ * 707, 2004).*/
+inline void AxesToHilbertTranspose(std::array<uint64_t, 3>& X, int num_dims)
+{
+  const uint64_t M = uint64_t(1) << (SFC_BITS - 1);
+
+  //======================================== Inverse undo
+  for (uint64_t Q = M; Q > 1; Q >>= 1)
+  {
+    const uint64_t P = Q - 1;
+    for (int i = 0; i < num_dims; ++i)
+      if (X[i] & Q) X[0] ^= P;
+      else
+      {
+        const uint64_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+  }
+
+  //======================================== Gray encode
+  for (int i = 1; i < num_dims; ++i) X[i] ^= X[i - 1];
+  uint64_t t = 0;
+  for (uint64_t Q = M; Q > 1; Q >>= 1)
+    if (X[num_dims - 1] & Q) t ^= Q - 1;
+  for (int i = 0; i < num_dims; ++i) X[i] ^= t;
+}
+
+/**Interleaves the bits of the coordinates, most significant first.*/
+inline uint64_t InterleaveBits(const std::array<uint64_t, 3>& X, int num_dims)
+{
+  uint64_t key = 0;
+  for (int b = SFC_BITS - 1; b >= 0; --b)
+    for (int i = 0; i < num_dims; ++i)
+      key = (key << 1) | ((X[i] >> b) & 1);
+  return key;
+}
+
+/**Returns the Hilbert or Morton key of quantized coordinates. In 1D both
+ * curves reduce to the coordinate itself.*/
+inline uint64_t ComputeKey(std::array<uint64_t, 3> X, int num_dims,
+                           bool hilbert)
+{
+  if (hilbert and num_dims > 1) AxesToHilbertTranspose(X, num_dims);
+  return InterleaveBits(X, num_dims);
+}
+
+/**Bounding box of a set of points together with the dimensions of
+ * non-zero extent along which the curve is traced.*/
+struct CurveBox
+{
+  chi_mesh::Vector3 xmin;
+  chi_mesh::Vector3 xmax;
+  std::vector<int> dims; ///< Active dimensions, at least one
+
+  int NumDims() const {return static_cast<int>(dims.size());}
+};
+
+CurveBox MakeCurveBox(const chi_mesh::Vector3& xmin,
+                      const chi_mesh::Vector3& xmax);
+
+uint64_t ComputePointKey(const CurveBox& box,
+                         const chi_mesh::Vector3& point,
+                         bool hilbert);
+
+/**Partitions a distributed set of weighted points along a space-filling
+ * curve such that every location receives roughly the same total weight.
+ * Returns the partition-id of each local point. Collective.*/
+std::vector<int64_t> PartitionPoints(
+  const std::vector<chi_mesh::Vector3>& points,
+  const std::vector<double>& weights,
+  bool hilbert);
+}//namespace chi_mesh::sfc
+
+#endif //CHI_MESH_SFC_H
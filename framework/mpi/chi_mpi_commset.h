@@ -5,47 +5,66 @@
 #include "mesh/chi_mesh.h"
 #include "chi_runtime.h"
 
+#include <vector>
+
 namespace chi
 {
 
 //################################################################### Class def
-/**Simple implementation a communicator set.
+/**Communicator set for neighbor-to-neighbor communication of a mesh.
  * Definitions:
  * P = total amount of processors.
- * locI = process I in [0,P]*/
+ * locI = process I in [0,P]
+ *
+ * All locations share a single distributed graph communicator whose
+ * adjacency is the set of neighboring locations of each location. It is
+ * created without rank reordering, hence the rank of locI on the
+ * communicator is locI itself. Since every location only supplies its
+ * own neighbors, creation does not need any global knowledge of the
+ * connectivity.*/
 class ChiMPICommunicatorSet
 {
 private:
-  /**A list of communicators, size P, contains a communicator for
-   * only communicating with the neighbors of locI.*/
-  std::vector<MPI_Comm>  communicators_;
-  /**A list of groupings, size P, allows mapping of the rank of locJ
-   * relative to the local communicator.*/
-  std::vector<MPI_Group> location_groups_;
-  /**Used to translate ranks.*/
-  MPI_Group              world_group_;
+  /**Distributed graph communicator connecting locI to its neighbors.*/
+  MPI_Comm         communicator_;
+  /**Neighboring locations of this location (excluding itself).*/
+  std::vector<int> neighbor_locations_;
 
 public:
-  ChiMPICommunicatorSet(std::vector<MPI_Comm>&  communicators,
-                        std::vector<MPI_Group>& location_groups,
-                        MPI_Group&               world_group) :
-    communicators_(communicators),
-    location_groups_(location_groups),
-    world_group_(world_group)
+  ChiMPICommunicatorSet(MPI_Comm communicator,
+                        std::vector<int> neighbor_locations) :
+    communicator_(communicator),
+    neighbor_locations_(std::move(neighbor_locations))
   {}
 
-  MPI_Comm LocICommunicator(int locI) const
+  ~ChiMPICommunicatorSet()
   {
-    return communicators_[locI];
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (not finalized and communicator_ != MPI_COMM_NULL)
+      MPI_Comm_free(&communicator_);
   }
 
-  int MapIonJ(int locI, int locJ) const
+  ChiMPICommunicatorSet(const ChiMPICommunicatorSet&) = delete;
+  ChiMPICommunicatorSet& operator=(const ChiMPICommunicatorSet&) = delete;
+
+  /**Returns the communicator on which messages to locI must be posted.
+   * This is the same graph communicator for all locations.*/
+  MPI_Comm LocICommunicator(int /*locI*/) const
   {
-    int group_rank;
-    MPI_Group_translate_ranks(world_group_, 1, &locI,
-                              location_groups_[locJ], &group_rank);
+    return communicator_;
+  }
 
-    return group_rank;
+  /**Returns the rank of locI on the communicator of locJ.*/
+  int MapIonJ(int locI, int /*locJ*/) const
+  {
+    return locI;
+  }
+
+  /**Returns the neighboring locations of this location.*/
+  const std::vector<int>& NeighborLocations() const
+  {
+    return neighbor_locations_;
   }
 };
 }//namespace chi_objects
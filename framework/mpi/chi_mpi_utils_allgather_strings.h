@@ -0,0 +1,70 @@
+#ifndef CHI_MPI_ALLGATHER_STRINGS_H
+#define CHI_MPI_ALLGATHER_STRINGS_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "chi_runtime.h"
+#include "chi_mpi.h"
+
+namespace chi_mpi_utils
+{
+
+/**Gathers the strings of all processes on all processes, in order of
+ * process-id. Duplicates are kept. The strings may not contain the null
+ * character.*/
+inline std::vector<std::string>
+  AllGatherStrings(const std::vector<std::string>& local_strings,
+                   const MPI_Comm communicator=Chi::mpi.comm)
+{
+  int process_count = 1;
+  MPI_Comm_size(communicator, &process_count);
+
+  //============================================= Serialize null-terminated
+  std::string local_buffer;
+  for (const auto& string : local_strings)
+  {
+    local_buffer += string;
+    local_buffer += '\0';
+  }
+
+  //============================================= Gather sizes and strings
+  const int local_size = static_cast<int>(local_buffer.size());
+  std::vector<int> sizes(process_count, 0);
+  MPI_Allgather(&local_size,   //sendbuf
+                1, MPI_INT,    //sendcount + type
+                sizes.data(),  //recvbuf
+                1, MPI_INT,    //recvcount + type
+                communicator); //communicator
+
+  std::vector<int> displacements(process_count, 0);
+  for (int p = 1; p < process_count; ++p)
+    displacements[p] = displacements[p - 1] + sizes[p - 1];
+  const int total_size = displacements.back() + sizes.back();
+
+  std::vector<char> buffer(std::max(total_size, 1));
+  MPI_Allgatherv(local_buffer.data(),   //sendbuf
+                 local_size, MPI_CHAR,  //sendcount + type
+                 buffer.data(),         //recvbuf
+                 sizes.data(),          //recvcounts
+                 displacements.data(),  //displacements
+                 MPI_CHAR,              //recvtype
+                 communicator);         //communicator
+
+  //============================================= Deserialize
+  std::vector<std::string> strings;
+  std::string string;
+  for (int i = 0; i < total_size; ++i)
+  {
+    if (buffer[i] != '\0') { string += buffer[i]; continue; }
+    strings.push_back(string);
+    string.clear();
+  }
+
+  return strings;
+}
+
+}//namespace chi_mpi_utils
+
+#endif //CHI_MPI_ALLGATHER_STRINGS_H
@@ -4,4 +4,8 @@
 
 - *chi_location_id* - (int) Process number for current process
 - *chi_number_of_processes* - (int) Total number of processes
+- *chi_energy_color* - (int) Index of the energy communicator of the current
+  process (see `--energy_comms`). Every energy communicator executes the
+  input, so file output can be restricted to `chi_energy_color == 0`.
+- *chi_number_of_energy_comms* - (int) Number of energy communicators
  * */
\ No newline at end of file
@@ -33,6 +33,18 @@ void MPI_Info::SetProcessCount(int in_process_count)
   process_count_set_ = true;
 }
 
+/**Sets the energy decomposition of the world communicator.*/
+void MPI_Info::SetEnergyDecomposition(MPI_Comm world_communicator,
+                                      MPI_Comm energy_communicator,
+                                      int energy_color,
+                                      int num_energy_colors)
+{
+  world_communicator_ = world_communicator;
+  energy_communicator_ = energy_communicator;
+  energy_color_ = energy_color;
+  num_energy_colors_ = num_energy_colors;
+}
+
 void MPI_Info::Barrier() const
 {
   MPI_Barrier(this->communicator_);
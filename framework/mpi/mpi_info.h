@@ -22,11 +22,25 @@ private:
   bool location_id_set_ = false;
   bool process_count_set_ = false;
 
+  MPI_Comm world_communicator_ = MPI_COMM_WORLD;
+  MPI_Comm energy_communicator_ = MPI_COMM_SELF;
+  int energy_color_ = 0;
+  int num_energy_colors_ = 1;
+
 public:
   const int& location_id = location_id_;     ///< Current process rank.
   const int& process_count = process_count_; ///< Total number of processes.
   const MPI_Comm& comm = communicator_; ///< MPI communicator
 
+  /**Communicator spanning all the energy communicators. Equal to `comm`
+   * unless the processes were split with `--energy_comms`.*/
+  const MPI_Comm& world_comm = world_communicator_;
+  /**Communicator connecting the processes with the same `location_id`
+   * in every energy color. Its rank is the energy color.*/
+  const MPI_Comm& energy_comm = energy_communicator_;
+  const int& energy_color = energy_color_;           ///< Color of `comm`
+  const int& num_energy_colors = num_energy_colors_; ///< Number of colors
+
 private:
   MPI_Info() = default;
 
@@ -44,6 +58,11 @@ protected:
   void SetLocationID(int in_location_id);
   /**Sets the number of processes in the communicator.*/
   void SetProcessCount(int in_process_count);
+  /**Sets the energy decomposition of the world communicator.*/
+  void SetEnergyDecomposition(MPI_Comm world_communicator,
+                              MPI_Comm energy_communicator,
+                              int energy_color,
+                              int num_energy_colors);
 
 public:
   /**Calls the generic `MPI_Barrier` with the current communicator.*/
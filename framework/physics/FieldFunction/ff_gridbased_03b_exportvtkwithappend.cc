@@ -2,6 +2,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 #include "mesh/MeshContinuum/chi_meshcontinuum.h"
 #include "mesh/MeshContinuum/chi_grid_vtk_utils.h"
@@ -19,6 +20,8 @@ void chi_physics::FieldFunctionGridBased::
     const std::string &file_base_name,
     const std::vector<std::shared_ptr<const FieldFunctionGridBased>> &ff_list)
 {
+  chi::PerfRegion perf_region("IO::ExportVTK");
+
   const std::string fname = "chi_physics::FieldFunction::ExportMultipleToVTK";
   Chi::log.Log() << "Exporting field functions to VTK with file base \""
                  << file_base_name << "\"";
@@ -0,0 +1,555 @@
+#include "fieldfunction_xdmf_writer.h"
+#include "fieldfunction_gridbased.h"
+
+#include "math/SpatialDiscretization/spatial_discretization.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "ChiObjectFactory.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "utils/chi_perf_region.h"
+
+#include <fstream>
+#include <iomanip>
+#include <climits>
+#include <cstdio>
+
+namespace chi_physics
+{
+
+RegisterChiObject(chi_physics, FieldFunctionXDMFWriter);
+
+namespace
+{
+/**XDMF mixed-topology cell type codes.*/
+enum XDMFCellType : int64_t
+{
+  XDMF_POLYVERTEX = 1,
+  XDMF_POLYLINE = 2,
+  XDMF_POLYGON = 3,
+  XDMF_TRIANGLE = 4,
+  XDMF_QUADRILATERAL = 5,
+  XDMF_TETRAHEDRON = 6,
+  XDMF_PYRAMID = 7,
+  XDMF_WEDGE = 8,
+  XDMF_HEXAHEDRON = 9,
+  XDMF_POLYHEDRON = 16
+};
+
+/**Appends the mixed-topology entry of a cell whose points are numbered
+ * consecutively from `first_point_id` in the order of the cell's
+ * vertex-ids.*/
+void AppendCellConnectivity(const chi_mesh::Cell& cell,
+                            int64_t first_point_id,
+                            std::vector<int64_t>& connectivity)
+{
+  typedef chi_mesh::CellType CellType;
+  const size_t num_verts = cell.vertex_ids_.size();
+
+  auto AppendPoints = [&connectivity, first_point_id, num_verts]()
+  {
+    for (size_t v = 0; v < num_verts; ++v)
+      connectivity.push_back(first_point_id + static_cast<int64_t>(v));
+  };
+
+  switch (cell.SubType())
+  {
+    case CellType::SLAB:
+      connectivity.push_back(XDMF_POLYLINE);
+      connectivity.push_back(static_cast<int64_t>(num_verts));
+      break;
+    case CellType::TRIANGLE:
+      connectivity.push_back(XDMF_TRIANGLE); break;
+    case CellType::QUADRILATERAL:
+      connectivity.push_back(XDMF_QUADRILATERAL); break;
+    case CellType::POLYGON:
+      connectivity.push_back(XDMF_POLYGON);
+      connectivity.push_back(static_cast<int64_t>(num_verts));
+      break;
+    case CellType::TETRAHEDRON:
+      connectivity.push_back(XDMF_TETRAHEDRON); break;
+    case CellType::PYRAMID:
+      connectivity.push_back(XDMF_PYRAMID); break;
+    case CellType::WEDGE:
+      connectivity.push_back(XDMF_WEDGE); break;
+    case CellType::HEXAHEDRON:
+      connectivity.push_back(XDMF_HEXAHEDRON); break;
+    case CellType::POLYHEDRON:
+    {
+      //Polyhedra list their faces: num_faces, then per face the
+      //number of points followed by the points
+      connectivity.push_back(XDMF_POLYHEDRON);
+      connectivity.push_back(static_cast<int64_t>(cell.faces_.size()));
+      for (const auto& face : cell.faces_)
+      {
+        connectivity.push_back(static_cast<int64_t>(face.vertex_ids_.size()));
+        for (const uint64_t vid : face.vertex_ids_)
+        {
+          size_t v = 0;
+          for (size_t cv = 0; cv < num_verts; ++cv)
+            if (cell.vertex_ids_[cv] == vid) { v = cv; break; }
+          connectivity.push_back(first_point_id + static_cast<int64_t>(v));
+        }
+      }
+      return;
+    }
+    default:
+      connectivity.push_back(XDMF_POLYVERTEX);
+      connectivity.push_back(static_cast<int64_t>(num_verts));
+  }
+  AppendPoints();
+}
+
+/**Writes a contiguous block of a global array. Collective.*/
+template<typename T>
+void WriteBlockAtAll(MPI_File file,
+                     uint64_t array_offset,
+                     uint64_t block_offset,
+                     const std::vector<T>& block)
+{
+  //The write count is in bytes. Checked on all locations so that none is
+  //left waiting in the collective write.
+  const bool too_large =
+    block.size() > static_cast<size_t>(INT_MAX) / sizeof(T);
+  bool any_too_large = false;
+  MPI_Allreduce(&too_large,       //sendbuf
+                &any_too_large,   //recvbuf
+                1, MPI_CXX_BOOL,  //count + datatype
+                MPI_LOR,          //operation
+                Chi::mpi.comm);   //communicator
+
+  ChiLogicalErrorIf(any_too_large,
+                    "Local block too large for a single write.");
+
+  MPI_File_write_at_all(
+    file,                                                  //file handle
+    static_cast<MPI_Offset>(array_offset +                 //offset
+                            block_offset * sizeof(T)),
+    block.data(),                                          //buffer
+    static_cast<int>(block.size() * sizeof(T)), MPI_BYTE,  //count + type
+    MPI_STATUS_IGNORE);                                    //status
+}
+
+/**Returns the global offset of this location's block and the global size
+ * of each of the supplied local sizes.*/
+void MakeGlobalOffsets(const std::vector<uint64_t>& local_sizes,
+                       std::vector<uint64_t>& offsets,
+                       std::vector<uint64_t>& global_sizes)
+{
+  const int count = static_cast<int>(local_sizes.size());
+  offsets.assign(local_sizes.size(), 0);
+  global_sizes.assign(local_sizes.size(), 0);
+
+  MPI_Exscan(local_sizes.data(),    //sendbuf
+             offsets.data(),        //recvbuf
+             count, MPI_UINT64_T,   //count + datatype
+             MPI_SUM,               //operation
+             Chi::mpi.comm);        //communicator
+  if (Chi::mpi.location_id == 0) offsets.assign(local_sizes.size(), 0);
+
+  MPI_Allreduce(local_sizes.data(),   //sendbuf
+                global_sizes.data(),  //recvbuf
+                count, MPI_UINT64_T,  //count + datatype
+                MPI_SUM,              //operation
+                Chi::mpi.comm);       //communicator
+}
+
+const char* HostEndianness()
+{
+  const uint16_t probe = 1;
+  return *reinterpret_cast<const uint8_t*>(&probe) == 1 ? "Little" : "Big";
+}
+} // namespace
+
+// ##################################################################
+/**Returns the input parameters.*/
+chi::InputParameters FieldFunctionXDMFWriter::GetInputParameters()
+{
+  chi::InputParameters params = ChiObject::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Writes a time series of grid-based field functions to a single shared "
+    "binary file with an XDMF descriptor. The mesh is written once and every "
+    "call to chiXDMFWriterWriteTimeStep appends the field data.");
+  params.SetDocGroup("DocFieldFunction");
+
+  params.AddRequiredParameter<std::string>(
+    "file_base_name",
+    "Base name of the output files. Produces <file_base_name>.bin and "
+    "<file_base_name>.xdmf.");
+
+  params.AddRequiredParameterArray(
+    "field_function_handles",
+    "Handles of the grid-based field functions to write. All must be defined "
+    "on the same grid.");
+
+  return params;
+}
+
+// ##################################################################
+/**ObjectMaker based constructor.*/
+FieldFunctionXDMFWriter::FieldFunctionXDMFWriter(
+  const chi::InputParameters& params)
+  : ChiObject(params),
+    file_base_name_(params.GetParamValue<std::string>("file_base_name"))
+{
+  const std::string fname = __FUNCTION__;
+  const auto handles =
+    params.GetParamVectorValue<size_t>("field_function_handles");
+
+  for (const size_t handle : handles)
+  {
+    auto ff_base =
+      Chi::GetStackItemPtr(Chi::field_function_stack, handle, fname);
+    auto ff = std::dynamic_pointer_cast<const FieldFunctionGridBased>(ff_base);
+
+    ChiInvalidArgumentIf(not ff,
+                         "Only grid-based field functions can be written.");
+    field_functions_.push_back(ff);
+  }
+
+  ChiInvalidArgumentIf(field_functions_.empty(),
+                       "At least one field function is required.");
+  for (const auto& ff : field_functions_)
+    ChiInvalidArgumentIf(&ff->SDM().Grid() != &Grid(),
+                         "All field functions must be defined on the same "
+                         "grid.");
+}
+
+// ##################################################################
+/**Conventional constructor.*/
+FieldFunctionXDMFWriter::FieldFunctionXDMFWriter(
+  std::string file_base_name, std::vector<FFPtr> field_functions)
+  : file_base_name_(std::move(file_base_name)),
+    field_functions_(std::move(field_functions))
+{
+  ChiInvalidArgumentIf(field_functions_.empty(),
+                       "At least one field function is required.");
+  for (const auto& ff : field_functions_)
+    ChiInvalidArgumentIf(&ff->SDM().Grid() != &Grid(),
+                         "All field functions must be defined on the same "
+                         "grid.");
+}
+
+// ##################################################################
+const chi_mesh::MeshContinuum& FieldFunctionXDMFWriter::Grid() const
+{
+  return field_functions_.front()->SDM().Grid();
+}
+
+// ##################################################################
+/**Determines whether the local cells of any location differ from the
+ * last written mesh. Collective.*/
+bool FieldFunctionXDMFWriter::MeshChanged() const
+{
+  const auto& grid = Grid();
+
+  bool changed = grid.local_cells.size() != written_cell_global_ids_.size();
+  if (not changed)
+  {
+    size_t i = 0;
+    for (const auto& cell : grid.local_cells)
+      if (cell.global_id_ != written_cell_global_ids_[i++])
+      { changed = true; break; }
+  }
+
+  bool any_changed = false;
+  MPI_Allreduce(&changed,         //sendbuf
+                &any_changed,     //recvbuf
+                1, MPI_CXX_BOOL,  //count + datatype
+                MPI_LOR,          //operation
+                Chi::mpi.comm);   //communicator
+  return any_changed;
+}
+
+// ##################################################################
+/**Appends the points, topology, material-ids and partition-ids of the
+ * local cells to the binary file. Collective.*/
+void FieldFunctionXDMFWriter::WriteMesh()
+{
+  const auto& grid = Grid();
+
+  //============================================= Build local arrays
+  std::vector<double> points;
+  std::vector<int64_t> connectivity, material_ids, partition_ids;
+  written_cell_global_ids_.clear();
+
+  uint64_t num_local_points = 0;
+  for (const auto& cell : grid.local_cells)
+    num_local_points += cell.vertex_ids_.size();
+
+  std::vector<uint64_t> offsets, global_sizes;
+  MakeGlobalOffsets({num_local_points, grid.local_cells.size()},
+                    offsets, global_sizes);
+  local_point_offset_ = offsets[0];
+  local_cell_offset_ = offsets[1];
+
+  points.reserve(3 * num_local_points);
+  int64_t point_id = static_cast<int64_t>(local_point_offset_);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& vertex = grid.vertices[vid];
+      points.push_back(vertex.x);
+      points.push_back(vertex.y);
+      points.push_back(vertex.z);
+    }
+    AppendCellConnectivity(cell, point_id, connectivity);
+    point_id += static_cast<int64_t>(cell.vertex_ids_.size());
+
+    material_ids.push_back(cell.material_id_);
+    partition_ids.push_back(static_cast<int64_t>(cell.partition_id_));
+    written_cell_global_ids_.push_back(cell.global_id_);
+  }
+
+  std::vector<uint64_t> connectivity_offset, connectivity_size;
+  MakeGlobalOffsets({connectivity.size()},
+                    connectivity_offset, connectivity_size);
+
+  //============================================= Lay out and write
+  MeshInfo mesh;
+  mesh.num_points = global_sizes[0];
+  mesh.num_cells = global_sizes[1];
+  mesh.connectivity_size = connectivity_size[0];
+
+  mesh.points_offset = file_size_;
+  file_size_ += 3 * sizeof(double) * mesh.num_points;
+  mesh.connectivity_offset = file_size_;
+  file_size_ += sizeof(int64_t) * mesh.connectivity_size;
+  for (const std::string name : {"Material", "Partition"})
+  {
+    mesh.cell_arrays.push_back({name, "Cell", file_size_});
+    file_size_ += sizeof(int64_t) * mesh.num_cells;
+  }
+
+  const std::string file_name = file_base_name_ + ".bin";
+  MPI_File file;
+  if (MPI_File_open(Chi::mpi.comm, file_name.c_str(),
+                    MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                    MPI_INFO_NULL, &file) != MPI_SUCCESS)
+    throw std::runtime_error("Failed to open " + file_name + " for writing.");
+  if (meshes_.empty()) MPI_File_set_size(file, 0);
+
+  WriteBlockAtAll(file, mesh.points_offset,
+                  3 * local_point_offset_, points);
+  WriteBlockAtAll(file, mesh.connectivity_offset,
+                  connectivity_offset[0], connectivity);
+  WriteBlockAtAll(file, mesh.cell_arrays[0].offset,
+                  local_cell_offset_, material_ids);
+  WriteBlockAtAll(file, mesh.cell_arrays[1].offset,
+                  local_cell_offset_, partition_ids);
+
+  MPI_File_close(&file);
+
+  meshes_.push_back(std::move(mesh));
+}
+
+// ##################################################################
+/**Appends the current values of all field functions to the binary file,
+ * as a new time step, and updates the XDMF file. The mesh is written
+ * first if this is the first time step or if the local cells changed.
+ * Collective.*/
+void FieldFunctionXDMFWriter::WriteTimeStep(double time)
+{
+  chi::PerfRegion perf_region("IO::WriteXDMF");
+
+  if (meshes_.empty() or MeshChanged()) WriteMesh();
+
+  const auto& grid = Grid();
+  const auto& mesh = meshes_.back();
+
+  TimeStepInfo time_step;
+  time_step.time = time;
+  time_step.mesh_index = meshes_.size() - 1;
+
+  //============================================= Build point and cell
+  //                                              arrays per component
+  std::vector<std::vector<double>> blocks;
+  for (const auto& ff : field_functions_)
+  {
+    const auto field_vector = ff->GetGhostedFieldVector();
+
+    const auto& sdm = ff->SDM();
+    const auto& uk_man = ff->UnkManager();
+    const auto& unknown = ff->Unknown();
+    const size_t num_comps = unknown.NumComponents();
+
+    for (unsigned int c = 0; c < num_comps; ++c)
+    {
+      std::string component_name = ff->TextName() + unknown.text_name_;
+      if (num_comps > 1) component_name += unknown.component_text_names_[c];
+
+      std::vector<double> point_values, cell_values;
+      cell_values.reserve(grid.local_cells.size());
+
+      //Same representation as the VTK output: nodal values if the nodes
+      //coincide with the vertices, cell averages otherwise
+      for (const auto& cell : grid.local_cells)
+      {
+        const size_t num_nodes = sdm.GetCellNumNodes(cell);
+        const size_t num_verts = cell.vertex_ids_.size();
+
+        double node_average = 0.0;
+        for (size_t n = 0; n < num_nodes; ++n)
+        {
+          const int64_t nmap = sdm.MapDOFLocal(cell, n, uk_man, 0, c);
+          const double value = field_vector[nmap];
+          if (num_nodes == num_verts) point_values.push_back(value);
+          node_average += value;
+        }
+        node_average /= static_cast<double>(num_nodes);
+
+        if (num_nodes != num_verts)
+          point_values.insert(point_values.end(), num_verts, node_average);
+        cell_values.push_back(node_average);
+      }//for cell
+
+      time_step.arrays.push_back({component_name, "Node", file_size_});
+      file_size_ += sizeof(double) * mesh.num_points;
+      time_step.arrays.push_back({component_name, "Cell", file_size_});
+      file_size_ += sizeof(double) * mesh.num_cells;
+
+      blocks.push_back(std::move(point_values));
+      blocks.push_back(std::move(cell_values));
+    }//for component
+  }//for ff
+
+  //============================================= Write arrays
+  const std::string file_name = file_base_name_ + ".bin";
+  MPI_File file;
+  if (MPI_File_open(Chi::mpi.comm, file_name.c_str(), MPI_MODE_WRONLY,
+                    MPI_INFO_NULL, &file) != MPI_SUCCESS)
+    throw std::runtime_error("Failed to open " + file_name + " for writing.");
+
+  for (size_t a = 0; a < blocks.size(); ++a)
+  {
+    const bool nodal = time_step.arrays[a].center == "Node";
+    WriteBlockAtAll(file, time_step.arrays[a].offset,
+                    nodal ? local_point_offset_ : local_cell_offset_,
+                    blocks[a]);
+  }
+
+  MPI_File_close(&file);
+
+  time_steps_.push_back(std::move(time_step));
+
+  //============================================= Write XDMF on location 0
+  //Failures are broadcast so that all locations throw
+  std::string xdmf_error;
+  if (Chi::mpi.location_id == 0)
+  {
+    try { WriteXDMF(); }
+    catch (const std::exception& e) { xdmf_error = e.what(); }
+  }
+
+  int xdmf_failed = xdmf_error.empty() ? 0 : 1;
+  MPI_Bcast(&xdmf_failed,    //buffer
+            1, MPI_INT,      //count + datatype
+            0,               //root
+            Chi::mpi.comm);  //communicator
+
+  if (xdmf_failed)
+    throw std::runtime_error(
+      Chi::mpi.location_id == 0
+        ? xdmf_error
+        : "Failed to write " + file_base_name_ + ".xdmf on location 0.");
+
+  Chi::log.Log() << "Wrote XDMF time step " << time_steps_.size() - 1
+                 << " (time " << time << ") to " << file_base_name_
+                 << ".xdmf";
+}
+
+// ##################################################################
+/**Writes the XDMF descriptor of all time steps written so far. The file
+ * is replaced atomically so that it is always readable while a
+ * simulation is running.*/
+void FieldFunctionXDMFWriter::WriteXDMF() const
+{
+  //The binary file is referenced relative to the XDMF file
+  const size_t slash = file_base_name_.find_last_of('/');
+  const std::string bin_name =
+    (slash == std::string::npos ? file_base_name_
+                                : file_base_name_.substr(slash + 1)) +
+    ".bin";
+  const std::string endian = HostEndianness();
+
+  auto DataItem = [&bin_name, &endian](std::ostream& out,
+                                       const std::string& dimensions,
+                                       const std::string& number_type,
+                                       uint64_t offset,
+                                       const std::string& indent)
+  {
+    out << indent << "<DataItem Dimensions=\"" << dimensions
+        << "\" NumberType=\"" << number_type << "\" Precision=\"8\""
+        << " Format=\"Binary\" Endian=\"" << endian << "\" Seek=\""
+        << offset << "\">" << bin_name << "</DataItem>\n";
+  };
+
+  const std::string file_name = file_base_name_ + ".xdmf";
+  const std::string temp_file_name = file_name + ".tmp";
+  std::ofstream file(temp_file_name);
+  if (not file.is_open())
+    throw std::runtime_error("Failed to open " + temp_file_name +
+                             " for writing.");
+
+  file << "<?xml version=\"1.0\" ?>\n"
+       << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "  <Domain>\n"
+       << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\""
+       << " CollectionType=\"Temporal\">\n";
+
+  file << std::setprecision(16);
+  const std::string indent(8, ' ');
+  for (size_t t = 0; t < time_steps_.size(); ++t)
+  {
+    const auto& time_step = time_steps_[t];
+    const auto& mesh = meshes_[time_step.mesh_index];
+
+    file << "      <Grid Name=\"step" << t << "\" GridType=\"Uniform\">\n"
+         << indent << "<Time Value=\"" << time_step.time << "\"/>\n"
+         << indent << "<Topology TopologyType=\"Mixed\" NumberOfElements=\""
+         << mesh.num_cells << "\">\n";
+    DataItem(file, std::to_string(mesh.connectivity_size), "Int",
+             mesh.connectivity_offset, indent + "  ");
+    file << indent << "</Topology>\n"
+         << indent << "<Geometry GeometryType=\"XYZ\">\n";
+    DataItem(file, std::to_string(mesh.num_points) + " 3", "Float",
+             mesh.points_offset, indent + "  ");
+    file << indent << "</Geometry>\n";
+
+    for (const auto& array : mesh.cell_arrays)
+    {
+      file << indent << "<Attribute Name=\"" << array.name
+           << "\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+      DataItem(file, std::to_string(mesh.num_cells), "Int",
+               array.offset, indent + "  ");
+      file << indent << "</Attribute>\n";
+    }
+    for (const auto& array : time_step.arrays)
+    {
+      const bool nodal = array.center == "Node";
+      file << indent << "<Attribute Name=\"" << array.name
+           << "\" AttributeType=\"Scalar\" Center=\"" << array.center
+           << "\">\n";
+      DataItem(file,
+               std::to_string(nodal ? mesh.num_points : mesh.num_cells),
+               "Float", array.offset, indent + "  ");
+      file << indent << "</Attribute>\n";
+    }
+    file << "      </Grid>\n";
+  }
+
+  file << "    </Grid>\n"
+       << "  </Domain>\n"
+       << "</Xdmf>\n";
+  file.close();
+
+  if (std::rename(temp_file_name.c_str(), file_name.c_str()) != 0)
+    throw std::runtime_error("Failed to write " + file_name + ".");
+}
+
+} // namespace chi_physics
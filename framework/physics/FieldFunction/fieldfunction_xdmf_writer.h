@@ -0,0 +1,99 @@
+#ifndef CHITECH_FIELDFUNCTION_XDMF_WRITER_H
+#define CHITECH_FIELDFUNCTION_XDMF_WRITER_H
+
+#include "ChiObject.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace chi_mesh
+{
+class MeshContinuum;
+}
+
+namespace chi_physics
+{
+
+class FieldFunctionGridBased;
+
+// ################################################################### Class def
+/**Writes a time series of grid-based field functions to a single shared
+ * binary file, `<file_base_name>.bin`, described by an XDMF file,
+ * `<file_base_name>.xdmf`, that can be opened with ParaView/VisIt.
+ *
+ * The mesh (points, mixed topology, material- and partition-ids) is written
+ * once and only written again if the local cells change, e.g., after a
+ * repartitioning. Every time step appends, for each field function
+ * component, one contiguous point array and one contiguous cell array.
+ * All arrays are written with collective MPI-IO, each location writing its
+ * own block. Points are duplicated per cell, as with VTK output, so that
+ * discontinuous fields are represented exactly.*/
+class FieldFunctionXDMFWriter : public ChiObject
+{
+public:
+  typedef std::shared_ptr<const FieldFunctionGridBased> FFPtr;
+
+private:
+  /**A data array in the binary file.*/
+  struct ArrayInfo
+  {
+    std::string name;
+    std::string center; ///< "Node" or "Cell"
+    uint64_t offset = 0;
+  };
+
+  /**Global sizes and file offsets of one written mesh.*/
+  struct MeshInfo
+  {
+    uint64_t num_points = 0;
+    uint64_t num_cells = 0;
+    uint64_t connectivity_size = 0;
+    uint64_t points_offset = 0;
+    uint64_t connectivity_offset = 0;
+    std::vector<ArrayInfo> cell_arrays;
+  };
+
+  struct TimeStepInfo
+  {
+    double time = 0.0;
+    size_t mesh_index = 0;
+    std::vector<ArrayInfo> arrays;
+  };
+
+  const std::string file_base_name_;
+  std::vector<FFPtr> field_functions_;
+
+  std::vector<MeshInfo> meshes_;
+  std::vector<TimeStepInfo> time_steps_;
+
+  /**Local cell global-ids of the last written mesh.*/
+  std::vector<uint64_t> written_cell_global_ids_;
+  uint64_t local_point_offset_ = 0;
+  uint64_t local_cell_offset_ = 0;
+  uint64_t file_size_ = 0;
+
+public:
+  static chi::InputParameters GetInputParameters();
+
+  explicit FieldFunctionXDMFWriter(const chi::InputParameters& params);
+
+  FieldFunctionXDMFWriter(std::string file_base_name,
+                          std::vector<FFPtr> field_functions);
+
+  /**Number of time steps written so far.*/
+  size_t NumTimeSteps() const { return time_steps_.size(); }
+
+  void WriteTimeStep(double time);
+
+private:
+  const chi_mesh::MeshContinuum& Grid() const;
+  bool MeshChanged() const;
+  void WriteMesh();
+  void WriteXDMF() const;
+};
+
+} // namespace chi_physics
+
+#endif // CHITECH_FIELDFUNCTION_XDMF_WRITER_H
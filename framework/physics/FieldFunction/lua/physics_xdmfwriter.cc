@@ -0,0 +1,45 @@
+#include "chi_lua.h"
+
+#include "physics/FieldFunction/fieldfunction_xdmf_writer.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "fieldfunctions_lua.h"
+#include "console/chi_console.h"
+
+RegisterLuaFunctionAsIs(chiXDMFWriterWriteTimeStep);
+
+// #############################################################################
+/** Appends the current values of the field functions of an XDMF writer
+ * (see chi_physics::FieldFunctionXDMFWriter) as a new time step.
+ *
+\param WriterHandle int Handle to the writer object.
+\param Time double Optional. Time of the step. Defaults to the number of
+                   previously written steps.
+
+\ingroup LuaFieldFunc
+\author Jan*/
+int chiXDMFWriterWriteTimeStep(lua_State* L)
+{
+  const std::string fname = "chiXDMFWriterWriteTimeStep";
+  const int num_args = lua_gettop(L);
+  if (num_args != 1 and num_args != 2)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckNilValue(fname, L, 1);
+  const size_t handle = lua_tointeger(L, 1);
+
+  auto& writer = Chi::GetStackItem<chi_physics::FieldFunctionXDMFWriter>(
+    Chi::object_stack, handle, fname);
+
+  double time = static_cast<double>(writer.NumTimeSteps());
+  if (num_args == 2)
+  {
+    LuaCheckNumberValue(fname, L, 2);
+    time = lua_tonumber(L, 2);
+  }
+
+  writer.WriteTimeStep(time);
+
+  return 0;
+}
@@ -7,6 +7,8 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
+#include "utils/chi_memory_registry.h"
 #include "console/chi_console.h"
 
 /** \defgroup LuaSolver Solvers
@@ -52,7 +54,8 @@ int chiSolverCreate(lua_State* L)
 }
 
 // #############################################################################
-/** Initializes the solver at the given handle.
+/** Initializes the solver at the given handle. Afterwards, prints the memory
+registered by the major data structures (see chiMemoryReport).
 
 \param solver_handle int Handle to the solver.
 
@@ -72,7 +75,12 @@ int chiSolverInitialize(lua_State* L)
   auto& solver = Chi::GetStackItem<chi_physics::Solver>(
     Chi::object_stack, solver_handle, fname);
 
-  solver.Initialize();
+  {
+    chi::PerfRegion perf_region("Solver::Initialize");
+    solver.Initialize();
+  }
+
+  chi::MemoryRegistry::GetInstance().PrintReport();
 
   return 0;
 }
@@ -98,6 +106,7 @@ int chiSolverExecute(lua_State* L)
   auto& solver = Chi::GetStackItem<chi_physics::Solver>(
     Chi::object_stack, solver_handle, fname);
 
+  chi::PerfRegion perf_region("Solver::Execute");
   solver.Execute();
 
   return 0;
@@ -124,6 +133,7 @@ int chiSolverStep(lua_State* L)
   auto& solver = Chi::GetStackItem<chi_physics::Solver>(
     Chi::object_stack, solver_handle, fname);
 
+  chi::PerfRegion perf_region("Solver::Step");
   solver.Step();
 
   return 0;
@@ -150,6 +160,7 @@ int chiSolverAdvance(lua_State* L)
   auto& solver = Chi::GetStackItem<chi_physics::Solver>(
     Chi::object_stack, solver_handle, fname);
 
+  chi::PerfRegion perf_region("Solver::Advance");
   solver.Advance();
 
   return 0;
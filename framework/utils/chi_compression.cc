@@ -0,0 +1,333 @@
+#include "chi_compression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+constexpr size_t   MIN_MATCH  = 4;
+constexpr size_t   MAX_OFFSET = 65535;
+constexpr uint32_t HASH_BITS  = 16;
+
+/**Quantized values are limited to integers that a double represents
+ * exactly, which also keeps their differences within 64 bits.*/
+constexpr double MAX_QUANTIZED = 4503599627370496.0; //2^52
+
+enum LossyStreamFlag : char
+{
+  QUANTIZED = 0,
+  LOSSLESS  = 1
+};
+
+uint32_t Read32(const char* p)
+{
+  uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+uint32_t Hash(uint32_t sequence)
+{
+  return (sequence * 2654435761U) >> (32 - HASH_BITS);
+}
+
+/**Writes the part of a length beyond the 4-bit token field.*/
+void WriteLength(std::vector<char>& out, size_t length)
+{
+  length -= 15;
+  for (; length >= 255; length -= 255)
+    out.push_back(static_cast<char>(255));
+  out.push_back(static_cast<char>(length));
+}
+
+/**Writes a sequence of literals followed by a match. A match length of
+ * zero denotes the final sequence, which has no match.*/
+void EmitSequence(std::vector<char>& out,
+                  const char* literals, size_t num_literals,
+                  size_t offset, size_t match_length)
+{
+  const size_t literal_field = std::min<size_t>(num_literals, 15);
+  const size_t match_field = match_length == 0 ? 0 :
+    std::min<size_t>(match_length - MIN_MATCH, 15);
+
+  out.push_back(static_cast<char>((literal_field << 4) | match_field));
+  if (literal_field == 15) WriteLength(out, num_literals);
+  out.insert(out.end(), literals, literals + num_literals);
+
+  if (match_length == 0) return;
+
+  out.push_back(static_cast<char>(offset & 0xFF));
+  out.push_back(static_cast<char>(offset >> 8));
+  if (match_field == 15) WriteLength(out, match_length - MIN_MATCH);
+}
+
+/**Groups the bytes of doubles by significance, i.e., all first bytes,
+ * then all second bytes, etc. Sign and exponent bytes of similar values
+ * then form long repeating runs.*/
+std::vector<char> Shuffle(const double* values, size_t num_values)
+{
+  const auto* bytes = reinterpret_cast<const char*>(values);
+  std::vector<char> shuffled(8 * num_values);
+  for (size_t b = 0; b < 8; ++b)
+    for (size_t i = 0; i < num_values; ++i)
+      shuffled[b * num_values + i] = bytes[8 * i + b];
+  return shuffled;
+}
+
+void Unshuffle(const char* shuffled, size_t num_values, double* values)
+{
+  auto* bytes = reinterpret_cast<char*>(values);
+  for (size_t b = 0; b < 8; ++b)
+    for (size_t i = 0; i < num_values; ++i)
+      bytes[8 * i + b] = shuffled[b * num_values + i];
+}
+
+void ThrowCorrupt()
+{
+  throw std::runtime_error("Corrupt compressed data encountered.");
+}
+}//namespace
+
+//###################################################################
+std::vector<char> chi::LZCompress(const char* data, size_t size)
+{
+  std::vector<char> out;
+  out.reserve(size / 2 + 16);
+
+  std::vector<int64_t> table(size_t(1) << HASH_BITS, -1);
+
+  size_t anchor = 0;
+  size_t i = 0;
+  while (i + MIN_MATCH <= size)
+  {
+    const uint32_t sequence = Read32(data + i);
+    auto& entry = table[Hash(sequence)];
+    const int64_t candidate = entry;
+    entry = static_cast<int64_t>(i);
+
+    if (candidate >= 0 and
+        i - static_cast<size_t>(candidate) <= MAX_OFFSET and
+        Read32(data + candidate) == sequence)
+    {
+      size_t length = MIN_MATCH;
+      while (i + length < size and data[candidate + length] == data[i + length])
+        ++length;
+
+      EmitSequence(out, data + anchor, i - anchor,
+                   i - static_cast<size_t>(candidate), length);
+      i += length;
+      anchor = i;
+    }
+    else
+      ++i;
+  }
+  EmitSequence(out, data + anchor, size - anchor, 0, 0);
+
+  return out;
+}
+
+//###################################################################
+void chi::LZDecompress(const char* data, size_t data_size,
+                       char* output, size_t size)
+{
+  const auto* ip = reinterpret_cast<const unsigned char*>(data);
+  const auto* const end = ip + data_size;
+  size_t op = 0;
+
+  auto ReadLength = [&ip, end](size_t length)
+  {
+    unsigned char byte;
+    do
+    {
+      if (ip >= end) ThrowCorrupt();
+      byte = *ip++;
+      length += byte;
+    } while (byte == 255);
+    return length;
+  };
+
+  while (ip < end)
+  {
+    const unsigned char token = *ip++;
+
+    size_t num_literals = token >> 4;
+    if (num_literals == 15) num_literals = ReadLength(num_literals);
+    if (num_literals > static_cast<size_t>(end - ip) or
+        num_literals > size - op)
+      ThrowCorrupt();
+    if (num_literals > 0) std::memcpy(output + op, ip, num_literals);
+    ip += num_literals;
+    op += num_literals;
+
+    if (ip == end) break; //final sequence
+
+    if (end - ip < 2) ThrowCorrupt();
+    const size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << 8);
+    ip += 2;
+
+    size_t length = token & 0x0F;
+    if (length == 15) length = ReadLength(length);
+    length += MIN_MATCH;
+    if (offset == 0 or offset > op or length > size - op) ThrowCorrupt();
+
+    //Byte-wise since the match may overlap the output being written
+    for (size_t k = 0; k < length; ++k, ++op)
+      output[op] = output[op - offset];
+  }
+
+  if (op != size) ThrowCorrupt();
+}
+
+//###################################################################
+std::vector<char> chi::CompressDoubles(const double* values,
+                                       size_t num_values,
+                                       CompressionType type,
+                                       double tolerance)
+{
+  switch (type)
+  {
+    case CompressionType::NONE:
+    {
+      const auto* bytes = reinterpret_cast<const char*>(values);
+      return {bytes, bytes + 8 * num_values};
+    }
+    case CompressionType::SHUFFLE_LZ:
+    {
+      const auto shuffled = Shuffle(values, num_values);
+      return LZCompress(shuffled.data(), shuffled.size());
+    }
+    case CompressionType::LOSSY:
+    {
+      if (not (tolerance > 0.0))
+        throw std::invalid_argument("Lossy compression requires a positive "
+                                    "tolerance.");
+
+      //======================================== Quantize and encode
+      //                                         differences as varints
+      const double step = 2.0 * tolerance;
+      std::vector<char> varints;
+      varints.reserve(num_values);
+      int64_t previous = 0;
+      bool quantizable = true;
+      for (size_t i = 0; i < num_values and quantizable; ++i)
+      {
+        //The reconstructed value must honor the tolerance, which rounding
+        //near machine precision or a denormal step can violate
+        const double scaled = std::nearbyint(values[i] / step);
+        if (not std::isfinite(scaled) or std::fabs(scaled) > MAX_QUANTIZED or
+            not (std::fabs(scaled * step - values[i]) <= tolerance))
+        {
+          quantizable = false;
+          break;
+        }
+        const auto quantized = static_cast<int64_t>(scaled);
+        const int64_t difference = quantized - previous;
+        previous = quantized;
+
+        uint64_t zigzag = (static_cast<uint64_t>(difference) << 1) ^
+                          static_cast<uint64_t>(difference >> 63);
+        for (; zigzag >= 0x80; zigzag >>= 7)
+          varints.push_back(static_cast<char>((zigzag & 0x7F) | 0x80));
+        varints.push_back(static_cast<char>(zigzag));
+      }
+
+      std::vector<char> out;
+      if (not quantizable)
+      {
+        out.push_back(LOSSLESS);
+        const auto lossless = CompressDoubles(values, num_values,
+                                              CompressionType::SHUFFLE_LZ);
+        out.insert(out.end(), lossless.begin(), lossless.end());
+        return out;
+      }
+
+      const uint64_t num_varint_bytes = varints.size();
+      const auto* size_bytes = reinterpret_cast<const char*>(&num_varint_bytes);
+      const auto lz = LZCompress(varints.data(), varints.size());
+
+      out.reserve(1 + sizeof(num_varint_bytes) + lz.size());
+      out.push_back(QUANTIZED);
+      out.insert(out.end(), size_bytes, size_bytes + sizeof(num_varint_bytes));
+      out.insert(out.end(), lz.begin(), lz.end());
+      return out;
+    }
+  }
+  throw std::invalid_argument("Unknown compression type.");
+}
+
+//###################################################################
+void chi::DecompressDoubles(const char* data,
+                            size_t data_size,
+                            CompressionType type,
+                            double tolerance,
+                            double* values,
+                            size_t num_values)
+{
+  switch (type)
+  {
+    case CompressionType::NONE:
+    {
+      if (data_size != 8 * num_values) ThrowCorrupt();
+      if (data_size > 0) std::memcpy(values, data, data_size);
+      return;
+    }
+    case CompressionType::SHUFFLE_LZ:
+    {
+      std::vector<char> shuffled(8 * num_values);
+      LZDecompress(data, data_size, shuffled.data(), shuffled.size());
+      Unshuffle(shuffled.data(), num_values, values);
+      return;
+    }
+    case CompressionType::LOSSY:
+    {
+      if (data_size < 1) ThrowCorrupt();
+      if (data[0] == LOSSLESS)
+      {
+        DecompressDoubles(data + 1, data_size - 1,
+                          CompressionType::SHUFFLE_LZ, tolerance,
+                          values, num_values);
+        return;
+      }
+
+      uint64_t num_varint_bytes;
+      if (data[0] != QUANTIZED or data_size < 1 + sizeof(num_varint_bytes))
+        ThrowCorrupt();
+      std::memcpy(&num_varint_bytes, data + 1, sizeof(num_varint_bytes));
+      const size_t header_size = 1 + sizeof(num_varint_bytes);
+
+      //Every value takes 1 to 10 varint bytes. Checked before allocating
+      //so that a corrupt size cannot request an arbitrary amount of memory.
+      if (num_varint_bytes < num_values or num_varint_bytes > 10 * num_values)
+        ThrowCorrupt();
+
+      std::vector<char> varints(num_varint_bytes);
+      LZDecompress(data + header_size, data_size - header_size,
+                   varints.data(), varints.size());
+
+      const double step = 2.0 * tolerance;
+      const auto* ip = reinterpret_cast<const unsigned char*>(varints.data());
+      const auto* const end = ip + varints.size();
+      int64_t previous = 0;
+      for (size_t i = 0; i < num_values; ++i)
+      {
+        uint64_t zigzag = 0;
+        for (int shift = 0; ; shift += 7)
+        {
+          if (ip >= end or shift > 63) ThrowCorrupt();
+          const unsigned char byte = *ip++;
+          zigzag |= static_cast<uint64_t>(byte & 0x7F) << shift;
+          if ((byte & 0x80) == 0) break;
+        }
+        const auto difference = static_cast<int64_t>(zigzag >> 1) ^
+                                -static_cast<int64_t>(zigzag & 1);
+        previous += difference;
+        values[i] = static_cast<double>(previous) * step;
+      }
+      if (ip != end) ThrowCorrupt();
+      return;
+    }
+  }
+  throw std::invalid_argument("Unknown compression type.");
+}
@@ -0,0 +1,51 @@
+#ifndef CHITECH_CHI_COMPRESSION_H
+#define CHITECH_CHI_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**Compression of floating point arrays for file output. These utilities
+ * have no dependencies.*/
+namespace chi
+{
+  /**Compression applied to arrays of doubles. The value is stored in
+   * file headers and must not change.*/
+  enum class CompressionType : uint64_t
+  {
+    NONE       = 0, ///< Raw values
+    SHUFFLE_LZ = 1, ///< Lossless. Byte shuffle followed by LZ77
+    LOSSY      = 2  ///< Error-bounded. Each value is reproduced to within
+                    ///< the tolerance (up to round-off)
+  };
+
+  /**Compresses a byte array with a fast LZ77 scheme (64 KiB window).*/
+  std::vector<char> LZCompress(const char* data, size_t size);
+
+  /**Decompresses an LZCompress stream into exactly `size` bytes. Throws
+   * std::runtime_error if the stream is corrupt.*/
+  void LZDecompress(const char* data, size_t data_size,
+                    char* output, size_t size);
+
+  /**Compresses an array of doubles. For LOSSY compression, values are
+   * quantized in steps of twice the tolerance and the differences of
+   * consecutive quantized values are encoded, which suits smooth fields.
+   * Arrays with values that cannot be quantized are compressed
+   * losslessly.*/
+  std::vector<char> CompressDoubles(const double* values,
+                                    size_t num_values,
+                                    CompressionType type,
+                                    double tolerance = 0.0);
+
+  /**Decompresses exactly `num_values` doubles compressed with
+   * CompressDoubles, with the same type and tolerance. Throws
+   * std::runtime_error if the data is corrupt.*/
+  void DecompressDoubles(const char* data,
+                         size_t data_size,
+                         CompressionType type,
+                         double tolerance,
+                         double* values,
+                         size_t num_values);
+}//namespace chi
+
+#endif //CHITECH_CHI_COMPRESSION_H
@@ -0,0 +1,175 @@
+#include "chi_hw_counters.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//###################################################################
+/**Access to the singleton.*/
+chi::HardwareCounters& chi::HardwareCounters::GetInstance() noexcept
+{
+  static HardwareCounters instance;
+  return instance;
+}
+
+//###################################################################
+/**Constructs with all counters closed.*/
+chi::HardwareCounters::HardwareCounters() noexcept
+{
+  fds_.fill(-1);
+  read_positions_.fill(-1);
+}
+
+//###################################################################
+/**Closes all counters.*/
+chi::HardwareCounters::~HardwareCounters()
+{
+  Disable();
+}
+
+//###################################################################
+/**Opens the counters for the calling thread, which must be the main
+ * thread. A non-zero `raw_event_config` also opens the RAW counter with
+ * that event code. Returns true if at least the cycle counter could be
+ * opened, otherwise logs a warning and returns false.*/
+bool chi::HardwareCounters::Enable(uint64_t raw_event_config/*=0*/)
+{
+  Disable();
+
+#if defined(__linux__)
+  struct EventSpec
+  {
+    Counter  counter;
+    uint32_t type;
+    uint64_t config;
+  };
+  std::vector<EventSpec> specs =
+    {{CYCLES,         PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+     {INSTRUCTIONS,   PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+     {LLC_REFERENCES, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+     {LLC_MISSES,     PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}};
+  if (raw_event_config != 0)
+    specs.push_back({RAW, PERF_TYPE_RAW, raw_event_config});
+
+  int leader_fd = -1;
+  for (const auto& spec : specs)
+  {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = spec.type;
+    attr.config = spec.config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP |
+                       PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr,
+                                            /*pid=*/0, /*cpu=*/-1,
+                                            /*group_fd=*/leader_fd,
+                                            /*flags=*/0UL));
+    if (fd < 0)
+    {
+      if (spec.counter == CYCLES)
+      {
+        Chi::log.Log0Warning()
+          << "Hardware counters are not available (perf_event_open: "
+          << std::strerror(errno) << "). Check "
+          << "/proc/sys/kernel/perf_event_paranoid. Continuing without "
+          << "hardware counters.";
+        return false;
+      }
+      Chi::log.Log0Warning()
+        << "Hardware counter " << Name(spec.counter)
+        << " is not available and will read as zero.";
+      continue;
+    }
+
+    if (leader_fd < 0) leader_fd = fd;
+    fds_[spec.counter] = fd;
+    read_positions_[spec.counter] = static_cast<int>(num_open_++);
+  }
+
+  ioctl(leader_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl(leader_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+  enabled_ = true;
+  return true;
+#else
+  Chi::log.Log0Warning() << "Hardware counters are only supported on Linux. "
+                            "Continuing without hardware counters.";
+  return false;
+#endif
+}
+
+//###################################################################
+/**Closes all counters.*/
+void chi::HardwareCounters::Disable()
+{
+#if defined(__linux__)
+  // Members first, the group leader (CYCLES) last
+  for (size_t c = NUM_COUNTERS; c-- > 0;)
+    if (fds_[c] >= 0) close(fds_[c]);
+#endif
+  fds_.fill(-1);
+  read_positions_.fill(-1);
+  num_open_ = 0;
+  enabled_ = false;
+}
+
+//###################################################################
+/**Reads the current counts, scaled for multiplexing, into `values`.
+ * Unavailable counters, or all counters when disabled, read as zero.*/
+void chi::HardwareCounters::Read(Values& values) const
+{
+  values.fill(0);
+  if (not enabled_) return;
+
+#if defined(__linux__)
+  // Layout of a group read: nr, time_enabled, time_running, values[nr]
+  uint64_t buffer[3 + NUM_COUNTERS];
+  const ssize_t num_bytes = read(fds_[CYCLES], buffer, sizeof(buffer));
+  if (num_bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) return;
+
+  const uint64_t num_read = buffer[0];
+  const uint64_t time_enabled = buffer[1];
+  const uint64_t time_running = buffer[2];
+  const double scale = (time_running > 0 and time_running < time_enabled) ?
+    static_cast<double>(time_enabled) / static_cast<double>(time_running) :
+    1.0;
+
+  for (size_t c = 0; c < NUM_COUNTERS; ++c)
+  {
+    const int position = read_positions_[c];
+    if (position < 0 or static_cast<uint64_t>(position) >= num_read) continue;
+    values[c] = static_cast<uint64_t>(
+      static_cast<double>(buffer[3 + position]) * scale);
+  }
+#endif
+}
+
+//###################################################################
+/**Returns the name of a counter as used in reports.*/
+std::string chi::HardwareCounters::Name(Counter counter)
+{
+  switch (counter)
+  {
+    case CYCLES:         return "cycles";
+    case INSTRUCTIONS:   return "instructions";
+    case LLC_REFERENCES: return "llc_references";
+    case LLC_MISSES:     return "llc_misses";
+    case RAW:            return "raw";
+    default:             return "unknown";
+  }
+}
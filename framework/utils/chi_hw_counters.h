@@ -0,0 +1,77 @@
+#ifndef CHITECH_CHI_HW_COUNTERS_H
+#define CHITECH_CHI_HW_COUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace chi
+{
+
+// ###################################################################
+/**Hardware performance counters of the main thread, read with the Linux
+ * `perf_event_open` interface.
+ *
+ * The counters are opened as a single group so that they are scheduled
+ * together. Counts are scaled when the kernel multiplexes the group.
+ * Counters that cannot be opened (e.g. missing hardware support, virtual
+ * machines, or a restrictive `/proc/sys/kernel/perf_event_paranoid`) read as
+ * zero. If no counter can be opened the counters stay disabled and a warning
+ * is logged, and everything else carries on as normal.
+ *
+ * There is no portable floating-point counter, so a raw, CPU-specific event
+ * code can be supplied, e.g. `0x01c7` (FP_ARITH_INST_RETIRED.SCALAR_DOUBLE)
+ * on recent Intel CPUs.
+ *
+ * When enabled, every chi::PerfRegion accumulates the counter deltas between
+ * its entry and exit, and the PerfRegistry report lists them per region and
+ * per location. Enabled on the command line with `--hw_counters` or
+ * `--hw_counters_raw=CODE`.*/
+class HardwareCounters
+{
+public:
+  /**Counter slots.*/
+  enum Counter : size_t
+  {
+    CYCLES = 0,         ///< CPU cycles
+    INSTRUCTIONS = 1,   ///< Retired instructions
+    LLC_REFERENCES = 2, ///< Last-level cache references
+    LLC_MISSES = 3,     ///< Last-level cache misses
+    RAW = 4,            ///< User supplied raw event
+    NUM_COUNTERS = 5
+  };
+
+  typedef std::array<uint64_t, NUM_COUNTERS> Values;
+
+private:
+  std::array<int, NUM_COUNTERS> fds_;
+  /**Position of each open counter in a group read, or -1.*/
+  std::array<int, NUM_COUNTERS> read_positions_;
+  size_t num_open_ = 0;
+  bool enabled_ = false;
+
+  HardwareCounters() noexcept;
+
+public:
+  static HardwareCounters& GetInstance() noexcept;
+
+  HardwareCounters(const HardwareCounters&) = delete;
+  HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+  ~HardwareCounters();
+
+  bool Enable(uint64_t raw_event_config = 0);
+  void Disable();
+
+  bool IsEnabled() const { return enabled_; }
+  bool IsAvailable(Counter counter) const { return fds_[counter] >= 0; }
+
+  void Read(Values& values) const;
+
+  static std::string Name(Counter counter);
+};
+
+} // namespace chi
+
+#endif // CHITECH_CHI_HW_COUNTERS_H
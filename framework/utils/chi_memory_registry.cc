@@ -0,0 +1,212 @@
+#include "chi_memory_registry.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "mpi/chi_mpi_utils_allgather_strings.h"
+#include "console/chi_console.h"
+
+#include <set>
+#include <sstream>
+
+//###################################################################
+/**Access to the singleton.*/
+chi::MemoryRegistry& chi::MemoryRegistry::GetInstance() noexcept
+{
+  static MemoryRegistry instance;
+  return instance;
+}
+
+//###################################################################
+/**Sets the number of bytes held by `owner` under `category`, replacing
+ * any previous value for the same category and owner.*/
+void chi::MemoryRegistry::Set(const std::string& category,
+                              const void* owner,
+                              size_t num_bytes)
+{
+  categories_[category][owner] = num_bytes;
+}
+
+//###################################################################
+/**Removes the entry of `owner` under `category`, if any. Empty
+ * categories are kept so that they still appear in reports.*/
+void chi::MemoryRegistry::Remove(const std::string& category,
+                                 const void* owner)
+{
+  const auto it = categories_.find(category);
+  if (it != categories_.end()) it->second.erase(owner);
+}
+
+//###################################################################
+/**Removes all the entries of `owner`.*/
+void chi::MemoryRegistry::RemoveOwner(const void* owner)
+{
+  for (auto& [category, owners] : categories_)
+    owners.erase(owner);
+}
+
+//###################################################################
+/**Removes all categories and entries.*/
+void chi::MemoryRegistry::Clear()
+{
+  categories_.clear();
+}
+
+//###################################################################
+/**Returns the number of bytes registered under a category on this
+ * location.*/
+size_t chi::MemoryRegistry::CategoryTotal(const std::string& category) const
+{
+  const auto it = categories_.find(category);
+  if (it == categories_.end()) return 0;
+
+  size_t num_bytes = 0;
+  for (const auto& [owner, owner_bytes] : it->second)
+    num_bytes += owner_bytes;
+  return num_bytes;
+}
+
+//###################################################################
+/**Returns the number of bytes registered on this location.*/
+size_t chi::MemoryRegistry::Total() const
+{
+  size_t num_bytes = 0;
+  for (const auto& [category, owners] : categories_)
+    num_bytes += CategoryTotal(category);
+  return num_bytes;
+}
+
+//###################################################################
+/**Returns the names of the categories registered on this location.*/
+std::vector<std::string> chi::MemoryRegistry::Categories() const
+{
+  std::vector<std::string> names;
+  names.reserve(categories_.size());
+  for (const auto& [category, owners] : categories_)
+    names.push_back(category);
+  return names;
+}
+
+//###################################################################
+/**Builds a report of the registered memory. For each category registered
+ * on any location the report lists the min/avg/max over locations and the
+ * global sum. The registered totals are compared with the process resident
+ * set size. If `per_location` is true the report also lists every category
+ * for every location.
+ *
+ * Must be called by all locations. Returns the report on location 0 and an
+ * empty string on all other locations.*/
+std::string chi::MemoryRegistry::BuildReport(
+  bool per_location/*=false*/) const
+{
+  const int num_locations = Chi::mpi.process_count;
+
+  //============================================= Union of categories
+  // Ordered so that every location reduces the same categories in the
+  // same order
+  const auto all_categories = chi_mpi_utils::AllGatherStrings(Categories());
+  const std::set<std::string> category_set(all_categories.begin(),
+                                           all_categories.end());
+  const std::vector<std::string> categories(category_set.begin(),
+                                            category_set.end());
+
+  //============================================= Local values in MB
+  // The last two entries are the registered total and the process RSS
+  const size_t num_categories = categories.size();
+  const size_t num_values = num_categories + 2;
+  const double MB = 1024.0 * 1024.0;
+
+  std::vector<double> local_values(num_values, 0.0);
+  for (size_t c = 0; c < num_categories; ++c)
+    local_values[c] = static_cast<double>(CategoryTotal(categories[c])) / MB;
+  local_values[num_categories] = static_cast<double>(Total()) / MB;
+  local_values[num_categories + 1] = chi::Console::GetMemoryUsageInMB();
+
+  //============================================= Reduce
+  const int count = static_cast<int>(num_values);
+  std::vector<double> min_values(num_values, 0.0);
+  std::vector<double> max_values(num_values, 0.0);
+  std::vector<double> sum_values(num_values, 0.0);
+  MPI_Reduce(local_values.data(), min_values.data(), count,
+             MPI_DOUBLE, MPI_MIN, 0, Chi::mpi.comm);
+  MPI_Reduce(local_values.data(), max_values.data(), count,
+             MPI_DOUBLE, MPI_MAX, 0, Chi::mpi.comm);
+  MPI_Reduce(local_values.data(), sum_values.data(), count,
+             MPI_DOUBLE, MPI_SUM, 0, Chi::mpi.comm);
+
+  std::vector<double> all_values;
+  if (per_location)
+  {
+    if (Chi::mpi.location_id == 0)
+      all_values.assign(num_locations * num_values, 0.0);
+
+    MPI_Gather(local_values.data(),  //sendbuf
+               count, MPI_DOUBLE,    //sendcount + type
+               all_values.data(),    //recvbuf
+               count, MPI_DOUBLE,    //recvcount + type
+               0, Chi::mpi.comm);    //root + communicator
+  }
+
+  if (Chi::mpi.location_id != 0) return "";
+
+  //============================================= Build report
+  std::stringstream outstr;
+  outstr << "Memory registry (MB across " << num_locations << " locations)\n";
+
+  char buffer[200];
+  snprintf(buffer, 200, "%-30s %11s %11s %11s %12s\n",
+           "Category", "Min", "Avg", "Max", "Global");
+  outstr << buffer;
+
+  auto PrintRow = [&](const std::string& name, size_t v)
+  {
+    snprintf(buffer, 200, "%-30s %11.3f %11.3f %11.3f %12.3f\n",
+             name.c_str(), min_values[v], sum_values[v] / num_locations,
+             max_values[v], sum_values[v]);
+    outstr << buffer;
+  };
+
+  for (size_t c = 0; c < num_categories; ++c)
+    PrintRow(categories[c], c);
+  PrintRow("Total registered", num_categories);
+  PrintRow("Process RSS", num_categories + 1);
+
+  const double rss = sum_values[num_categories + 1];
+  if (rss > 0.0)
+  {
+    snprintf(buffer, 200, "Registered memory is %.1f%% of the process "
+                          "resident set size.\n",
+             100.0 * sum_values[num_categories] / rss);
+    outstr << buffer;
+  }
+
+  if (per_location)
+  {
+    for (int l = 0; l < num_locations; ++l)
+    {
+      const double* values = &all_values[l * num_values];
+      outstr << "Location " << l << ":\n";
+      for (size_t c = 0; c < num_categories; ++c)
+      {
+        snprintf(buffer, 200, "  %-28s %11.3f\n",
+                 categories[c].c_str(), values[c]);
+        outstr << buffer;
+      }
+      snprintf(buffer, 200, "  %-28s %11.3f\n  %-28s %11.3f\n",
+               "Total registered", values[num_categories],
+               "Process RSS", values[num_categories + 1]);
+      outstr << buffer;
+    }
+  }
+
+  return outstr.str();
+}
+
+//###################################################################
+/**Builds the report with BuildReport and prints it on location 0. Must be
+ * called by all locations.*/
+void chi::MemoryRegistry::PrintReport(bool per_location/*=false*/) const
+{
+  const std::string report = BuildReport(per_location);
+  Chi::log.Log() << "\n" << report;
+}
@@ -0,0 +1,92 @@
+#ifndef CHITECH_CHI_MEMORY_REGISTRY_H
+#define CHITECH_CHI_MEMORY_REGISTRY_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace chi
+{
+
+// ###################################################################
+/**Registry of the memory held by the major data structures on this
+ * location.
+ *
+ * Objects that allocate large amounts of memory register the number of
+ * bytes they hold under a category, e.g., `"Mesh cells"`, keyed by an owner
+ * pointer (normally `this`). Setting the bytes again for the same category
+ * and owner replaces the previous value, so re-initializing an object does
+ * not double count. Owners remove their entries, normally with RemoveOwner
+ * in their destructor.
+ *
+ * Registered sizes are computed from container capacities and are therefore
+ * approximate. Memory held inside third-party libraries, e.g. PETSc
+ * preconditioners, is not included, which is why the report also lists the
+ * process resident set size.
+ *
+ * A per-location and global breakdown is printed after a solver has been
+ * initialized and on demand with the lua function chiMemoryReport.*/
+class MemoryRegistry
+{
+public:
+  //Standard categories
+  static constexpr const char* MESH_CELLS = "Mesh cells";
+  static constexpr const char* MESH_VERTICES = "Mesh vertices";
+  static constexpr const char* CELL_MAPPINGS = "Cell mappings";
+  static constexpr const char* UNIT_CELL_MATRICES = "Unit cell matrices";
+  static constexpr const char* FLUX_MOMENTS = "phi vectors";
+  static constexpr const char* ANGULAR_FLUX = "psi vectors";
+  static constexpr const char* SOURCE_MOMENTS = "q_moments vectors";
+  static constexpr const char* PRECURSORS = "Precursor vectors";
+  static constexpr const char* FLUDS_BUFFERS = "FLUDS buffers";
+  static constexpr const char* REFLECTING_BOUNDARIES = "Reflecting boundaries";
+  static constexpr const char* DSA_MATRICES = "DSA matrices";
+  static constexpr const char* PETSC_VECTORS = "PETSc vectors";
+
+private:
+  /**Bytes per owner, per category.*/
+  std::map<std::string, std::map<const void*, size_t>> categories_;
+
+  MemoryRegistry() = default;
+
+public:
+  static MemoryRegistry& GetInstance() noexcept;
+
+  MemoryRegistry(const MemoryRegistry&) = delete;
+  MemoryRegistry& operator=(const MemoryRegistry&) = delete;
+
+  void Set(const std::string& category, const void* owner, size_t num_bytes);
+  void Remove(const std::string& category, const void* owner);
+  void RemoveOwner(const void* owner);
+  void Clear();
+
+  size_t CategoryTotal(const std::string& category) const;
+  size_t Total() const;
+  std::vector<std::string> Categories() const;
+
+  std::string BuildReport(bool per_location = false) const;
+  void PrintReport(bool per_location = false) const;
+
+  /**Returns the number of bytes allocated by a vector.*/
+  template<typename T>
+  static size_t Bytes(const std::vector<T>& vec)
+  {
+    return vec.capacity() * sizeof(T);
+  }
+
+  /**Returns the number of bytes allocated by a vector of vectors,
+   * including the outer vector.*/
+  template<typename T>
+  static size_t Bytes(const std::vector<std::vector<T>>& vecs)
+  {
+    size_t num_bytes = vecs.capacity() * sizeof(std::vector<T>);
+    for (const auto& vec : vecs)
+      num_bytes += Bytes(vec);
+    return num_bytes;
+  }
+};
+
+} // namespace chi
+
+#endif // CHITECH_CHI_MEMORY_REGISTRY_H
@@ -0,0 +1,397 @@
+#include "chi_perf_region.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+#include "mpi/chi_mpi_utils_allgather_strings.h"
+#include "utils/chi_timer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+//###################################################################
+/**Access to the singleton.*/
+chi::PerfRegistry& chi::PerfRegistry::GetInstance() noexcept
+{
+  static PerfRegistry instance;
+  return instance;
+}
+
+//###################################################################
+/**Creates the registry with only the root region. The calling thread
+ * becomes the thread whose regions are recorded.*/
+chi::PerfRegistry::PerfRegistry() :
+  owner_thread_(std::this_thread::get_id())
+{
+  regions_.emplace_back();
+  regions_.back().name = "root";
+}
+
+//###################################################################
+/**Enters the region with the given name as a child of the active region,
+ * creating it on first use, and returns its id. Returns INVALID_REGION if
+ * called from a thread other than the owning thread.*/
+size_t chi::PerfRegistry::Enter(const std::string& name)
+{
+  if (std::this_thread::get_id() != owner_thread_) return INVALID_REGION;
+
+  size_t region_id;
+  const auto child_it = regions_[current_].children.find(name);
+  if (child_it != regions_[current_].children.end())
+    region_id = child_it->second;
+  else
+  {
+    region_id = regions_.size();
+
+    Region region;
+    region.name = name;
+    region.parent = current_;
+    if (current_ == 0)
+      region.path = name;
+    else
+    {
+      region.path = regions_[current_].path + "/" + name;
+      region.depth = regions_[current_].depth + 1;
+    }
+
+    regions_[current_].children[name] = region_id;
+    regions_.push_back(std::move(region));
+  }
+
+  Region& region = regions_[region_id];
+  ++region.num_calls;
+
+  const auto& counters = HardwareCounters::GetInstance();
+  if (counters.IsEnabled()) counters.Read(region.counter_start);
+
+  region.start_time = Clock::now();
+  current_ = region_id;
+
+  return region_id;
+}
+
+//###################################################################
+/**Leaves a region entered with Enter, accumulating its time and making
+ * its parent the active region. Invalid ids are ignored.*/
+void chi::PerfRegistry::Leave(size_t region_id)
+{
+  if (region_id == INVALID_REGION or region_id == 0 or
+      region_id >= regions_.size())
+    return;
+  if (std::this_thread::get_id() != owner_thread_) return;
+
+  Region& region = regions_[region_id];
+  region.total_time +=
+    std::chrono::duration<double>(Clock::now() - region.start_time).count();
+
+  const auto& counters = HardwareCounters::GetInstance();
+  if (counters.IsEnabled())
+  {
+    HardwareCounters::Values end_values;
+    counters.Read(end_values);
+    for (size_t c = 0; c < HardwareCounters::NUM_COUNTERS; ++c)
+      if (end_values[c] >= region.counter_start[c])
+        region.counter_totals[c] += end_values[c] - region.counter_start[c];
+  }
+
+  current_ = region.parent;
+}
+
+//###################################################################
+/**Returns the region with the given path, or nullptr.*/
+const chi::PerfRegistry::Region*
+  chi::PerfRegistry::FindRegion(const std::string& path) const
+{
+  for (size_t r = 1; r < regions_.size(); ++r)
+    if (regions_[r].path == path) return &regions_[r];
+  return nullptr;
+}
+
+//###################################################################
+/**Zeros the call counts and times of all regions. The region tree is kept
+ * so that regions active during the reset remain valid.*/
+void chi::PerfRegistry::Reset()
+{
+  for (auto& region : regions_)
+  {
+    region.num_calls = 0;
+    region.total_time = 0.0;
+    region.counter_totals.fill(0);
+  }
+}
+
+//###################################################################
+/**Builds a report of all regions across all locations. Must be called by
+ * all locations. For each region the report lists the maximum number of
+ * calls on any location, the min/avg/max inclusive time across locations,
+ * the imbalance (max/avg) and the average time as a percentage of the
+ * program time. Locations that never entered a region contribute zero.
+ *
+ * If hardware counters are enabled on any location, a second table lists
+ * the counts summed over locations with derived rates, and the JSON file
+ * holds the counts of every location.
+ *
+ * If a JSON file name is supplied, location 0 also writes the report data to
+ * that file. The report string is only populated on location 0.*/
+std::string chi::PerfRegistry::BuildReport(
+  const std::string& json_file_name/*=""*/) const
+{
+  const int num_locations = Chi::mpi.process_count;
+
+  //============================================= Gather all region paths
+  std::vector<std::string> local_paths;
+  for (size_t r = 1; r < regions_.size(); ++r)
+    local_paths.push_back(regions_[r].path);
+
+  //============================================= Order paths depth-first
+  // The separator sorts before any other character so that a region
+  // directly follows its parent, followed by its own children.
+  std::map<std::string, std::string> sorted_paths;
+  for (const auto& path : chi_mpi_utils::AllGatherStrings(local_paths))
+  {
+    std::string key = path;
+    std::replace(key.begin(), key.end(), '/', '\x01');
+    sorted_paths[key] = path;
+  }
+
+  std::vector<std::string> paths;
+  paths.reserve(sorted_paths.size());
+  for (const auto& key_path : sorted_paths)
+    paths.push_back(key_path.second);
+
+  //============================================= Reduce region data
+  std::map<std::string, size_t> local_region_ids;
+  for (size_t r = 1; r < regions_.size(); ++r)
+    local_region_ids[regions_[r].path] = r;
+
+  const size_t num_paths = paths.size();
+  std::vector<size_t> path_region_ids(num_paths, 0); //0 if not entered here
+  std::vector<double> times(num_paths, 0.0);
+  std::vector<double> calls(num_paths, 0.0);
+  for (size_t p = 0; p < num_paths; ++p)
+  {
+    const auto it = local_region_ids.find(paths[p]);
+    if (it == local_region_ids.end()) continue;
+    path_region_ids[p] = it->second;
+    times[p] = regions_[it->second].total_time;
+    calls[p] = static_cast<double>(regions_[it->second].num_calls);
+  }
+
+  const int count = static_cast<int>(num_paths);
+  std::vector<double> min_times(num_paths, 0.0);
+  std::vector<double> max_times(num_paths, 0.0);
+  std::vector<double> sum_times(num_paths, 0.0);
+  std::vector<double> max_calls(num_paths, 0.0);
+  MPI_Reduce(times.data(), min_times.data(), count,
+             MPI_DOUBLE, MPI_MIN, 0, Chi::mpi.comm);
+  MPI_Reduce(times.data(), max_times.data(), count,
+             MPI_DOUBLE, MPI_MAX, 0, Chi::mpi.comm);
+  MPI_Reduce(times.data(), sum_times.data(), count,
+             MPI_DOUBLE, MPI_SUM, 0, Chi::mpi.comm);
+  MPI_Reduce(calls.data(), max_calls.data(), count,
+             MPI_DOUBLE, MPI_MAX, 0, Chi::mpi.comm);
+
+  //============================================= Gather hardware counts
+  // Stored as [location][path][counter] on location 0
+  const size_t num_counters = HardwareCounters::NUM_COUNTERS;
+  int local_counting = HardwareCounters::GetInstance().IsEnabled() ? 1 : 0;
+  int any_counting = 0;
+  MPI_Allreduce(&local_counting,  //sendbuf
+                &any_counting,    //recvbuf
+                1, MPI_INT,       //count + datatype
+                MPI_LOR,          //operation
+                Chi::mpi.comm);   //communicator
+
+  std::vector<double> all_counts;
+  if (any_counting)
+  {
+    std::vector<double> local_counts(num_paths * num_counters, 0.0);
+    for (size_t p = 0; p < num_paths; ++p)
+    {
+      if (path_region_ids[p] == 0) continue;
+      const auto& region = regions_[path_region_ids[p]];
+      for (size_t c = 0; c < num_counters; ++c)
+        local_counts[p * num_counters + c] =
+          static_cast<double>(region.counter_totals[c]);
+    }
+
+    if (Chi::mpi.location_id == 0)
+      all_counts.assign(num_locations * num_paths * num_counters, 0.0);
+
+    const int count_size = static_cast<int>(num_paths * num_counters);
+    MPI_Gather(local_counts.data(),       //sendbuf
+               count_size, MPI_DOUBLE,    //sendcount + type
+               all_counts.data(),         //recvbuf
+               count_size, MPI_DOUBLE,    //recvcount + type
+               0, Chi::mpi.comm);         //root + communicator
+  }
+
+  if (Chi::mpi.location_id != 0) return "";
+
+  //============================================= Build report
+  const double program_time = Chi::program_timer.GetTime() / 1000.0;
+
+  std::vector<double> avg_times(num_paths, 0.0);
+  std::vector<double> imbalances(num_paths, 1.0);
+  for (size_t p = 0; p < num_paths; ++p)
+  {
+    avg_times[p] = sum_times[p] / num_locations;
+    if (avg_times[p] > 0.0) imbalances[p] = max_times[p] / avg_times[p];
+  }
+
+  auto PathName = [](const std::string& path)
+  {
+    const size_t depth = std::count(path.begin(), path.end(), '/');
+    const size_t name_start = path.find_last_of('/');
+    return std::string(2 * depth, ' ') +
+      (name_start == std::string::npos ? path : path.substr(name_start + 1));
+  };
+
+  auto Count = [&all_counts, num_paths, num_counters](int location,
+                                                      size_t path,
+                                                      size_t counter)
+  {
+    return all_counts[(location * num_paths + path) * num_counters + counter];
+  };
+
+  std::stringstream outstr;
+  outstr << "Performance regions (inclusive wall time in seconds across "
+         << num_locations << " locations, program time "
+         << program_time << " s)\n";
+
+  char buffer[200];
+  snprintf(buffer, 200, "%-44s %10s %11s %11s %11s %9s %8s\n",
+           "Region", "Max calls", "Min", "Avg", "Max", "Imbalance",
+           "%Program");
+  outstr << buffer;
+
+  for (size_t p = 0; p < num_paths; ++p)
+  {
+    const std::string name = PathName(paths[p]);
+
+    const double percentage =
+      program_time > 0.0 ? 100.0 * avg_times[p] / program_time : 0.0;
+
+    snprintf(buffer, 200, "%-44s %10.0f %11.4e %11.4e %11.4e %9.3f %8.2f\n",
+             name.c_str(), max_calls[p], min_times[p], avg_times[p],
+             max_times[p], imbalances[p], percentage);
+    outstr << buffer;
+  }
+
+  //============================================= Hardware counter report
+  if (any_counting)
+  {
+    typedef HardwareCounters HWC;
+    outstr << "\nHardware counters (summed over locations, IPC range over "
+              "locations, memory traffic estimated as 64 B per LLC miss, "
+              "rates per second of max time)\n";
+    snprintf(buffer, 200, "%-44s %11s %11s %6s %13s %11s %9s %9s %11s\n",
+             "Region", "Cycles", "Instr", "IPC", "IPC min-max",
+             "LLC misses", "Miss rate", "Est. GB/s", "Raw/s");
+    outstr << buffer;
+
+    for (size_t p = 0; p < num_paths; ++p)
+    {
+      double totals[HWC::NUM_COUNTERS] = {};
+      double min_ipc = 0.0, max_ipc = 0.0;
+      bool first = true;
+      for (int l = 0; l < num_locations; ++l)
+      {
+        for (size_t c = 0; c < num_counters; ++c)
+          totals[c] += Count(l, p, c);
+
+        const double cycles = Count(l, p, HWC::CYCLES);
+        if (cycles <= 0.0) continue;
+        const double ipc = Count(l, p, HWC::INSTRUCTIONS) / cycles;
+        min_ipc = first ? ipc : std::min(min_ipc, ipc);
+        max_ipc = first ? ipc : std::max(max_ipc, ipc);
+        first = false;
+      }
+
+      const double cycles = totals[HWC::CYCLES];
+      const double references = totals[HWC::LLC_REFERENCES];
+      const double misses = totals[HWC::LLC_MISSES];
+      const double time = max_times[p];
+
+      const double ipc =
+        cycles > 0.0 ? totals[HWC::INSTRUCTIONS] / cycles : 0.0;
+      const double miss_rate = references > 0.0 ? misses / references : 0.0;
+      const double gbps = time > 0.0 ? 64.0 * misses / time / 1.0e9 : 0.0;
+      const double raw_rate = time > 0.0 ? totals[HWC::RAW] / time : 0.0;
+
+      char ipc_range[32];
+      snprintf(ipc_range, 32, "%.2f-%.2f", min_ipc, max_ipc);
+
+      snprintf(buffer, 200,
+               "%-44s %11.4e %11.4e %6.2f %13s %11.4e %9.4f %9.3f %11.4e\n",
+               PathName(paths[p]).c_str(), cycles, totals[HWC::INSTRUCTIONS],
+               ipc, ipc_range, misses, miss_rate, gbps, raw_rate);
+      outstr << buffer;
+    }
+  }
+
+  //============================================= Write JSON
+  if (not json_file_name.empty())
+  {
+    std::ofstream file(json_file_name);
+    if (not file.is_open())
+      Chi::log.Log0Warning() << "PerfRegistry: Could not open file \""
+                             << json_file_name << "\" for writing.";
+    else
+    {
+      file << "{\n"
+           << "  \"num_locations\": " << num_locations << ",\n"
+           << "  \"program_time\": " << program_time << ",\n"
+           << "  \"regions\": [";
+      for (size_t p = 0; p < num_paths; ++p)
+      {
+        std::string path;
+        for (const char c : paths[p])
+        {
+          if (c == '"' or c == '\\') path += '\\';
+          path += c;
+        }
+
+        file << (p == 0 ? "\n" : ",\n")
+             << "    {\"path\": \"" << path << "\", "
+             << "\"max_calls\": " << static_cast<uint64_t>(max_calls[p]) << ", "
+             << "\"min_time\": " << min_times[p] << ", "
+             << "\"avg_time\": " << avg_times[p] << ", "
+             << "\"max_time\": " << max_times[p] << ", "
+             << "\"imbalance\": " << imbalances[p];
+
+        if (any_counting)
+        {
+          file << ", \"hardware_counters\": {";
+          for (size_t c = 0; c < num_counters; ++c)
+          {
+            const auto counter = static_cast<HardwareCounters::Counter>(c);
+            file << (c == 0 ? "" : ", ") << "\""
+                 << HardwareCounters::Name(counter) << "\": [";
+            for (int l = 0; l < num_locations; ++l)
+              file << (l == 0 ? "" : ", ")
+                   << static_cast<uint64_t>(Count(l, p, c));
+            file << "]";
+          }
+          file << "}";
+        }
+        file << "}";
+      }
+      file << "\n  ]\n}\n";
+    }
+  }
+
+  return outstr.str();
+}
+
+//###################################################################
+/**Builds the report with BuildReport and prints it on location 0. Must be
+ * called by all locations.*/
+void chi::PerfRegistry::PrintReport(
+  const std::string& json_file_name/*=""*/) const
+{
+  const std::string report = BuildReport(json_file_name);
+  Chi::log.Log() << "\n" << report;
+}
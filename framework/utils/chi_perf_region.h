@@ -0,0 +1,125 @@
+#ifndef CHITECH_CHI_PERF_REGION_H
+#define CHITECH_CHI_PERF_REGION_H
+
+#include "chi_hw_counters.h"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace chi
+{
+
+// ###################################################################
+/**Registry of hierarchical performance regions.
+ *
+ * Regions form a tree. Entering a region while another is active makes it a
+ * child of the active region, so the same region name can appear under
+ * different parents, e.g., `Solver::Execute/LBS::WGSolve/Sweep`. For each
+ * region the registry accumulates, on this location, the number of calls and
+ * the inclusive wall time.
+ *
+ * Regions are normally timed with the scoped PerfRegion object. Only regions
+ * entered on the thread that created the registry are recorded. Region names
+ * should not contain `/` since it separates the names in a region path.
+ *
+ * If HardwareCounters are enabled, each region also accumulates the
+ * hardware counts between its entry and exit.
+ *
+ * A report with the min/avg/max time across locations is printed at exit
+ * when ChiTech is run with `--perf_report` or `--perf_report_json=FILE`, and
+ * on demand with the lua function chiPerfRegionsReport.*/
+class PerfRegistry
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /**Data of one region on this location.*/
+  struct Region
+  {
+    std::string name;
+    std::string path;   ///< Names from the root separated by `/`
+    size_t parent = 0;
+    size_t depth = 0;   ///< Number of ancestors excluding the root
+    std::map<std::string, size_t> children;
+
+    size_t num_calls = 0;
+    double total_time = 0.0; ///< Inclusive time in seconds
+    Clock::time_point start_time;
+
+    /**Inclusive hardware counts, only accumulated while
+     * HardwareCounters are enabled.*/
+    HardwareCounters::Values counter_totals = {};
+    HardwareCounters::Values counter_start = {};
+  };
+
+  static constexpr size_t INVALID_REGION = static_cast<size_t>(-1);
+
+private:
+  /**regions_[0] is the root and is never timed.*/
+  std::vector<Region> regions_;
+  size_t current_ = 0;
+  const std::thread::id owner_thread_;
+
+  PerfRegistry();
+
+public:
+  static PerfRegistry& GetInstance() noexcept;
+
+  PerfRegistry(const PerfRegistry&) = delete;
+  PerfRegistry& operator=(const PerfRegistry&) = delete;
+
+  size_t Enter(const std::string& name);
+  void Leave(size_t region_id);
+
+  /**All regions on this location. Index 0 is the root.*/
+  const std::vector<Region>& Regions() const { return regions_; }
+
+  /**Returns the region with the given path, or nullptr.*/
+  const Region* FindRegion(const std::string& path) const;
+
+  void Reset();
+
+  std::string BuildReport(const std::string& json_file_name = "") const;
+  void PrintReport(const std::string& json_file_name = "") const;
+};
+
+// ###################################################################
+/**Times a performance region for the lifetime of the object.
+ *
+ * \code
+ * {
+ *   chi::PerfRegion perf_region("Sweep");
+ *   //... work
+ * }
+ * \endcode*/
+class PerfRegion
+{
+private:
+  size_t region_id_;
+
+public:
+  explicit PerfRegion(const std::string& name)
+    : region_id_(PerfRegistry::GetInstance().Enter(name))
+  {
+  }
+
+  PerfRegion(const PerfRegion&) = delete;
+  PerfRegion& operator=(const PerfRegion&) = delete;
+
+  /**Ends the region before the object goes out of scope.*/
+  void Stop()
+  {
+    PerfRegistry::GetInstance().Leave(region_id_);
+    region_id_ = PerfRegistry::INVALID_REGION;
+  }
+
+  ~PerfRegion() { PerfRegistry::GetInstance().Leave(region_id_); }
+};
+
+} // namespace chi
+
+#endif // CHITECH_CHI_PERF_REGION_H
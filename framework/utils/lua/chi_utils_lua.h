@@ -0,0 +1,13 @@
+#ifndef CHITECH_CHI_UTILS_LUA_H
+#define CHITECH_CHI_UTILS_LUA_H
+
+#include "chi_lua.h"
+
+namespace chi_utils::lua_utils
+{
+int chiPerfRegionsReport(lua_State* L);
+int chiPerfRegionsReset(lua_State* L);
+int chiMemoryReport(lua_State* L);
+} // namespace chi_utils::lua_utils
+
+#endif // CHITECH_CHI_UTILS_LUA_H
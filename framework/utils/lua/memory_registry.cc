@@ -0,0 +1,41 @@
+#include "chi_lua.h"
+
+#include "chi_runtime.h"
+#include "utils/chi_memory_registry.h"
+
+#include "chi_utils_lua.h"
+#include "console/chi_console.h"
+
+namespace chi_utils::lua_utils
+{
+
+RegisterLuaFunctionAsIs(chiMemoryReport);
+
+// ###################################################################
+/**Prints the memory registered by the major data structures, e.g., mesh
+ * cells, cell mappings, flux vectors, FLUDS buffers and DSA matrices, with
+ * the min/avg/max over locations and the global sum of each category. Must
+ * be called by all locations.
+
+\param per_location bool Optional. If true, also lists every category for
+                         every location. Default: false.
+
+\ingroup LuaLogging*/
+int chiMemoryReport(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+
+  bool per_location = false;
+  if (num_args >= 1)
+  {
+    LuaCheckBoolValue(fname, L, 1);
+    per_location = lua_toboolean(L, 1);
+  }
+
+  chi::MemoryRegistry::GetInstance().PrintReport(per_location);
+
+  return 0;
+}
+
+} // namespace chi_utils::lua_utils
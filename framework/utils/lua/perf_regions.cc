@@ -0,0 +1,53 @@
+#include "chi_lua.h"
+
+#include "chi_runtime.h"
+#include "utils/chi_perf_region.h"
+
+#include "chi_utils_lua.h"
+#include "console/chi_console.h"
+
+namespace chi_utils::lua_utils
+{
+
+RegisterLuaFunctionAsIs(chiPerfRegionsReport);
+RegisterLuaFunctionAsIs(chiPerfRegionsReset);
+
+// ###################################################################
+/**Prints a report of the performance regions timed so far, with the
+ * min/avg/max time across locations, the maximum number of calls and the
+ * imbalance of each region. Must be called by all locations.
+
+\param json_file_name string Optional. If supplied, location 0 also writes
+                             the report to this JSON file.
+
+\ingroup LuaLogging*/
+int chiPerfRegionsReport(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+
+  std::string json_file_name;
+  if (num_args >= 1)
+  {
+    LuaCheckStringValue(fname, L, 1);
+    json_file_name = lua_tostring(L, 1);
+  }
+
+  chi::PerfRegistry::GetInstance().PrintReport(json_file_name);
+
+  return 0;
+}
+
+// ###################################################################
+/**Zeros the call counts and times of all performance regions, e.g., to
+ * exclude initialization from a subsequent report.
+
+\ingroup LuaLogging*/
+int chiPerfRegionsReset(lua_State* L)
+{
+  chi::PerfRegistry::GetInstance().Reset();
+
+  return 0;
+}
+
+} // namespace chi_utils::lua_utils
@@ -5,6 +5,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_memory_registry.h"
 
 namespace lbs::acceleration
 {
@@ -44,6 +45,7 @@ DiffusionSolver::~DiffusionSolver()
   MatDestroy(&A_);
   VecDestroy(&rhs_);
   KSPDestroy(&ksp_);
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
 }
 
 // ###################################################################
@@ -7,6 +7,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_memory_registry.h"
 
 // ###################################################################
 /**Initializes the diffusion solver. This involves creating the
@@ -57,6 +58,24 @@ void lbs::acceleration::DiffusionSolver::Initialize()
   Chi::log.Log() << "Done vector creation";
   Chi::mpi.Barrier();
 
+  //============================================= Register memory
+  // The AIJ storage is estimated from the preallocated non-zeros. The
+  // hierarchy built by the preconditioner is not included.
+  MatInfo info;
+  MatGetInfo(A_, MAT_LOCAL, &info);
+  const size_t num_nz = static_cast<size_t>(info.nz_allocated);
+  const size_t num_rows = static_cast<size_t>(num_local_dofs_);
+  const size_t num_ghosts =
+    requires_ghosts_ ? sdm_.GetNumGhostDOFs(uk_man_) : 0;
+
+  typedef chi::MemoryRegistry MemReg;
+  auto& mem_registry = MemReg::GetInstance();
+  mem_registry.Set(MemReg::DSA_MATRICES, this,
+                   num_nz * (sizeof(PetscScalar) + sizeof(PetscInt)) +
+                   2 * (num_rows + 1) * sizeof(PetscInt));
+  mem_registry.Set(MemReg::PETSC_VECTORS, this,
+                   (num_rows + num_ghosts) * sizeof(PetscScalar));
+
   //============================================= Create KSP
   KSPCreate(PETSC_COMM_WORLD, &ksp_);
   KSPSetOptionsPrefix(ksp_, text_name_.c_str());
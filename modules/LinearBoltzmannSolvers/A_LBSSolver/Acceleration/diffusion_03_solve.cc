@@ -7,6 +7,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 // ###################################################################
 /**Solves the system and stores the local solution in the vector provide.
@@ -17,6 +18,8 @@
 void lbs::acceleration::DiffusionSolver::Solve(
   std::vector<double>& solution, bool use_initial_guess /*=false*/)
 {
+  chi::PerfRegion perf_region("DSA::Solve");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
   Vec x;
   VecDuplicate(rhs_, &x);
@@ -104,6 +107,8 @@ void lbs::acceleration::DiffusionSolver::Solve(
 void lbs::acceleration::DiffusionSolver::Solve(
   Vec petsc_solution, bool use_initial_guess /*=false*/)
 {
+  chi::PerfRegion perf_region("DSA::Solve");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::Solve";
   Vec x;
   VecDuplicate(rhs_, &x);
@@ -7,6 +7,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 #include "utils/chi_timer.h"
 
 #define DefaultBCDirichlet                                                     \
@@ -22,6 +23,8 @@ namespace lbs::acceleration
  * the routines used in the production versions.*/
 void DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 {
+  chi::PerfRegion perf_region("DSA::AssembleAand_b");
+
   const size_t num_local_dofs = sdm_.GetNumLocalAndGhostDOFs(uk_man_);
   ChiInvalidArgumentIf(q_vector.size() != num_local_dofs,
                        std::string("q_vector size mismatch. ") +
@@ -12,6 +12,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 #include "utils/chi_timer.h"
 #include "console/chi_console.h"
 
@@ -27,6 +28,8 @@
 void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
   const std::vector<double>& q_vector)
 {
+  chi::PerfRegion perf_region("DSA::Assemble_b");
+
   const size_t num_local_dofs = sdm_.GetNumLocalAndGhostDOFs(uk_man_);
   ChiInvalidArgumentIf(q_vector.size() != num_local_dofs,
                        std::string("q_vector size mismatch. ") +
@@ -178,6 +181,8 @@ void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(
  * the routines used in the production versions.*/
 void lbs::acceleration::DiffusionPWLCSolver::Assemble_b(Vec petsc_q_vector)
 {
+  chi::PerfRegion perf_region("DSA::Assemble_b");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "Assemble_b";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
@@ -10,6 +10,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 #include "utils/chi_timer.h"
 #include "console/chi_console.h"
 
@@ -21,6 +22,8 @@
 void lbs::acceleration::DiffusionMIPSolver::
   AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
 {
+  chi::PerfRegion perf_region("DSA::AssembleAand_b");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "AssembleAand_b_wQpoints";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
@@ -112,7 +115,7 @@ void lbs::acceleration::DiffusionMIPSolver::
 
         if (face.has_neighbor_)
         {
-          const auto&  adj_cell         = grid_.cells[face.neighbor_id_];
+          const auto&  adj_cell         = grid_.cells.GetNeighbor(face);
           const auto&  adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
           const auto   ac_nodes         = adj_cell_mapping.GetNodeLocations();
           const size_t acf              = Grid::MapCellFace(cell, adj_cell, f);
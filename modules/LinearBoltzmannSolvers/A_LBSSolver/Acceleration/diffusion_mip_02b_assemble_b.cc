@@ -10,6 +10,7 @@
 
 #include "chi_runtime.h" //TODO:Remove
 #include "chi_log.h"     //TODO:Remove
+#include "utils/chi_perf_region.h"
 #include "utils/chi_timer.h"
 #include "console/chi_console.h"
 
@@ -21,6 +22,8 @@
 void lbs::acceleration::DiffusionMIPSolver::
   Assemble_b_wQpoints(const std::vector<double>& q_vector)
 {
+  chi::PerfRegion perf_region("DSA::Assemble_b");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "AssembleAand_b_wQpoints";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
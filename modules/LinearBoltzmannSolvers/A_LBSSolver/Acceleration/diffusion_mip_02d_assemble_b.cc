@@ -12,6 +12,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 #include "utils/chi_timer.h"
 #include "console/chi_console.h"
 
@@ -23,6 +24,8 @@
 void lbs::acceleration::DiffusionMIPSolver::
   Assemble_b(const std::vector<double>& q_vector)
 {
+  chi::PerfRegion perf_region("DSA::Assemble_b");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "Assemble_b";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
@@ -171,6 +174,8 @@ void lbs::acceleration::DiffusionMIPSolver::
 void lbs::acceleration::DiffusionMIPSolver::
 Assemble_b(Vec petsc_q_vector)
 {
+  chi::PerfRegion perf_region("DSA::Assemble_b");
+
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "Assemble_b";
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
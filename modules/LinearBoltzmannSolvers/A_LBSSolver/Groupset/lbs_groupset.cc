@@ -63,6 +63,29 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
                               30,
                               "If this inner linear solver is gmres, sets the"
                               " number of iterations before a restart occurs.");
+  params.AddOptionalParameter(
+    "krylov_recycle_size",
+    2,
+    "If this inner linear solver is lgmres or dgmres, sets the number of "
+    "Krylov vectors retained across restarts (lgmres augmentation vectors) or "
+    "the number of approximate eigenvectors deflated (dgmres). For dgmres the "
+    "deflation space is retained between successive solves of the groupset, "
+    "e.g., across power iteration outers.");
+  params.AddOptionalParameter(
+    "richardson_group_masking",
+    false,
+    "If true and the inner linear solver is classic_richardson, the groupset "
+    "is solved with a source iteration loop instead of PETSc's richardson. "
+    "The loop converges when the point-wise relative change of the scalar "
+    "flux is below l_abs_tol, and groups that satisfy it are dropped from "
+    "subsequent sweeps until the next periodic re-check. Masking is not "
+    "applied when the groupset has lagged angular fluxes (cycles or opposing "
+    "reflecting boundaries). Ignored when the groupset uses WGDSA or TGDSA.");
+  params.AddOptionalParameter(
+    "richardson_recheck_interval",
+    10,
+    "Number of classic_richardson iterations after which all masked groups "
+    "are swept again to re-check their convergence.");
 
   params.AddOptionalParameter(
     "allow_cycles",
@@ -115,13 +138,19 @@ chi::InputParameters lbs::LBSGroupset::GetInputParameters()
 
   params.ConstrainParameterRange(
     "inner_linear_method",
-    AllowableRangeList::New({"richardson", "gmres", "bicgstab"}));
+    AllowableRangeList::New(
+      {"classic_richardson", "richardson", "gmres", "bicgstab", "lgmres",
+       "dgmres"}));
 
   params.ConstrainParameterRange("l_abs_tol",
                                  AllowableRangeLowLimit::New(1.0e-18));
   params.ConstrainParameterRange("l_max_its", AllowableRangeLowLimit::New(0));
   params.ConstrainParameterRange("gmres_restart_interval",
                                  AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("krylov_recycle_size",
+                                 AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("richardson_recheck_interval",
+                                 AllowableRangeLowLimit::New(1));
 
   // clang-format on
 
@@ -185,16 +214,27 @@ lbs::LBSGroupset::LBSGroupset(const chi::InputParameters& params,
   // ============================================ Inner solver
   const auto inner_linear_method =
     params.GetParamValue<std::string>("inner_linear_method");
-  if (inner_linear_method == "richardson")
+  if (inner_linear_method == "classic_richardson")
+    iterative_method_ = IterativeMethod::CLASSICRICHARDSON;
+  else if (inner_linear_method == "richardson")
     iterative_method_ = IterativeMethod::KRYLOV_RICHARDSON;
   else if (inner_linear_method == "gmres")
     iterative_method_ = IterativeMethod::KRYLOV_GMRES;
   else if (inner_linear_method == "bicgstab")
     iterative_method_ = IterativeMethod::KRYLOV_BICGSTAB;
+  else if (inner_linear_method == "lgmres")
+    iterative_method_ = IterativeMethod::KRYLOV_LGMRES;
+  else if (inner_linear_method == "dgmres")
+    iterative_method_ = IterativeMethod::KRYLOV_DGMRES;
 
   allow_cycles_ = params.GetParamValue<bool>("allow_cycles");
   residual_tolerance_ = params.GetParamValue<double>("l_abs_tol");
   max_iterations_ = params.GetParamValue<int>("l_max_its");
+  krylov_recycle_size_ = params.GetParamValue<int>("krylov_recycle_size");
+  richardson_group_masking_ =
+    params.GetParamValue<bool>("richardson_group_masking");
+  richardson_recheck_interval_ =
+    params.GetParamValue<int>("richardson_recheck_interval");
 
   // ============================================ Misc.
   log_sweep_events_ = params.GetParamValue<bool>("log_sweep_events");
@@ -53,6 +53,13 @@ public:
   double               residual_tolerance_ = 1.0e-6;
   int                  max_iterations_ = 200;
   int                  gmres_restart_intvl_ = 30;
+  int                  krylov_recycle_size_ = 2;
+  bool                 richardson_group_masking_ = false;
+  int                  richardson_recheck_interval_ = 10;
+
+  /**Groupset relative flags used by classic richardson to mask converged
+   * groups out of the sweeps. Empty means all groups are active.*/
+  std::vector<bool>    group_active_flags_;
 
   bool                 allow_cycles_ = false;
   bool                 log_sweep_events_ = false;
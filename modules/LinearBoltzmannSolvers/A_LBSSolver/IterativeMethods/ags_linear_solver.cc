@@ -1,6 +1,7 @@
 #include "ags_linear_solver.h"
 
 #include "A_LBSSolver/lbs_solver.h"
+#include "wgs_context.h"
 
 #include "math/PETScUtils/petsc_utils.h"
 #include "math/LinearSolver/linear_matrix_action_Ax.h"
@@ -9,6 +10,8 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
+#include "utils/chi_perf_region.h"
 
 #include <iomanip>
 
@@ -16,6 +19,9 @@
 
 #define GetAGSContextPtr(x) \
         std::dynamic_pointer_cast<AGSContext<Mat,Vec,KSP>>(x)
+
+#define GetGSContextPtr(x) \
+        std::dynamic_pointer_cast<WGSContext<Mat,Vec,KSP>>(x)
 namespace lbs
 {
 
@@ -76,6 +82,8 @@ void AGSLinearSolver<Mat,Vec,KSP>::SetInitialGuess()
 template<>
 void AGSLinearSolver<Mat,Vec,KSP>::Solve()
 {
+  chi::PerfRegion perf_region("LBS::AGSolve");
+
   auto ags_context_ptr = GetAGSContextPtr(context_ptr_);
   auto& lbs_solver = ags_context_ptr->lbs_solver_;
 
@@ -91,15 +99,72 @@ void AGSLinearSolver<Mat,Vec,KSP>::Solve()
   //and for keigen-value problems
   const auto saved_qmoms = lbs_solver.QMomentsLocal();
 
+  const bool block_jacobi = lbs_solver.Options().ags_iteration_type ==
+                            AGSIterationType::BLOCK_JACOBI;
+  const size_t energy_color = Chi::mpi.energy_color;
+  const size_t num_energy_colors = Chi::mpi.num_energy_colors;
+
   for (int iter = 0; iter < tolerance_options_.maximum_iterations; ++iter)
   {
 
     lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_old,phi);
 
-    for (auto& solver : ags_context_ptr->sub_solvers_list_)
+    if (not block_jacobi)
+      for (auto& solver : ags_context_ptr->sub_solvers_list_)
+      {
+        solver->Setup();
+        solver->Solve();
+      }
+    else
     {
-      solver->Setup();
-      solver->Solve();
+      //=================================== Every groupset sees the fluxes
+      //                                    of the previous iteration.
+      //                                    Each energy communicator solves
+      //                                    its own groupsets and the
+      //                                    results are gathered in a
+      //                                    separate vector.
+      const auto phi_prev_iter = lbs_solver.PhiOldLocal();
+      std::vector<double> phi_solved(phi_prev_iter.size(), 0.0);
+      size_t gs = 0;
+      for (auto& solver : ags_context_ptr->sub_solvers_list_)
+      {
+        if (gs++ % num_energy_colors != energy_color) continue;
+
+        auto gs_context_ptr = GetGSContextPtr(solver->GetContext());
+        ChiLogicalErrorIf(not gs_context_ptr, "Casting failure");
+
+        lbs_solver.PhiOldLocal() = phi_prev_iter;
+
+        solver->Setup();
+        solver->Solve();
+
+        lbs_solver.GSScopedCopyPrimarySTLvectors(gs_context_ptr->groupset_,
+                                                 lbs_solver.PhiOldLocal(),
+                                                 phi_solved);
+      }
+
+      //=================================== Exchange the cross-group
+      //                                    sources. The energy
+      //                                    communicators have identical
+      //                                    partitions, hence identical
+      //                                    local layouts.
+      if (num_energy_colors > 1)
+        MPI_Allreduce(MPI_IN_PLACE,                         //sendbuf
+                      phi_solved.data(),                    //recvbuf
+                      static_cast<int>(phi_solved.size()),  //count
+                      MPI_DOUBLE, MPI_SUM,                  //type + op
+                      Chi::mpi.energy_comm);                //communicator
+
+      auto phi_jacobi = phi_prev_iter;
+      for (auto& solver : ags_context_ptr->sub_solvers_list_)
+      {
+        auto gs_context_ptr = GetGSContextPtr(solver->GetContext());
+        lbs_solver.GSScopedCopyPrimarySTLvectors(gs_context_ptr->groupset_,
+                                                 phi_solved,
+                                                 phi_jacobi);
+      }
+      lbs_solver.PhiOldLocal() = phi_jacobi;
+      lbs_solver.PhiNewLocal() = phi_jacobi;
     }
 
     lbs_solver.SetGroupScopedPETScVecFromPrimarySTLvector(gid_i,gid_f,x_,phi);
@@ -18,6 +18,10 @@ namespace lbs
     KRYLOV_GMRES_CYCLES      = 8, ///< GMRES with Cycles support
     KRYLOV_BICGSTAB          = 9, ///< BiCGStab iterative algorithm
     KRYLOV_BICGSTAB_CYCLES   = 10,///< BiCGStab with Cycles support
+    KRYLOV_LGMRES            = 11,///< Augmented (recycling) GMRES
+    KRYLOV_LGMRES_CYCLES     = 12,///< Augmented GMRES with Cycles support
+    KRYLOV_DGMRES            = 13,///< Deflated (recycling) GMRES
+    KRYLOV_DGMRES_CYCLES     = 14,///< Deflated GMRES with Cycles support
   };
 
   inline std::string IterativeMethodPETScName(IterativeMethod it_method)
@@ -35,6 +39,10 @@ namespace lbs
       case IterativeMethod::KRYLOV_GMRES_CYCLES:      return "gmres";
       case IterativeMethod::KRYLOV_BICGSTAB:
       case IterativeMethod::KRYLOV_BICGSTAB_CYCLES:   return "bcgs";
+      case IterativeMethod::KRYLOV_LGMRES:
+      case IterativeMethod::KRYLOV_LGMRES_CYCLES:     return "lgmres";
+      case IterativeMethod::KRYLOV_DGMRES:
+      case IterativeMethod::KRYLOV_DGMRES_CYCLES:     return "dgmres";
     }
     return "";
   }
@@ -8,6 +8,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 #include "utils/chi_timer.h"
 
@@ -32,6 +33,21 @@ void WGSLinearSolver<Mat, Vec, KSP>::PreSetupCallback()
   gs_context_ptr->PreSetupCallback();
 }
 
+/**Sets the options of the recycling Krylov methods. Since the KSP object
+ * persists across solves, the dgmres deflation space is carried over from
+ * one right-hand side to the next.*/
+template<>
+void WGSLinearSolver<Mat, Vec, KSP>::SetOptions()
+{
+  auto gs_context_ptr = GetGSContextPtr(context_ptr_);
+  const auto& groupset = gs_context_ptr->groupset_;
+
+  if (iterative_method_ == "lgmres")
+    KSPLGMRESSetAugDim(solver_, groupset.krylov_recycle_size_);
+  else if (iterative_method_ == "dgmres")
+    KSPDGMRESSetEigen(solver_, groupset.krylov_recycle_size_);
+}
+
 template<>
 void WGSLinearSolver<Mat, Vec, KSP>::SetConvergenceTest()
 {
@@ -98,6 +114,10 @@ void WGSLinearSolver<Mat, Vec, KSP>::PreSolveCallback()
 {
   auto gs_context_ptr = GetGSContextPtr(context_ptr_);
 
+  //Tolerances can change between solves, e.g., when an executor
+  //adapts the inner tolerances
+  this->ApplyToleranceOptions();
+
   gs_context_ptr->PreSolveCallback();
 }
 
@@ -192,6 +212,214 @@ template<> void WGSLinearSolver<Mat, Vec, KSP>::PostSolveCallback()
   gs_context_ptr->PostSolveCallback();
 }
 
+/**Source iterations with point-wise convergence checks on the scalar flux.
+ * Groups that converge are masked out of subsequent sweeps and are only
+ * swept again on periodic re-checks. The groupset is converged when all of
+ * its groups converge on an iteration where none were masked. If the
+ * maximum number of iterations is reached whilst groups are masked, a final
+ * sweep of all groups is performed so that the outflows and balance terms
+ * of every group are consistent.*/
+template<>
+void WGSLinearSolver<Mat, Vec, KSP>::SolveClassicRichardson()
+{
+  auto gs_context_ptr = GetGSContextPtr(context_ptr_);
+
+  auto& groupset   = gs_context_ptr->groupset_;
+  auto& lbs_solver = gs_context_ptr->lbs_solver_;
+
+  this->PreSolveCallback();
+
+  auto& q_moments = lbs_solver.QMomentsLocal();
+  auto& phi_old   = lbs_solver.PhiOldLocal();
+  auto& phi_new   = lbs_solver.PhiNewLocal();
+  saved_q_moments_local_ = q_moments;
+
+  const int scope = gs_context_ptr->lhs_src_scope_ |
+                    gs_context_ptr->rhs_src_scope_;
+  const double tolerance = tolerance_options_.residual_absolute;
+  const int max_iterations = tolerance_options_.maximum_iterations;
+
+  const int gsi = groupset.groups_.front().id_;
+  const size_t num_gs_groups = groupset.groups_.size();
+  const int num_moments = static_cast<int>(lbs_solver.NumMoments());
+
+  //============================================= Masking is not used with
+  //                                              lagged angular fluxes
+  bool masking = groupset.richardson_group_masking_;
+  if (groupset.angle_agg_ and
+      groupset.angle_agg_->GetNumDelayedAngularDOFs().second > 0)
+    masking = false;
+
+  auto& active = groupset.group_active_flags_;
+  active.assign(num_gs_groups, true);
+  bool full_iteration = true;
+  bool last_sweep_full = true;
+  bool converged = false;
+  size_t num_group_iterations = 0;
+  size_t num_masked_group_iterations = 0;
+
+  for (int k = 0; k < max_iterations; ++k)
+  {
+    last_sweep_full = full_iteration;
+
+    //========================================== Sweep with the full source
+    q_moments = saved_q_moments_local_;
+    gs_context_ptr->set_source_function_(groupset, q_moments, phi_old, scope);
+    gs_context_ptr->ApplyInverseTransportOperator(
+      k == 0 ? scope : (scope | KEEP_INCOMING_DELAYED_PSI));
+    if (groupset.angle_agg_) groupset.angle_agg_->SetDelayedPsiNew2Old();
+
+    //========================================== Point-wise change per group,
+    //                                           masked groups keep their
+    //                                           previous iterate
+    std::vector<double> local_change(num_gs_groups, 0.0);
+    for (const auto& transport_view : lbs_solver.GetCellTransportViews())
+      for (int i = 0; i < transport_view.NumNodes(); ++i)
+        for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+        {
+          const int g = gsi + static_cast<int>(gsg);
+          if (not active[gsg])
+          {
+            for (int m = 0; m < num_moments; ++m)
+            {
+              const size_t dof = transport_view.MapDOF(i, m, g);
+              phi_new[dof] = phi_old[dof];
+            }
+            continue;
+          }
+
+          const size_t dof = transport_view.MapDOF(i, 0, g);
+          const double delta = std::fabs(phi_new[dof] - phi_old[dof]);
+          const double change = std::fabs(phi_new[dof]) > 1.0e-16
+                                  ? delta / std::fabs(phi_new[dof])
+                                  : delta;
+          local_change[gsg] = std::max(local_change[gsg], change);
+        }
+
+    std::vector<double> change(num_gs_groups, 0.0);
+    MPI_Allreduce(local_change.data(),             // sendbuf
+                  change.data(),                   // recvbuf
+                  static_cast<int>(num_gs_groups), // count
+                  MPI_DOUBLE,                      // datatype
+                  MPI_MAX,                         // operation
+                  Chi::mpi.comm);                  // comm
+
+    lbs_solver.GSScopedCopyPrimarySTLvectors(groupset,
+                                              PhiSTLOption::PHI_NEW,
+                                              PhiSTLOption::PHI_OLD);
+
+    //========================================== Convergence check
+    double max_change = 0.0;
+    size_t num_active = 0;
+    for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+      if (active[gsg])
+      {
+        max_change = std::max(max_change, change[gsg]);
+        ++num_active;
+      }
+    converged = full_iteration and max_change < tolerance;
+    num_group_iterations += num_gs_groups;
+    num_masked_group_iterations += num_gs_groups - num_active;
+
+    if (gs_context_ptr->log_info_)
+    {
+      std::stringstream iter_info;
+      iter_info << Chi::program_timer.GetTimeString() << " "
+                << "WGS groups [" << groupset.groups_.front().id_ << "-"
+                << groupset.groups_.back().id_ << "]"
+                << " Iteration " << std::setw(5) << k
+                << " Point-wise change " << std::setw(9) << max_change
+                << " Active groups " << num_active << "/" << num_gs_groups;
+      if (converged) iter_info << " CONVERGED\n";
+      Chi::log.Log() << iter_info.str() << std::endl;
+    }
+
+    if (converged) break;
+
+    //========================================== Update the mask. All groups
+    //                                           are re-checked periodically
+    //                                           and when all are masked.
+    const bool recheck = (k + 1) % groupset.richardson_recheck_interval_ == 0;
+    size_t num_masked = 0;
+    for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+    {
+      if (masking and not recheck and active[gsg] and change[gsg] < tolerance)
+        active[gsg] = false;
+      else if (recheck)
+        active[gsg] = true;
+      if (not active[gsg]) ++num_masked;
+    }
+    if (num_masked == num_gs_groups) active.assign(num_gs_groups, true);
+    full_iteration = num_masked == 0 or num_masked == num_gs_groups;
+  }//for k
+
+  //============================================= Final sweep of all groups
+  if (not converged and not last_sweep_full)
+  {
+    active.assign(num_gs_groups, true);
+
+    q_moments = saved_q_moments_local_;
+    gs_context_ptr->set_source_function_(groupset, q_moments, phi_old, scope);
+    gs_context_ptr->ApplyInverseTransportOperator(
+      scope | KEEP_INCOMING_DELAYED_PSI);
+    if (groupset.angle_agg_) groupset.angle_agg_->SetDelayedPsiNew2Old();
+
+    lbs_solver.GSScopedCopyPrimarySTLvectors(groupset,
+                                              PhiSTLOption::PHI_NEW,
+                                              PhiSTLOption::PHI_OLD);
+
+    if (gs_context_ptr->log_info_)
+      Chi::log.Log() << Chi::program_timer.GetTimeString() << " "
+                     << "WGS groups [" << groupset.groups_.front().id_ << "-"
+                     << groupset.groups_.back().id_ << "]"
+                     << " Maximum iterations reached with masked groups. "
+                        "Final sweep of all groups.";
+  }
+
+  if (masking and gs_context_ptr->log_info_)
+  {
+    std::stringstream mask_info;
+    mask_info << "WGS groups [" << groupset.groups_.front().id_ << "-"
+              << groupset.groups_.back().id_ << "]";
+    if (num_masked_group_iterations > 0)
+      mask_info << " Group masking skipped " << num_masked_group_iterations
+                << " of " << num_group_iterations << " group iterations";
+    else
+      mask_info << " Group masking did not mask any group";
+    Chi::log.Log() << mask_info.str();
+  }
+
+  active.clear();
+
+  //============================================= Restore saved q_moms
+  q_moments = saved_q_moments_local_;
+
+  //============================================= Context specific callback
+  gs_context_ptr->PostSolveCallback();
+}
+
+/**Classic richardson iterations with group masking enabled use a source
+ * iteration loop instead of the PETSc solver, unless the groupset is
+ * preconditioned.*/
+template<>
+void WGSLinearSolver<Mat, Vec, KSP>::Solve()
+{
+  chi::PerfRegion perf_region("LBS::WGSolve");
+
+  auto gs_context_ptr = GetGSContextPtr(context_ptr_);
+  const auto& groupset = gs_context_ptr->groupset_;
+
+  const bool classic_richardson =
+    groupset.iterative_method_ == IterativeMethod::CLASSICRICHARDSON or
+    groupset.iterative_method_ == IterativeMethod::CLASSICRICHARDSON_CYCLES;
+
+  if (classic_richardson and groupset.richardson_group_masking_ and
+      not (groupset.apply_wgdsa_ or groupset.apply_tgdsa_))
+    SolveClassicRichardson();
+  else
+    chi_math::LinearSolver<Mat, Vec, KSP>::Solve();
+}
+
 template<> WGSLinearSolver<Mat, Vec, KSP>::~WGSLinearSolver()
 {
   MatDestroy(&A_);
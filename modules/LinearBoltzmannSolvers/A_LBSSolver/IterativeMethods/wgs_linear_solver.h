@@ -40,7 +40,7 @@ public:
 
 protected:
   void PreSetupCallback() override;         //Customized via context
-  /*virtual void SetOptions();*/
+  void SetOptions() override;               //Customized via groupset
   /*virtual void SetSolverContext();*/      //Generic
   void SetConvergenceTest() override;       //Generic
   /*virtual void SetMonitor();*/
@@ -59,8 +59,9 @@ protected:
   void SetRHS() override;                   //Generic + with context elements
   void SetInitialGuess() override;          //Generic
   void PostSolveCallback() override;        //Generic + with context elements
+  void SolveClassicRichardson();            //Generic + with context elements
 public:
-  /*virtual void Solve();*/
+  void Solve() override;
 
   virtual ~WGSLinearSolver() override;
 };
@@ -4,6 +4,9 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
+
+#include <chrono>
 
 namespace lbs
 {
@@ -34,6 +37,8 @@ void SourceFunction::operator()(LBSGroupset &groupset,
 {
   if (source_flags & NO_FLAGS_SET) return;
 
+  chi::PerfRegion perf_region("SetSource");
+
   const size_t source_event_tag = lbs_solver_.GetSourceEventTag();
   Chi::log.LogEvent(source_event_tag, chi::ChiLog::EventType::EVENT_BEGIN);
 
@@ -62,12 +67,17 @@ void SourceFunction::operator()(LBSGroupset &groupset,
   const auto& m_to_ell_em_map =
     groupset.quadrature_->GetMomentToHarmonicsIndexMap();
 
+  const bool measure_cell_costs = lbs_solver_.Options().measure_cell_costs;
+  typedef std::chrono::steady_clock Clock;
+
   //================================================== Loop over local cells
   const auto& grid = lbs_solver_.Grid();
   // Apply all nodal sources
   for (const auto& cell : grid.local_cells)
   {
     auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto cell_start_time =
+      measure_cell_costs ? Clock::now() : Clock::time_point();
     cell_volume_ = transport_view.Volume();
 
     //==================== Obtain xs
@@ -160,6 +170,10 @@ void SourceFunction::operator()(LBSGroupset &groupset,
         }//for g
       }//for m
     }//for dof i
+
+    if (measure_cell_costs)
+      transport_view.AddMeasuredCost(
+        std::chrono::duration<double>(Clock::now() - cell_start_time).count());
   }//for cell
 
   AddAdditionalSources(groupset, destination_q, phi_local, source_flags);
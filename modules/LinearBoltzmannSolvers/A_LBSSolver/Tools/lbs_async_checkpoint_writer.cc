@@ -0,0 +1,154 @@
+#include "lbs_async_checkpoint_writer.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+
+namespace
+{
+/**Writes all bytes at the given file offset, retrying partial writes.*/
+bool WriteFully(int fd, const char* data, uint64_t size, uint64_t offset)
+{
+  while (size > 0)
+  {
+    const ssize_t written = pwrite(fd, data, size, static_cast<off_t>(offset));
+    if (written <= 0) return false;
+    data += written;
+    size -= written;
+    offset += written;
+  }
+  return true;
+}
+
+/**Writes blocks of 8-byte values, merging blocks that are adjacent in the
+ * file into single writes.*/
+bool WriteBlocks(int fd,
+                 const lbs::CheckpointSnapshot::Blocks& blocks,
+                 const void* values)
+{
+  const auto* data = static_cast<const char*>(values);
+  const size_t num_blocks = blocks.lengths.size();
+
+  size_t b = 0;
+  while (b < num_blocks)
+  {
+    const uint64_t run_begin = blocks.displacements[b];
+    uint64_t run_end = run_begin;
+    for (; b < num_blocks and blocks.displacements[b] == run_end; ++b)
+      run_end += 8 * static_cast<uint64_t>(blocks.lengths[b]);
+
+    if (not WriteFully(fd, data, run_end - run_begin,
+                       blocks.base_offset + run_begin))
+      return false;
+    data += run_end - run_begin;
+  }
+  return true;
+}
+}//namespace
+
+//###################################################################
+/**Finishes a pending flush through Wait(), so that a checkpoint started
+ * just before shutdown still gets its final name. Collective, hence the
+ * owner must be destroyed on all locations, which holds for solvers
+ * released by Chi::Finalize. Should MPI already be finalized, the thread
+ * is only joined and the file is left under its temporary name.*/
+lbs::AsyncCheckpointWriter::~AsyncCheckpointWriter()
+{
+  if (not thread_.joinable()) return;
+
+  int mpi_finalized = 0;
+  MPI_Finalized(&mpi_finalized);
+  if (mpi_finalized)
+  {
+    thread_.join();
+    return;
+  }
+
+  Wait();
+}
+
+//###################################################################
+/**Starts flushing a snapshot in the background. The snapshot is swapped
+ * with the previously flushed buffer, which the caller can reuse as its
+ * next staging buffer. Blocks only if the previous flush has not
+ * finished. Collective.*/
+void lbs::AsyncCheckpointWriter::Start(CheckpointSnapshot& snapshot)
+{
+  Wait();
+
+  std::swap(in_flight_, snapshot);
+  flush_succeeded_ = false;
+  thread_ = std::thread([this]() { flush_succeeded_ = Flush(); });
+}
+
+//###################################################################
+/**Waits for the pending flush, if any, to finish and makes the
+ * checkpoint file visible under its final name. Returns true if there
+ * was no pending flush or if the checkpoint was written successfully.
+ * Collective.*/
+bool lbs::AsyncCheckpointWriter::Wait()
+{
+  if (not thread_.joinable()) return true;
+  thread_.join();
+
+  const std::string& file_name = in_flight_.file_name;
+
+  bool succeeded = true;
+  MPI_Allreduce(&flush_succeeded_,   //Send buffer
+                &succeeded,          //Recv buffer
+                1,                   //count
+                MPI_CXX_BOOL,        //Data type
+                MPI_LAND,            //Operation - Logical and
+                Chi::mpi.comm);      //Communicator
+
+  if (succeeded and Chi::mpi.location_id == 0)
+    succeeded = std::rename((file_name + ".tmp").c_str(),
+                            file_name.c_str()) == 0;
+  MPI_Bcast(&succeeded,     //buffer
+            1, MPI_CXX_BOOL,//count + datatype
+            0,              //root
+            Chi::mpi.comm); //communicator
+
+  if (succeeded)
+    Chi::log.Log() << "Successfully wrote restart data: " << file_name
+                   << " (asynchronous)";
+  else
+    Chi::log.Log0Error() << "Failed to write restart data: " << file_name;
+
+  return succeeded;
+}
+
+//###################################################################
+/**Writes the local part of the in-flight snapshot. Runs on the
+ * background thread.*/
+bool lbs::AsyncCheckpointWriter::Flush() const
+{
+  const std::string temp_file_name = in_flight_.file_name + ".tmp";
+
+  const int fd = open(temp_file_name.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd < 0) return false;
+
+  bool succeeded = true;
+  if (not in_flight_.preamble.empty())
+  {
+    //Writes of the other locations never extend beyond this size
+    succeeded &= ftruncate(fd, static_cast<off_t>(in_flight_.file_size)) == 0;
+    succeeded &= WriteFully(fd, in_flight_.preamble.data(),
+                            in_flight_.preamble.size(), 0);
+  }
+
+  succeeded &= WriteBlocks(fd, in_flight_.cell_table_blocks,
+                           in_flight_.cell_num_nodes.data());
+  for (size_t i = 0; i < in_flight_.item_blocks.size(); ++i)
+    succeeded &= WriteBlocks(fd, in_flight_.item_blocks[i],
+                             in_flight_.item_values[i].data());
+
+  succeeded &= fsync(fd) == 0;
+  succeeded &= close(fd) == 0;
+
+  return succeeded;
+}
@@ -0,0 +1,47 @@
+#ifndef CHITECH_LBS_ASYNC_CHECKPOINT_WRITER_H
+#define CHITECH_LBS_ASYNC_CHECKPOINT_WRITER_H
+
+#include "A_LBSSolver/lbs_checkpoint_file.h"
+
+#include <thread>
+
+namespace lbs
+{
+
+//###################################################################
+/**Flushes checkpoint snapshots to disk from a background thread.
+ *
+ * A snapshot is swapped with the writer's in-flight buffer, so that the
+ * caller's staging buffer and the in-flight buffer alternate without
+ * reallocation. Every location writes its blocks of the shared file with
+ * positional writes to `<file_name>.tmp`. No MPI calls are made on the
+ * background thread. Wait() joins the thread and, once all locations
+ * succeeded, renames the file so that an interrupted flush never replaces
+ * the previous checkpoint. The destructor also goes through Wait(), so a
+ * flush still pending when the owner is destroyed is finalized as well.*/
+class AsyncCheckpointWriter
+{
+private:
+  CheckpointSnapshot in_flight_;
+  std::thread thread_;
+  bool flush_succeeded_ = true;
+
+public:
+  AsyncCheckpointWriter() = default;
+  AsyncCheckpointWriter(const AsyncCheckpointWriter&) = delete;
+  AsyncCheckpointWriter& operator=(const AsyncCheckpointWriter&) = delete;
+
+  ~AsyncCheckpointWriter();
+
+  void Start(CheckpointSnapshot& snapshot);
+  bool Wait();
+
+  bool Pending() const { return thread_.joinable(); }
+
+private:
+  bool Flush() const;
+};
+
+}//namespace lbs
+
+#endif //CHITECH_LBS_ASYNC_CHECKPOINT_WRITER_H
@@ -1,6 +1,7 @@
 #include "lbs_solver.h"
 
 #include "chi_log.h"
+#include "utils/chi_memory_registry.h"
 
 #include "IterativeMethods/wgs_context.h"
 #include "math/TimeIntegrations/time_integration.h"
@@ -15,6 +16,12 @@ LBSSolver::LBSSolver(const std::string& text_name)
 {
 }
 
+/**Removes the solver's entries from the memory registry.*/
+LBSSolver::~LBSSolver()
+{
+  chi::MemoryRegistry::GetInstance().RemoveOwner(this);
+}
+
 /**Returns the input parameters for this object.*/
 chi::InputParameters LBSSolver::GetInputParameters()
 {
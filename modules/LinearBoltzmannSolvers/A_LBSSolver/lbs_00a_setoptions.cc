@@ -1,6 +1,9 @@
 #include "lbs_solver.h"
 
+#include "mesh/LogicalVolume/LogicalVolume.h"
+
 #include "ChiObjectFactory.h"
+#include "chi_runtime.h"
 
 namespace lbs
 {
@@ -51,7 +54,19 @@ chi::InputParameters LBSSolver::OptionsBlock()
   params.AddOptionalParameter("write_restart_file_base","restart",
   "File base name to use when writing restart data.");
   params.AddOptionalParameter("write_restart_interval",30.0,
-  "Interval at which restart data is to be written. Currently not implemented.");
+  "Interval, in minutes, at which restart data is to be written between "
+  "outer iterations.");
+  params.AddOptionalParameter("write_restart_async",false,
+  "Flag indicating whether restart data written at the restart write "
+  "interval is flushed to disk in the background while the solve "
+  "continues. The final restart write is always synchronous.");
+  params.AddOptionalParameter("output_compression","none",
+  "Compression of the values in angular flux, flux moment and restart "
+  "files. \"shuffle_lz\" is lossless (byte shuffle followed by LZ77). "
+  "\"lossy\" reproduces every value to within "
+  "output_compression_tolerance. Readers decompress transparently.");
+  params.AddOptionalParameter("output_compression_tolerance",1.0e-8,
+  "Absolute error bound of lossy output compression.");
   params.AddOptionalParameter("use_precursors",false,
   "Flag for using delayed neutron precursors.");
   params.AddOptionalParameter("use_source_moments",false,
@@ -65,6 +80,21 @@ chi::InputParameters LBSSolver::OptionsBlock()
   "Flag to control verbosity of across-groupset iterations.");
   params.AddOptionalParameter("verbose_ags_iterations",false,
   "Flag to control verbosity of across-groupset iterations.");
+  params.AddOptionalParameter("ags_iteration_type","gauss_seidel",
+  "Ordering of the groupset solves within an across-groupset iteration. "
+  "`\"gauss_seidel\"` uses the latest fluxes of previously solved groupsets "
+  "whilst `\"block_jacobi\"` solves every groupset against the fluxes of the "
+  "previous across-groupset iteration, making the groupset solves within an "
+  "iteration independent (block-Jacobi in energy). When the processes are "
+  "split with `--energy_comms` the groupsets are distributed over the energy "
+  "communicators and `\"block_jacobi\"` is always used.");
+  params.AddOptionalParameter("max_ags_iterations",0,
+  "Maximum number of across-groupset iterations. The default, 0, means 1 "
+  "iteration for `\"gauss_seidel\"` and 100 iterations, i.e., iterate to "
+  "`ags_tolerance`, for `\"block_jacobi\"`.");
+  params.AddOptionalParameter("ags_tolerance",1.0e-6,
+  "Absolute tolerance on the change in the flux moments between "
+  "across-groupset iterations.");
   params.AddOptionalParameter("power_field_function_on",false,
   "Flag to control the creation of the power generation field function. If set "
   "to `true` then a field function will be created with the general name "
@@ -91,16 +121,38 @@ chi::InputParameters LBSSolver::OptionsBlock()
   "exported as `prefix_phi_gXXX_mYYY` where `XXX` is the zero padded 3 digit "
   "group number and similarly for `YYY`. The underscore after \"prefix\" is "
   "added automatically.");
+  params.AddOptionalParameter("measure_cell_costs",false,
+  "Flag to measure the compute time spent on each local cell during sweeps "
+  "and source evaluations. The measured costs are used as partition weights "
+  "by `chiLBSRepartition`.");
   params.AddOptionalParameterArray("boundary_conditions",
   {},
   "A table contain sub-tables for each boundary specification.");
   params.LinkParameterToBlock("boundary_conditions",
                               "lbs::BoundaryOptionsBlock");
+  params.AddOptionalParameterArray("tallies",
+  {},
+  "A table containing sub-tables for each in-situ tally. Tallies are "
+  "evaluated in a single pass over the cells after every solve.");
+  params.LinkParameterToBlock("tallies", "lbs::TallyOptionsBlock");
+  params.AddOptionalParameter("tally_output_file","",
+  "File to which the values of all tallies are appended, one row per "
+  "evaluation. Empty means tallies are only available from "
+  "`chiLBSGetTallyValues`.");
 
   using namespace chi_data_types;
   params.ConstrainParameterRange("spatial_discretization",
       AllowableRangeList::New({"pwld"}));
 
+  params.ConstrainParameterRange("ags_iteration_type",
+    AllowableRangeList::New({"gauss_seidel", "block_jacobi"}));
+  params.ConstrainParameterRange("max_ags_iterations",
+    AllowableRangeLowLimit::New(0));
+
+  params.ConstrainParameterRange("output_compression",
+    AllowableRangeList::New({"none", "shuffle_lz", "lossy"}));
+  params.ConstrainParameterRange("output_compression_tolerance",
+    AllowableRangeLowLimit::New(0.0, /*low_closed=*/false));
   params.ConstrainParameterRange("field_function_prefix_option",
     AllowableRangeList::New({"prefix", "solver_name"}));
   // clang-format on
@@ -147,6 +199,40 @@ chi::InputParameters LBSSolver::BoundaryOptionsBlock()
   return params;
 }
 
+// ##################################################################
+RegisterSyntaxBlock(/*namespace_in_lua=*/lbs,
+                    /*name_in_lua=*/TallyOptionsBlock,
+                    /*syntax_function=*/LBSSolver::TallyOptionsBlock);
+
+chi::InputParameters LBSSolver::TallyOptionsBlock()
+{
+  chi::InputParameters params;
+
+  // clang-format off
+  params.SetGeneralDescription(
+    "Set options for an in-situ tally, i.e., the volume integral of a "
+    "reaction rate over a logical volume, binned over a group structure.");
+  params.SetDocGroup("LBSUtilities");
+
+  params.AddRequiredParameter<std::string>("name",
+  "Name of the tally.");
+  params.AddOptionalParameter("reaction", "flux",
+  "Reaction rate to tally.");
+  params.AddOptionalParameter("logical_volume", size_t(0),
+  "Handle to a logical volume. Cells are tallied if their centroid is "
+  "inside the volume. If not supplied the entire domain is tallied.");
+  params.AddOptionalParameterArray("group_bins", std::vector<size_t>{0},
+  "First group of each bin of the tally's group structure. Must start at 0 "
+  "and be increasing. The default is a single bin over all groups.");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange("reaction", AllowableRangeList::New({
+  "flux", "total", "absorption", "fission", "nu_fission", "power"}));
+  // clang-format on
+
+  return params;
+}
+
 // ##################################################################
 void LBSSolver::SetOptions(const chi::InputParameters& params)
 {
@@ -195,6 +281,23 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "write_restart_interval")
       Options().write_restart_interval = spec.GetValue<double>();
 
+    else if (spec.Name() == "write_restart_async")
+      Options().write_restart_async = spec.GetValue<bool>();
+
+    else if (spec.Name() == "output_compression")
+    {
+      const auto type = spec.GetValue<std::string>();
+      if (type == "none")
+        Options().output_compression = chi::CompressionType::NONE;
+      else if (type == "shuffle_lz")
+        Options().output_compression = chi::CompressionType::SHUFFLE_LZ;
+      else if (type == "lossy")
+        Options().output_compression = chi::CompressionType::LOSSY;
+    }
+
+    else if (spec.Name() == "output_compression_tolerance")
+      Options().output_compression_tolerance = spec.GetValue<double>();
+
     else if (spec.Name() == "use_precursors")
       Options().use_precursors = spec.GetValue<bool>();
 
@@ -213,6 +316,21 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "verbose_outer_iterations")
       Options().verbose_outer_iterations = spec.GetValue<bool>();
 
+    else if (spec.Name() == "ags_iteration_type")
+    {
+      const auto type_name = spec.GetValue<std::string>();
+      if (type_name == "gauss_seidel")
+        Options().ags_iteration_type = AGSIterationType::GAUSS_SEIDEL;
+      else if (type_name == "block_jacobi")
+        Options().ags_iteration_type = AGSIterationType::BLOCK_JACOBI;
+    }
+
+    else if (spec.Name() == "max_ags_iterations")
+      Options().max_ags_iterations = spec.GetValue<int>();
+
+    else if (spec.Name() == "ags_tolerance")
+      Options().ags_tolerance = spec.GetValue<double>();
+
     else if (spec.Name() == "power_field_function_on")
       Options().power_field_function_on = spec.GetValue<bool>();
 
@@ -231,6 +349,25 @@ void LBSSolver::SetOptions(const chi::InputParameters& params)
     else if (spec.Name() == "field_function_prefix")
       Options().field_function_prefix = spec.GetValue<std::string>();
 
+    else if (spec.Name() == "measure_cell_costs")
+      Options().measure_cell_costs = spec.GetValue<bool>();
+
+    else if (spec.Name() == "tally_output_file")
+      Options().tally_output_file = spec.GetValue<std::string>();
+
+    else if (spec.Name() == "tallies")
+    {
+      spec.RequireBlockTypeIs(chi::ParameterBlockType::ARRAY);
+
+      for (size_t t = 0; t < spec.NumParameters(); ++t)
+      {
+        auto tally_params = TallyOptionsBlock();
+        tally_params.AssignParameters(spec.GetParam(t));
+
+        SetTallyOptions(tally_params);
+      }
+    }
+
     else if (spec.Name() == "boundary_conditions")
     {
       spec.RequireBlockTypeIs(chi::ParameterBlockType::ARRAY);
@@ -317,4 +454,33 @@ void LBSSolver::SetBoundaryOptions(const chi::InputParameters& params)
   }
 }
 
+// ##################################################################
+void LBSSolver::SetTallyOptions(const chi::InputParameters& params)
+{
+  const auto& user_params = params.ParametersAtAssignment();
+
+  const std::map<std::string, TallyReaction> reaction_list = {
+    {"flux", TallyReaction::FLUX},
+    {"total", TallyReaction::TOTAL},
+    {"absorption", TallyReaction::ABSORPTION},
+    {"fission", TallyReaction::FISSION},
+    {"nu_fission", TallyReaction::NU_FISSION},
+    {"power", TallyReaction::POWER}};
+
+  Tally tally;
+  tally.name = params.GetParamValue<std::string>("name");
+  tally.reaction =
+    reaction_list.at(params.GetParamValue<std::string>("reaction"));
+  tally.bin_first_groups = params.GetParamVectorValue<size_t>("group_bins");
+
+  if (user_params.Has("logical_volume"))
+    tally.logical_volume =
+      Chi::GetStackItemPtrAsType<chi_mesh::LogicalVolume>(
+        Chi::object_stack,
+        user_params.GetParamValue<size_t>("logical_volume"),
+        __FUNCTION__);
+
+  AddTally(std::move(tally));
+}
+
 }
\ No newline at end of file
@@ -2,11 +2,14 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 //###################################################################
 /** Initialize the solver.*/
 void lbs::LBSSolver::Initialize()
 {
+  chi::PerfRegion perf_region("LBS::Initialize");
+
   PerformInputChecks();                //a assigns num_groups and grid
   PrintSimHeader();                    //b
 
@@ -6,8 +6,7 @@
 #include "chi_log.h"
 
 #include "console/chi_console.h"
-
-
+#include "utils/chi_memory_registry.h"
 
 #include <iomanip>
 
@@ -17,6 +16,10 @@ void lbs::LBSSolver::InitializeSpatialDiscretization()
   Chi::log.Log() << "Initializing spatial discretization.\n";
   discretization_ = chi_math::SpatialDiscretization_PWLD::New(*grid_ptr_);
 
+  chi::MemoryRegistry::GetInstance().Set(
+    chi::MemoryRegistry::CELL_MAPPINGS, this,
+    discretization_->CellMappingsMemoryUsage());
+
   ComputeUnitIntegrals();
 }
 
@@ -174,6 +177,26 @@ void lbs::LBSSolver::ComputeUnitIntegrals()
 
 
 
+  //============================================= Register memory
+  typedef chi::MemoryRegistry MemReg;
+  auto UCMBytes = [](const UnitCellMatrices& ucm)
+  {
+    return MemReg::Bytes(ucm.K_matrix) + MemReg::Bytes(ucm.G_matrix) +
+           MemReg::Bytes(ucm.M_matrix) + MemReg::Bytes(ucm.Vi_vectors) +
+           MemReg::Bytes(ucm.face_M_matrices) +
+           MemReg::Bytes(ucm.face_G_matrices) +
+           MemReg::Bytes(ucm.face_Si_vectors);
+  };
+
+  size_t ucm_bytes = MemReg::Bytes(unit_cell_matrices_);
+  for (const auto& ucm : unit_cell_matrices_)
+    ucm_bytes += UCMBytes(ucm);
+  for (const auto& [ghost_id, ucm] : unit_ghost_cell_matrices_)
+    ucm_bytes += sizeof(std::pair<const uint64_t, UnitCellMatrices>) +
+                 UCMBytes(ucm);
+
+  MemReg::GetInstance().Set(MemReg::UNIT_CELL_MATRICES, this, ucm_bytes);
+
   Chi::mpi.Barrier();
   Chi::log.Log()
   << "Ghost cell unit cell-matrix ratio: "
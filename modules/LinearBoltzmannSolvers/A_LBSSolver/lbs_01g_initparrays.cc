@@ -4,6 +4,7 @@
 #include "chi_log.h"
 #include "chi_mpi.h"
 #include "console/chi_console.h"
+#include "utils/chi_memory_registry.h"
 
 #include <iomanip>
 
@@ -62,6 +63,19 @@ void lbs::LBSSolver::InitializeParrays()
     precursor_new_local_.assign(num_precursor_dofs, 0.0);
   }
 
+  //============================================= Register memory
+  typedef chi::MemoryRegistry MemReg;
+  auto& mem_registry = MemReg::GetInstance();
+  mem_registry.Set(MemReg::FLUX_MOMENTS, this,
+                   MemReg::Bytes(phi_old_local_) +
+                   MemReg::Bytes(phi_new_local_));
+  mem_registry.Set(MemReg::ANGULAR_FLUX, this, MemReg::Bytes(psi_new_local_));
+  mem_registry.Set(MemReg::SOURCE_MOMENTS, this,
+                   MemReg::Bytes(q_moments_local_));
+  if (options_.use_precursors)
+    mem_registry.Set(MemReg::PRECURSORS, this,
+                     MemReg::Bytes(precursor_new_local_));
+
   //================================================== Read Restart data
   if (options_.read_restart_data)
     ReadRestartData(options_.read_restart_folder_name,
@@ -5,6 +5,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_mpi.h"
 
 void lbs::LBSSolver::InitializeSolverSchemes()
 {
@@ -12,6 +13,32 @@ void lbs::LBSSolver::InitializeSolverSchemes()
 
   InitializeWGSSolvers();
 
+  //=========================================== Energy communicators
+  // The groupsets are distributed over the energy communicators, which
+  // requires the groupset solves within an AGS iteration to be independent
+  if (Chi::mpi.num_energy_colors > 1)
+  {
+    if (options_.ags_iteration_type != AGSIterationType::BLOCK_JACOBI)
+      Chi::log.Log0Warning()
+        << "LBSSolver: " << Chi::mpi.num_energy_colors
+        << " energy communicators are in use. The across-groupset "
+           "iterations are switched to block_jacobi.";
+    options_.ags_iteration_type = AGSIterationType::BLOCK_JACOBI;
+
+    if (groupsets_.size() < static_cast<size_t>(Chi::mpi.num_energy_colors))
+      Chi::log.Log0Warning()
+        << "LBSSolver: Only " << groupsets_.size() << " groupsets for "
+        << Chi::mpi.num_energy_colors << " energy communicators. Some "
+           "energy communicators will be idle.";
+  }
+
+  // Gauss-Seidel with downscattering-only coupling between groupsets
+  // converges in a single iteration, block-Jacobi needs to iterate
+  int max_ags_iterations = options_.max_ags_iterations;
+  if (max_ags_iterations <= 0)
+    max_ags_iterations =
+      (options_.ags_iteration_type == AGSIterationType::BLOCK_JACOBI)? 100 : 1;
+
   /*This default behavior covers the situation when no Across-GroupSet (AGS)
    * solvers have been created for this solver.*/
   ags_solvers_.clear();
@@ -24,7 +51,8 @@ void lbs::LBSSolver::InitializeSolverSchemes()
     auto ags_solver = std::make_shared<AGSLinearSolver<Mat,Vec,KSP>>(
       "richardson", ags_context,
       groupsets_.front().id_, groupsets_.back().id_);
-    ags_solver->ToleranceOptions().maximum_iterations = 1;
+    ags_solver->ToleranceOptions().maximum_iterations = max_ags_iterations;
+    ags_solver->ToleranceOptions().residual_absolute = options_.ags_tolerance;
     ags_solver->SetVerbosity(options_.verbose_ags_iterations);
 
     ags_solvers_.push_back(ags_solver);
@@ -1,168 +1,984 @@
 #include "lbs_solver.h"
+#include "lbs_checkpoint_file.h"
+
+#include "mpi/chi_mpi_utils_map_all2all.h"
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "chi_log_exceptions.h"
 #include "chi_mpi.h"
+#include "utils/chi_timer.h"
+#include "utils/chi_compression.h"
+#include "utils/chi_perf_region.h"
 
 #include <sys/stat.h>
-#include <fstream>
+#include <algorithm>
+#include <climits>
 #include <cstring>
+#include <numeric>
 
+namespace
+{
 //###################################################################
-/**Writes phi_old to restart file.*/
-void lbs::LBSSolver::WriteRestartData(const std::string& folder_name,
-                                      const std::string& file_base)
+/**Partition of the global cell-ids into contiguous blocks of equal size,
+ * one per location, used to distribute work on global-id ordered data.*/
+struct GlobalIdBlocking
+{
+  const uint64_t num_global_ids;
+  const uint64_t block_size;
+
+  explicit GlobalIdBlocking(uint64_t num_ids) :
+    num_global_ids(num_ids),
+    block_size(std::max<uint64_t>(1,
+      (num_ids + Chi::mpi.process_count - 1) / Chi::mpi.process_count))
+  {}
+
+  int Owner(uint64_t global_id) const
+  {return static_cast<int>(global_id / block_size);}
+  uint64_t Begin(int location) const
+  {return std::min(num_global_ids, location * block_size);}
+  uint64_t End(int location) const
+  {return std::min(num_global_ids, Begin(location) + block_size);}
+};
+
+//###################################################################
+/**Computes, for every local cell, the exclusive prefix sum of the given
+ * per-cell counts over all cells in global-id order. Each location owns
+ * a contiguous block of global-ids and scans the counts of its block,
+ * after which the block totals are scanned across locations, i.e., no
+ * location stores a global array. Returns the offsets, in local-id
+ * order, and the global total. Collective.*/
+std::pair<std::vector<uint64_t>, uint64_t>
+  GlobalCellOffsets(const chi_mesh::MeshContinuum& grid,
+                    const std::vector<uint64_t>& local_counts)
+{
+  const uint64_t num_global_cells = grid.GetGlobalNumberOfCells();
+  const GlobalIdBlocking blocking(num_global_cells);
+  const uint64_t block_begin = blocking.Begin(Chi::mpi.location_id);
+  const uint64_t block_end = blocking.End(Chi::mpi.location_id);
+
+  //======================================== Send counts to block owners
+  // Pairs of global-id and count
+  std::map<int, std::vector<uint64_t>> pairs_to_send;
+  for (const auto& cell : grid.local_cells)
+  {
+    ChiLogicalErrorIf(cell.global_id_ >= num_global_cells,
+                      "Global cell-ids are not contiguous.");
+    auto& pairs = pairs_to_send[blocking.Owner(cell.global_id_)];
+    pairs.push_back(cell.global_id_);
+    pairs.push_back(local_counts[cell.local_id_]);
+  }
+  const auto pairs_received =
+    chi_mpi_utils::MapAllToAll(pairs_to_send, MPI_UINT64_T);
+
+  //======================================== Scan block
+  std::vector<uint64_t> block_offsets(block_end - block_begin + 1, 0);
+  for (const auto& [location, pairs] : pairs_received)
+    for (size_t k = 0; k < pairs.size(); k += 2)
+      block_offsets[pairs[k] - block_begin + 1] = pairs[k + 1];
+  std::partial_sum(block_offsets.begin(), block_offsets.end(),
+                   block_offsets.begin());
+
+  uint64_t block_total = block_offsets.back();
+  uint64_t block_base = 0;
+  uint64_t global_total = 0;
+  MPI_Exscan(&block_total,   //sendbuf
+             &block_base,    //recvbuf
+             1, MPI_UINT64_T,//count+datatype
+             MPI_SUM,        //operation
+             Chi::mpi.comm); //comm
+  if (Chi::mpi.location_id == 0) block_base = 0;
+  MPI_Allreduce(&block_total,   //sendbuf
+                &global_total,  //recvbuf
+                1, MPI_UINT64_T,//count+datatype
+                MPI_SUM,        //operation
+                Chi::mpi.comm); //comm
+
+  //======================================== Reply with offsets
+  std::map<int, std::vector<uint64_t>> offsets_to_send;
+  for (const auto& [location, pairs] : pairs_received)
+  {
+    auto& offsets = offsets_to_send[location];
+    for (size_t k = 0; k < pairs.size(); k += 2)
+      offsets.push_back(block_base + block_offsets[pairs[k] - block_begin]);
+  }
+  const auto offsets_received =
+    chi_mpi_utils::MapAllToAll(offsets_to_send, MPI_UINT64_T);
+
+  std::vector<uint64_t> local_offsets(grid.local_cells.size(), 0);
+  for (const auto& [location, pairs] : pairs_to_send)
+  {
+    const auto& offsets = offsets_received.at(location);
+    for (size_t k = 0; k < pairs.size(); k += 2)
+      local_offsets[grid.cells[pairs[k]].local_id_] = offsets[k / 2];
+  }
+
+  return {local_offsets, global_total};
+}
+
+//###################################################################
+/**Collectively writes or reads blocks of a file, with elements of the
+ * given 8-byte type. The buffer holds the blocks contiguously. Returns
+ * false if MPI reports an error.*/
+bool CollectiveBlockIO(MPI_File file,
+                       const lbs::CheckpointSnapshot::Blocks& blocks,
+                       MPI_Datatype etype,
+                       void* buffer,
+                       bool write)
+{
+  const auto& lengths = blocks.lengths;
+  const std::vector<MPI_Aint> displacements(blocks.displacements.begin(),
+                                            blocks.displacements.end());
+  const auto base = static_cast<MPI_Offset>(blocks.base_offset);
+
+  const int64_t count = std::accumulate(lengths.begin(), lengths.end(),
+                                        int64_t(0));
+  ChiLogicalErrorIf(count > INT_MAX,
+                    "Local checkpoint data exceeds the MPI count limit.");
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(static_cast<int>(lengths.size()), //count
+                           lengths.data(),                   //blocklengths
+                           displacements.data(),             //displacements
+                           etype,                            //oldtype
+                           &filetype);                       //newtype
+  MPI_Type_commit(&filetype);
+
+  int error = MPI_File_set_view(file, base, etype, filetype,
+                                "native", MPI_INFO_NULL);
+  if (error == MPI_SUCCESS)
+    error = write ?
+      MPI_File_write_all(file, buffer, static_cast<int>(count), etype,
+                         MPI_STATUS_IGNORE) :
+      MPI_File_read_all(file, buffer, static_cast<int>(count), etype,
+                        MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&filetype);
+  MPI_File_set_view(file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+
+  return error == MPI_SUCCESS;
+}
+
+//###################################################################
+/**Placement of the local cells in a checkpoint file.*/
+struct CheckpointLayout
+{
+  /**Local cells in global-id order, which is the file order.*/
+  std::vector<const chi_mesh::Cell*> cells;
+  std::vector<uint64_t> cell_num_nodes;   ///< By local-id
+  std::vector<uint64_t> cell_node_offsets;///< By local-id
+  uint64_t num_global_cells = 0;
+  uint64_t num_global_nodes = 0;
+};
+
+CheckpointLayout MakeCheckpointLayout(const chi_mesh::MeshContinuum& grid,
+                                      const chi_math::SpatialDiscretization& sdm)
+{
+  CheckpointLayout layout;
+  layout.cell_num_nodes.resize(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+  {
+    layout.cells.push_back(&cell);
+    layout.cell_num_nodes[cell.local_id_] = sdm.GetCellNumNodes(cell);
+  }
+  std::sort(layout.cells.begin(), layout.cells.end(),
+            [](const chi_mesh::Cell* a, const chi_mesh::Cell* b)
+            {return a->global_id_ < b->global_id_;});
+
+  std::tie(layout.cell_node_offsets, layout.num_global_nodes) =
+    GlobalCellOffsets(grid, layout.cell_num_nodes);
+  layout.num_global_cells = grid.GetGlobalNumberOfCells();
+
+  return layout;
+}
+
+/**Number of values per node (nodal items) or per cell (cell items).*/
+uint64_t ValuesPerEntry(const lbs::CheckpointItem& item)
+{
+  using Layout = lbs::CheckpointItem::Layout;
+  if (item.layout == Layout::NODAL)
+    return item.uk_man->GetTotalUnknownStructureSize();
+  if (item.layout == Layout::CELL) return item.values_per_cell;
+  return 1;
+}
+
+//###################################################################
+/**File blocks of the cell table, one per local cell in file order.*/
+lbs::CheckpointSnapshot::Blocks MakeCellTableBlocks(
+  const CheckpointLayout& layout, uint64_t base_offset)
+{
+  lbs::CheckpointSnapshot::Blocks blocks;
+  blocks.base_offset = base_offset;
+  blocks.lengths.assign(layout.cells.size(), 1);
+  for (const auto* cell : layout.cells)
+    blocks.displacements.push_back(8 * cell->global_id_);
+
+  return blocks;
+}
+
+//###################################################################
+/**File blocks of a nodal or cell item, one per local cell in file
+ * order, and the address of each block in the item's local vector.*/
+struct ItemBlocks
+{
+  lbs::CheckpointSnapshot::Blocks file_blocks;
+  std::vector<size_t> local_addresses;
+};
+
+ItemBlocks MakeItemBlocks(const lbs::CheckpointItem& item,
+                          uint64_t base_offset,
+                          const CheckpointLayout& layout,
+                          const chi_math::SpatialDiscretization& sdm)
+{
+  const uint64_t values_per_entry = ValuesPerEntry(item);
+  const bool nodal = item.layout == lbs::CheckpointItem::Layout::NODAL;
+  if (nodal)
+    ChiLogicalErrorIf(item.uk_man->dof_storage_type_ !=
+                      chi_math::UnknownStorageType::NODAL,
+                      "Checkpoint item " + item.name + " requires nodal "
+                      "unknown storage.");
+
+  ItemBlocks blocks;
+  auto& lengths = blocks.file_blocks.lengths;
+  auto& displacements = blocks.file_blocks.displacements;
+  blocks.file_blocks.base_offset = base_offset;
+  lengths.reserve(layout.cells.size());
+  displacements.reserve(layout.cells.size());
+  blocks.local_addresses.reserve(layout.cells.size());
+  for (const auto* cell : layout.cells)
+  {
+    const uint64_t local_id = cell->local_id_;
+    if (nodal)
+    {
+      lengths.push_back(static_cast<int>(
+        layout.cell_num_nodes[local_id] * values_per_entry));
+      displacements.push_back(
+        8 * layout.cell_node_offsets[local_id] * values_per_entry);
+      blocks.local_addresses.push_back(
+        sdm.MapDOFLocal(*cell, 0, *item.uk_man, 0, 0));
+    }
+    else
+    {
+      lengths.push_back(static_cast<int>(values_per_entry));
+      displacements.push_back(8 * cell->global_id_ * values_per_entry);
+      blocks.local_addresses.push_back(local_id * values_per_entry);
+    }
+    ChiLogicalErrorIf(blocks.local_addresses.back() + lengths.back() >
+                      item.vector->size(),
+                      "Checkpoint item " + item.name + " is smaller than "
+                      "its layout.");
+  }
+
+  return blocks;
+}
+
+/**Logical-and of a flag over all locations.*/
+bool AllLocationsSucceeded(bool location_succeeded)
+{
+  bool global_succeeded = true;
+  MPI_Allreduce(&location_succeeded,   //Send buffer
+                &global_succeeded,     //Recv buffer
+                1,                     //count
+                MPI_CXX_BOOL,          //Data type
+                MPI_LAND,              //Operation - Logical and
+                Chi::mpi.comm);        //Communicator
+  return global_succeeded;
+}
+
+/**Creates the restart folder, if needed, on location 0. Collective.*/
+void MakeRestartFolder(const std::string& folder_name)
 {
   typedef struct stat Stat;
   Stat st;
 
-  //======================================== Make sure folder exists
   if (Chi::mpi.location_id == 0)
   {
     if (stat(folder_name.c_str(),&st) != 0) //if not exist, make it
       if ( (mkdir(folder_name.c_str(),S_IRWXU | S_IRWXG | S_IRWXO) != 0) and
            (errno != EEXIST) )
-      {
         Chi::log.Log0Warning()
           << "Failed to create restart directory: " << folder_name;
-        return;
-      }
   }
 
   Chi::mpi.Barrier();
+}
+
+//###################################################################
+/**Writes a checkpoint snapshot with collective MPI-IO. Returns true if
+ * all locations succeeded.*/
+bool WriteCheckpointSnapshot(lbs::CheckpointSnapshot& snapshot)
+{
+  MPI_File file;
+  const int open_error =
+    MPI_File_open(Chi::mpi.comm, snapshot.file_name.c_str(),
+                  MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  if (not AllLocationsSucceeded(open_error == MPI_SUCCESS))
+  {
+    if (open_error == MPI_SUCCESS) MPI_File_close(&file);
+    return false;
+  }
+  MPI_File_set_size(file, static_cast<MPI_Offset>(snapshot.file_size));
 
-  //======================================== Create files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
   bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+  if (not snapshot.preamble.empty())
+    location_succeeded &=
+      MPI_File_write_at(file, 0, snapshot.preamble.data(),
+                        static_cast<int>(snapshot.preamble.size()),
+                        MPI_BYTE, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+
+  location_succeeded &=
+    CollectiveBlockIO(file, snapshot.cell_table_blocks, MPI_UINT64_T,
+                      snapshot.cell_num_nodes.data(), /*write=*/true);
+
+  for (size_t i = 0; i < snapshot.item_blocks.size(); ++i)
+    location_succeeded &=
+      CollectiveBlockIO(file, snapshot.item_blocks[i], MPI_DOUBLE,
+                        snapshot.item_values[i].data(), /*write=*/true);
+
+  MPI_File_close(&file);
+
+  return AllLocationsSucceeded(location_succeeded);
+}
+
+//###################################################################
+/**The data of a nodal or cell item, with blocks relative to the start of
+ * the item's data in the file.*/
+struct StagedItem
+{
+  lbs::CheckpointSnapshot::Blocks blocks;
+  std::vector<double> values;
+  uint64_t data_size = 0; ///< Bytes
+};
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+/**Appends raw bytes to a buffer of 8-byte values, padded with zeros.*/
+void AppendBytes(std::vector<double>& buffer, const void* data,
+                 size_t num_bytes)
+{
+  const size_t begin = buffer.size();
+  buffer.resize(begin + (num_bytes + 7) / 8, 0.0);
+  if (num_bytes > 0) std::memcpy(buffer.data() + begin, data, num_bytes);
+}
 
-  std::ofstream ofile;
-  ofile.open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+//###################################################################
+/**Compresses the values of a nodal or cell item, given in file order
+ * with one block length per local cell. The values of every cell are
+ * sent to the owner of its global-id block, which compresses its block
+ * as one chunk, so that chunks do not depend on the partitioning.
+ * Collective.*/
+StagedItem StageCompressedItem(const CheckpointLayout& layout,
+                               const std::vector<int>& cell_lengths,
+                               const std::vector<double>& values,
+                               chi::CompressionType compression,
+                               double tolerance)
+{
+  const GlobalIdBlocking blocking(layout.num_global_cells);
+  const int location_id = Chi::mpi.location_id;
+  const uint64_t block_begin = blocking.Begin(location_id);
+  const uint64_t block_end = blocking.End(location_id);
 
-  if (not ofile.is_open())
+  //======================================== Send cell values to block owners
+  // Global-id, number of values, values. Global-ids are exact in doubles.
+  std::map<int, std::vector<double>> cell_data_to_send;
+  size_t address = 0;
+  for (size_t c = 0; c < layout.cells.size(); ++c)
   {
-    Chi::log.LogAllError()
-      << "Failed to create restart file: " << file_name;
-    ofile.close();
-    location_succeeded = false;
+    const uint64_t global_id = layout.cells[c]->global_id_;
+    const auto begin = values.begin() + static_cast<int64_t>(address);
+    auto& cell_data = cell_data_to_send[blocking.Owner(global_id)];
+    cell_data.push_back(static_cast<double>(global_id));
+    cell_data.push_back(cell_lengths[c]);
+    cell_data.insert(cell_data.end(), begin, begin + cell_lengths[c]);
+    address += cell_lengths[c];
+  }
+  const auto cell_data_received =
+    chi_mpi_utils::MapAllToAll(cell_data_to_send, MPI_DOUBLE);
+
+  //======================================== Assemble and compress block
+  std::vector<std::pair<const double*, size_t>>
+    block_cells(block_end - block_begin, {nullptr, 0});
+  for (const auto& [location, cell_data] : cell_data_received)
+    for (size_t k = 0; k < cell_data.size();)
+    {
+      const auto global_id = static_cast<uint64_t>(cell_data[k]);
+      const auto num_values = static_cast<size_t>(cell_data[k + 1]);
+      block_cells[global_id - block_begin] = {cell_data.data() + k + 2,
+                                              num_values};
+      k += 2 + num_values;
+    }
+
+  std::vector<double> block_values;
+  for (const auto& [cell_values, num_values] : block_cells)
+  {
+    ChiLogicalErrorIf(not cell_values, "Missing cell in global-id block.");
+    block_values.insert(block_values.end(),
+                        cell_values, cell_values + num_values);
+  }
+
+  const auto chunk = chi::CompressDoubles(block_values.data(),
+                                          block_values.size(),
+                                          compression, tolerance);
+  const uint64_t padded_size = 8 * ((chunk.size() + 7) / 8);
+  ChiLogicalErrorIf(padded_size / 8 > INT_MAX,
+                    "Compressed checkpoint chunk exceeds the MPI count limit.");
+
+  //======================================== Place chunks
+  uint64_t chunk_offset = 0;
+  uint64_t total_size = 0;
+  MPI_Exscan(&padded_size,   //sendbuf
+             &chunk_offset,  //recvbuf
+             1, MPI_UINT64_T,//count+datatype
+             MPI_SUM,        //operation
+             Chi::mpi.comm); //comm
+  if (location_id == 0) chunk_offset = 0;
+  MPI_Allreduce(&padded_size,   //sendbuf
+                &total_size,    //recvbuf
+                1, MPI_UINT64_T,//count+datatype
+                MPI_SUM,        //operation
+                Chi::mpi.comm); //comm
+
+  const uint64_t num_chunks = Chi::mpi.process_count;
+  const uint64_t table_size =
+    8 + num_chunks * sizeof(lbs::CheckpointChunkRecord);
+  const lbs::CheckpointChunkRecord chunk_record{block_begin,
+                                                block_end,
+                                                block_values.size(),
+                                                chunk.size(),
+                                                table_size + chunk_offset};
+
+  StagedItem staged;
+  staged.data_size = table_size + total_size;
+  if (location_id == 0)
+  {
+    staged.blocks.displacements.push_back(0);
+    staged.blocks.lengths.push_back(1 + sizeof(chunk_record) / 8);
+    AppendBytes(staged.values, &num_chunks, sizeof(num_chunks));
   }
   else
   {
-    size_t phi_old_size = phi_old_local_.size();
-    ofile.write((char*)&phi_old_size, sizeof(size_t));
-    for (auto val : phi_old_local_)
-      ofile.write((char*)&val, sizeof(double));
+    staged.blocks.displacements.push_back(8 + location_id *
+                                          sizeof(chunk_record));
+    staged.blocks.lengths.push_back(sizeof(chunk_record) / 8);
+  }
+  AppendBytes(staged.values, &chunk_record, sizeof(chunk_record));
 
-    ofile.close();
+  if (padded_size > 0)
+  {
+    staged.blocks.displacements.push_back(chunk_record.data_offset);
+    staged.blocks.lengths.push_back(static_cast<int>(padded_size / 8));
+    AppendBytes(staged.values, chunk.data(), chunk.size());
   }
 
-  //======================================== Wait for all processes
-  //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
-  MPI_Allreduce(&location_succeeded,   //Send buffer
-                &global_succeeded,     //Recv buffer
-                1,                     //count
-                MPI_CXX_BOOL,          //Data type
-                MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+  return staged;
+}
 
-  //======================================== Write status message
-  if (global_succeeded)
-    Chi::log.Log()
-      << "Successfully wrote restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+//###################################################################
+/**Reads a compressed nodal or cell item into its local vector. Every
+ * location decompresses the chunks overlapping its own global-id block
+ * and serves the values of the block's cells to the locations owning
+ * them. Returns false if this location failed. Collective.*/
+bool ReadCompressedItem(MPI_File file,
+                        const lbs::CheckpointItemRecord& record,
+                        uint64_t cell_table_offset,
+                        const CheckpointLayout& layout,
+                        const ItemBlocks& blocks,
+                        std::vector<double>& vector)
+{
+  const GlobalIdBlocking blocking(layout.num_global_cells);
+  const uint64_t block_begin = blocking.Begin(Chi::mpi.location_id);
+  const uint64_t block_end = blocking.End(Chi::mpi.location_id);
+  const bool nodal = record.layout ==
+    static_cast<uint64_t>(lbs::CheckpointItem::Layout::NODAL);
+  const auto compression =
+    static_cast<chi::CompressionType>(record.compression);
+
+  //======================================== Read chunk records
+  uint64_t num_chunks = 0;
+  MPI_File_read_at_all(file, static_cast<MPI_Offset>(record.data_offset),
+                       &num_chunks, 1, MPI_UINT64_T, MPI_STATUS_IGNORE);
+  //Same on all locations
+  if (num_chunks * sizeof(lbs::CheckpointChunkRecord) > INT_MAX) return false;
+
+  std::vector<lbs::CheckpointChunkRecord> chunks(num_chunks);
+  MPI_File_read_at_all(file, static_cast<MPI_Offset>(record.data_offset + 8),
+                       chunks.data(),
+                       static_cast<int>(num_chunks *
+                                        sizeof(lbs::CheckpointChunkRecord)),
+                       MPI_BYTE, MPI_STATUS_IGNORE);
+
+  //======================================== Decompress chunks overlapping
+  //                                         the block
+  bool succeeded = true;
+  std::vector<std::vector<double>> block_cell_values(block_end - block_begin);
+  try
+  {
+    for (const auto& chunk : chunks)
+    {
+      const uint64_t begin = std::max(chunk.global_id_begin, block_begin);
+      const uint64_t end = std::min(chunk.global_id_end, block_end);
+      if (begin >= end) continue;
+      if (chunk.global_id_end > layout.num_global_cells or
+          chunk.num_bytes > INT_MAX)
+        throw std::runtime_error("Invalid checkpoint chunk.");
+
+      const uint64_t num_chunk_cells =
+        chunk.global_id_end - chunk.global_id_begin;
+      std::vector<uint64_t> num_nodes(num_chunk_cells, 1);
+      if (nodal)
+        MPI_File_read_at(file, static_cast<MPI_Offset>(
+                           cell_table_offset + 8 * chunk.global_id_begin),
+                         num_nodes.data(), static_cast<int>(num_chunk_cells),
+                         MPI_UINT64_T, MPI_STATUS_IGNORE);
+
+      std::vector<char> compressed(chunk.num_bytes);
+      MPI_File_read_at(file, static_cast<MPI_Offset>(record.data_offset +
+                                                     chunk.data_offset),
+                       compressed.data(), static_cast<int>(chunk.num_bytes),
+                       MPI_BYTE, MPI_STATUS_IGNORE);
+
+      std::vector<double> chunk_values(chunk.num_values);
+      chi::DecompressDoubles(compressed.data(), compressed.size(),
+                             compression, record.compression_tolerance,
+                             chunk_values.data(), chunk_values.size());
+
+      uint64_t address = 0;
+      for (uint64_t global_id = chunk.global_id_begin; global_id < end;
+           ++global_id)
+      {
+        const uint64_t num_cell_values =
+          num_nodes[global_id - chunk.global_id_begin] *
+          record.values_per_entry;
+        if (address + num_cell_values > chunk_values.size())
+          throw std::runtime_error("Invalid checkpoint chunk.");
+
+        if (global_id >= begin)
+        {
+          const auto cell_begin = chunk_values.begin() +
+                                  static_cast<int64_t>(address);
+          block_cell_values[global_id - block_begin].assign(
+            cell_begin, cell_begin + static_cast<int64_t>(num_cell_values));
+        }
+        address += num_cell_values;
+      }
+    }//for chunk
+  }
+  catch (const std::runtime_error&)
+  {
+    succeeded = false;
+  }
+
+  //======================================== Request the values of the
+  //                                         local cells from block owners
+  std::map<int, std::vector<uint64_t>> requests_to_send;
+  std::map<int, std::vector<size_t>> requested_cells;
+  for (size_t c = 0; c < layout.cells.size(); ++c)
+  {
+    const uint64_t global_id = layout.cells[c]->global_id_;
+    requests_to_send[blocking.Owner(global_id)].push_back(global_id);
+    requested_cells[blocking.Owner(global_id)].push_back(c);
+  }
+  const auto requests_received =
+    chi_mpi_utils::MapAllToAll(requests_to_send, MPI_UINT64_T);
+
+  std::map<int, std::vector<double>> values_to_send;
+  for (const auto& [location, global_ids] : requests_received)
+  {
+    auto& reply = values_to_send[location];
+    for (const uint64_t global_id : global_ids)
+    {
+      const auto& cell_values = block_cell_values[global_id - block_begin];
+      reply.insert(reply.end(), cell_values.begin(), cell_values.end());
+    }
+  }
+  const auto values_received =
+    chi_mpi_utils::MapAllToAll(values_to_send, MPI_DOUBLE);
+
+  //======================================== Unpack
+  const auto& lengths = blocks.file_blocks.lengths;
+  for (const auto& [location, cells] : requested_cells)
+  {
+    const auto reply = values_received.find(location);
+    size_t num_expected = 0;
+    for (const size_t c : cells) num_expected += lengths[c];
+    const size_t num_received =
+      reply == values_received.end() ? 0 : reply->second.size();
+    if (num_received != num_expected)
+    {
+      succeeded = false;
+      continue;
+    }
+    if (num_expected == 0) continue;
+
+    size_t address = 0;
+    for (const size_t c : cells)
+    {
+      std::copy_n(reply->second.begin() + static_cast<int64_t>(address),
+                  lengths[c],
+                  vector.begin() +
+                    static_cast<int64_t>(blocks.local_addresses[c]));
+      address += lengths[c];
+    }
+  }
+
+  return succeeded;
+}
+}//namespace
+
+//###################################################################
+/**Returns the quantities stored in restart files: the flux moments, the
+ * precursors and, when saved, the angular fluxes of every groupset,
+ * followed by the items added with AddCheckpointItem.*/
+std::vector<lbs::CheckpointItem> lbs::LBSSolver::MakeCheckpointItems()
+{
+  using Layout = CheckpointItem::Layout;
+  std::vector<CheckpointItem> items;
+
+  items.push_back({"phi_old", Layout::NODAL,
+                   &phi_old_local_, &flux_moments_uk_man_});
+  items.push_back({"phi_new", Layout::NODAL,
+                   &phi_new_local_, &flux_moments_uk_man_});
+
+  if (options_.use_precursors and max_precursors_per_material_ > 0)
+    items.push_back({"precursors", Layout::CELL,
+                     &precursor_new_local_, nullptr,
+                     max_precursors_per_material_});
+
+  if (options_.save_angular_flux)
+    for (auto& groupset : groupsets_)
+      items.push_back({"psi_gs" + std::to_string(groupset.id_), Layout::NODAL,
+                       &psi_new_local_[groupset.id_], &groupset.psi_uk_man_});
+
+  items.insert(items.end(), checkpoint_items_.begin(), checkpoint_items_.end());
+
+  return items;
+}
+
+//###################################################################
+/**Adds a quantity, typically owned by an executor (e.g. an eigenvalue),
+ * to the quantities written to and read from restart files. The item's
+ * storage must outlive the solver's restart operations.*/
+void lbs::LBSSolver::AddCheckpointItem(const CheckpointItem& item)
+{
+  ChiInvalidArgumentIf(item.name.size() >=
+                       CheckpointItemRecord::MAX_NAME_LENGTH,
+                       "Checkpoint item name " + item.name + " is too long.");
+  checkpoint_items_.push_back(item);
+}
+
+//###################################################################
+/**Stages the local data of the checkpoint file `file_name` in a
+ * snapshot, reusing the snapshot's storage. Collective.*/
+void lbs::LBSSolver::FillCheckpointSnapshot(const std::string& file_name,
+                                            CheckpointSnapshot& snapshot)
+{
+  const auto& sdm = *discretization_;
+  const auto items = MakeCheckpointItems();
+  const auto layout = MakeCheckpointLayout(*grid_ptr_, sdm);
+  const auto compression = options_.output_compression;
+  const double tolerance = options_.output_compression_tolerance;
+
+  //======================================== Stage item values
+  // Nodal and cell items, in item order, with blocks relative to the
+  // start of their data
+  snapshot.item_blocks.clear();
+  std::vector<uint64_t> data_sizes;
+  for (const auto& item : items)
+  {
+    if (item.layout == CheckpointItem::Layout::SCALAR) continue;
+
+    auto blocks = MakeItemBlocks(item, 0, layout, sdm);
+    const size_t k = data_sizes.size();
+    if (snapshot.item_values.size() <= k) snapshot.item_values.emplace_back();
+    auto& values = snapshot.item_values[k];
+    values.clear();
+    for (size_t b = 0; b < blocks.local_addresses.size(); ++b)
+    {
+      const auto begin = item.vector->begin() +
+                         static_cast<int64_t>(blocks.local_addresses[b]);
+      values.insert(values.end(), begin,
+                    begin + blocks.file_blocks.lengths[b]);
+    }
+
+    if (compression == chi::CompressionType::NONE)
+    {
+      const uint64_t num_entries =
+        item.layout == CheckpointItem::Layout::NODAL ?
+        layout.num_global_nodes : layout.num_global_cells;
+      data_sizes.push_back(8 * num_entries * ValuesPerEntry(item));
+      snapshot.item_blocks.push_back(std::move(blocks.file_blocks));
+    }
+    else
+    {
+      auto staged = StageCompressedItem(layout, blocks.file_blocks.lengths,
+                                        values, compression, tolerance);
+      data_sizes.push_back(staged.data_size);
+      snapshot.item_blocks.push_back(std::move(staged.blocks));
+      values = std::move(staged.values);
+    }
+  }
+  snapshot.item_values.resize(data_sizes.size());
+
+  //======================================== Header and item records
+  CheckpointFileHeader header;
+  std::copy(std::begin(CheckpointFileHeader::MAGIC),
+            std::end(CheckpointFileHeader::MAGIC), header.magic);
+  header.version = CheckpointFileHeader::VERSION;
+  header.byte_order_mark = CheckpointFileHeader::BYTE_ORDER_MARK;
+  header.num_global_cells = layout.num_global_cells;
+  header.num_global_nodes = layout.num_global_nodes;
+  header.num_items = items.size();
+
+  const uint64_t cell_table_offset =
+    sizeof(CheckpointFileHeader) + items.size() * sizeof(CheckpointItemRecord);
+  uint64_t data_offset = cell_table_offset + 8 * layout.num_global_cells;
+
+  std::vector<CheckpointItemRecord> records(items.size());
+  size_t k = 0;
+  for (size_t i = 0; i < items.size(); ++i)
+  {
+    const auto& item = items[i];
+    auto& record = records[i];
+    strncpy(record.name, item.name.c_str(),
+            CheckpointItemRecord::MAX_NAME_LENGTH - 1);
+    record.layout = static_cast<uint64_t>(item.layout);
+    record.values_per_entry = ValuesPerEntry(item);
+
+    if (item.layout == CheckpointItem::Layout::SCALAR)
+    {
+      record.scalar_value = *item.scalar;
+      continue;
+    }
+
+    record.data_offset = data_offset;
+    record.compression = static_cast<uint64_t>(compression);
+    record.compression_tolerance = tolerance;
+    snapshot.item_blocks[k].base_offset = data_offset;
+    data_offset += data_sizes[k++];
+  }
+
+  snapshot.file_name = file_name;
+  snapshot.file_size = data_offset;
+  snapshot.preamble.clear();
+  if (Chi::mpi.location_id == 0)
+  {
+    const auto* header_bytes = reinterpret_cast<const char*>(&header);
+    const auto* record_bytes = reinterpret_cast<const char*>(records.data());
+    snapshot.preamble.assign(header_bytes, header_bytes + sizeof(header));
+    snapshot.preamble.insert(snapshot.preamble.end(), record_bytes,
+                             record_bytes + records.size() *
+                                            sizeof(CheckpointItemRecord));
+  }
+
+  //======================================== Cell table
+  snapshot.cell_table_blocks = MakeCellTableBlocks(layout, cell_table_offset);
+  snapshot.cell_num_nodes.clear();
+  for (const auto* cell : layout.cells)
+    snapshot.cell_num_nodes.push_back(layout.cell_num_nodes[cell->local_id_]);
+}
+
+//###################################################################
+/**Writes the checkpoint items to the single restart file
+ * `<folder_name>/<file_base>.r` with collective MPI-IO. The data are
+ * keyed by global cell-id and cell node and can be read back on a
+ * different number of locations or partitioning.*/
+void lbs::LBSSolver::WriteRestartData(const std::string& folder_name,
+                                      const std::string& file_base)
+{
+  chi::PerfRegion perf_region("IO::WriteRestart");
+
+  MakeRestartFolder(folder_name);
+
+  CheckpointSnapshot snapshot;
+  FillCheckpointSnapshot(folder_name + "/" + file_base + ".r", snapshot);
+
+  if (WriteCheckpointSnapshot(snapshot))
+    Chi::log.Log() << "Successfully wrote restart data: "
+                   << snapshot.file_name;
   else
-    Chi::log.Log0Error()
-      << "Failed to write restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+    Chi::log.Log0Error() << "Failed to write restart data: "
+                         << snapshot.file_name;
 }
 
 //###################################################################
-/**Read phi_old from restart file.*/
-void lbs::LBSSolver::ReadRestartData(const std::string& folder_name,
+/**Reads the checkpoint items from the restart file
+ * `<folder_name>/<file_base>.r` with collective MPI-IO. The file may have
+ * been written on a different number of locations or with a different
+ * partitioning of the same mesh. Items missing from the file are left
+ * unchanged. Returns true if the file was read successfully.*/
+bool lbs::LBSSolver::ReadRestartData(const std::string& folder_name,
                                      const std::string& file_base)
 {
-  Chi::mpi.Barrier();
+  chi::PerfRegion perf_region("IO::ReadRestart");
 
-  //======================================== Open files
-  //This step might fail for specific locations and
-  //can create quite a messy output if we print it all.
-  //We also need to consolidate the error to determine if
-  //the process as whole succeeded.
-  bool location_succeeded = true;
-  char location_cstr[20];
-  snprintf(location_cstr,20,"%d.r", Chi::mpi.location_id);
+  const std::string file_name = folder_name + "/" + file_base + ".r";
+  const auto& sdm = *discretization_;
+  const auto items = MakeCheckpointItems();
+
+  //======================================== Open file
+  MPI_File file;
+  const int open_error =
+    MPI_File_open(Chi::mpi.comm, file_name.c_str(),
+                  MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  if (not AllLocationsSucceeded(open_error == MPI_SUCCESS))
+  {
+    if (open_error == MPI_SUCCESS) MPI_File_close(&file);
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name;
+    return false;
+  }
 
-  std::string file_name = folder_name + std::string("/") +
-                          file_base + std::string(location_cstr);
+  auto Fail = [&file, &file_name](const std::string& reason)
+  {
+    MPI_File_close(&file);
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name
+                         << ". " << reason;
+    return false;
+  };
+
+  //======================================== Header and item records
+  CheckpointFileHeader header;
+  MPI_File_read_at_all(file, 0, &header, sizeof(header), MPI_BYTE,
+                       MPI_STATUS_IGNORE);
+  if (std::memcmp(header.magic, CheckpointFileHeader::MAGIC,
+                  sizeof(header.magic)) != 0 or
+      header.version != CheckpointFileHeader::VERSION or
+      header.byte_order_mark != CheckpointFileHeader::BYTE_ORDER_MARK)
+    return Fail("Not a restart file of version " +
+                std::to_string(CheckpointFileHeader::VERSION) +
+                " with the host byte order.");
 
-  std::ifstream ifile;
-  ifile.open(file_name, std::ios::in | std::ios::binary );
+  const auto layout = MakeCheckpointLayout(*grid_ptr_, sdm);
+  if (header.num_global_cells != layout.num_global_cells or
+      header.num_global_nodes != layout.num_global_nodes)
+    return Fail("The file was written for a different mesh.");
 
-  if (not ifile.is_open())
+  std::vector<CheckpointItemRecord> records(header.num_items);
+  MPI_File_read_at_all(file, sizeof(header), records.data(),
+                       static_cast<int>(records.size() *
+                                        sizeof(CheckpointItemRecord)),
+                       MPI_BYTE, MPI_STATUS_IGNORE);
+
+  //======================================== Check cell table
+  const uint64_t cell_table_offset =
+    sizeof(CheckpointFileHeader) + records.size() * sizeof(CheckpointItemRecord);
   {
-    ifile.close();
-    location_succeeded = false;
+    std::vector<uint64_t> num_nodes(layout.cells.size(), 0);
+
+    bool location_succeeded =
+      CollectiveBlockIO(file, MakeCellTableBlocks(layout, cell_table_offset),
+                        MPI_UINT64_T, num_nodes.data(), /*write=*/false);
+    for (size_t c = 0; c < layout.cells.size(); ++c)
+      if (num_nodes[c] != layout.cell_num_nodes[layout.cells[c]->local_id_])
+        location_succeeded = false;
+
+    if (not AllLocationsSucceeded(location_succeeded))
+      return Fail("Cell node counts do not match the current "
+                  "discretization.");
   }
-  else
+
+  //======================================== Read items
+  bool location_succeeded = true;
+  for (const auto& item : items)
   {
-    size_t number_of_unknowns;
-    ifile.read((char*)&number_of_unknowns, sizeof(size_t));
+    const auto record = std::find_if(records.begin(), records.end(),
+      [&item](const CheckpointItemRecord& r)
+      {return std::strncmp(r.name, item.name.c_str(),
+                           CheckpointItemRecord::MAX_NAME_LENGTH) == 0;});
 
-    if (number_of_unknowns != phi_old_local_.size())
+    if (record == records.end())
     {
-      location_succeeded = false;
-      ifile.close();
+      Chi::log.Log0Warning() << "Restart file " << file_name
+                             << " does not contain " << item.name << ".";
+      continue;
     }
-    else
+    if (record->layout != static_cast<uint64_t>(item.layout) or
+        record->values_per_entry != ValuesPerEntry(item) or
+        record->compression >
+          static_cast<uint64_t>(chi::CompressionType::LOSSY))
+      return Fail("Item " + item.name + " has an incompatible layout.");
+
+    if (item.layout == CheckpointItem::Layout::SCALAR)
     {
-      std::vector<double> temp_phi_old(phi_old_local_.size(), 0.0);
+      *item.scalar = record->scalar_value;
+      continue;
+    }
 
-      size_t v=0;
-      while (not ifile.eof())
-      {
-        ifile.read((char*)&temp_phi_old[v], sizeof(double));
-        ++v;
-      }
+    const auto blocks = MakeItemBlocks(item, record->data_offset, layout, sdm);
+    if (record->compression !=
+        static_cast<uint64_t>(chi::CompressionType::NONE))
+    {
+      location_succeeded &=
+        ReadCompressedItem(file, *record, cell_table_offset, layout, blocks,
+                           *item.vector);
+      continue;
+    }
 
-      if (v != (number_of_unknowns+1))
-      {
-        location_succeeded = false;
-        ifile.close();
-      }
-      else
-        phi_old_local_ = std::move(temp_phi_old);
+    const auto& lengths = blocks.file_blocks.lengths;
+    std::vector<double> buffer(std::accumulate(lengths.begin(), lengths.end(),
+                                               size_t(0)));
+    location_succeeded &=
+      CollectiveBlockIO(file, blocks.file_blocks, MPI_DOUBLE,
+                        buffer.data(), /*write=*/false);
 
-      ifile.close();
+    size_t address = 0;
+    for (size_t b = 0; b < lengths.size(); ++b)
+    {
+      std::copy_n(buffer.begin() + static_cast<int64_t>(address),
+                  lengths[b],
+                  item.vector->begin() +
+                    static_cast<int64_t>(blocks.local_addresses[b]));
+      address += lengths[b];
     }
-  }
+  }//for item
 
-  //======================================== Wait for all processes
-  //                                         then check success status
-  Chi::mpi.Barrier();
-  bool global_succeeded = true;
-  MPI_Allreduce(&location_succeeded,   //Send buffer
-                &global_succeeded,     //Recv buffer
-                1,                     //count
-                MPI_CXX_BOOL,          //Data type
-                MPI_LAND,              //Operation - Logical and
-                Chi::mpi.comm);       //Communicator
+  MPI_File_close(&file);
 
   //======================================== Write status message
-  if (global_succeeded) Chi::log.Log() << "Successfully read restart data";
+  if (not AllLocationsSucceeded(location_succeeded))
+  {
+    Chi::log.Log0Error() << "Failed to read restart data: " << file_name;
+    return false;
+  }
+
+  Chi::log.Log() << "Successfully read restart data: " << file_name;
+  return true;
+}
+
+//###################################################################
+/**Writes restart data, when enabled, if this is the final write or if
+ * the restart write interval (in minutes) has elapsed since the last
+ * write. With asynchronous restart writes, interval writes only stage a
+ * snapshot of the solver state, which is flushed in the background while
+ * the solve continues. Such a write only blocks if the previous flush has
+ * not finished. The final write is synchronous. Collective.*/
+void lbs::LBSSolver::WriteRestartDataIfDue(bool final_write)
+{
+  if (not options_.write_restart_data) return;
+
+  //Location 0 decides, so that all locations take part in the write
+  const double time_minutes = Chi::program_timer.GetTime() / 60000.0;
+  bool write_due = final_write or
+    time_minutes - last_restart_write_ >= options_.write_restart_interval;
+  MPI_Bcast(&write_due,     //buffer
+            1, MPI_CXX_BOOL,//count + datatype
+            0,              //root
+            Chi::mpi.comm); //communicator
+  if (not write_due) return;
+
+  const auto& folder_name = options_.write_restart_folder_name;
+  const auto& file_base = options_.write_restart_file_base;
+
+  if (options_.write_restart_async and not final_write)
+  {
+    MakeRestartFolder(folder_name);
+    checkpoint_writer_.Wait();
+    FillCheckpointSnapshot(folder_name + "/" + file_base + ".r",
+                           checkpoint_staging_);
+    checkpoint_writer_.Start(checkpoint_staging_);
+  }
   else
-    Chi::log.Log0Error()
-      << "Failed to read restart data: "
-      << folder_name + std::string("/") +
-         file_base + std::string("X.r");
+  {
+    checkpoint_writer_.Wait();
+    WriteRestartData(folder_name, file_base);
+  }
+
+  last_restart_write_ = time_minutes;
 }
@@ -10,7 +10,8 @@
 #include <cstring>
 
 //###################################################################
-/**Writes the groupset's angular fluxes to file.*/
+/**Writes the groupset's angular fluxes to file, in the compact binary DOF
+ * format (see BinaryDOFFileHeader).*/
 void lbs::LBSSolver::
   WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
                              const std::string& file_base)
@@ -18,91 +19,15 @@ void lbs::LBSSolver::
   std::string file_name =
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
 
-  //============================================= Open file
-  std::ofstream file(file_name,
-                     std::ofstream::binary | //binary file
-                     std::ofstream::out |    //no accidental reading
-                     std::ofstream::trunc);  //clear file contents when opened
-
-  //============================================= Check file is open
-  if (not file.is_open())
-  {
-    Chi::log.LogAllWarning()
-      << __FUNCTION__ << "Failed to open " << file_name;
-    return;
-  }
-
-  //============================================= Write header
-  std::string header_info =
-    "Chi-Tech LinearBoltzmann::Groupset angular flux file\n"
-    "Header size: 320 bytes\n"
-    "Structure(type-info):\n"
-    "size_t-num_local_nodes\n"
-    "size_t-num_angles\n"
-    "size_t-num_groups\n"
-    "size_t-num_records\n"
-    "Each record:\n"
-    "size_t-cell_global_id\n"
-    "unsigned int-node_number\n"
-    "unsigned int-angle_num\n"
-    "unsigned int-group_num\n"
-    "double-angular_flux\n";
-
-  int header_size = (int)header_info.length();
-
-  char header_bytes[320];
-  memset(header_bytes, '-', 320);
-  strncpy(header_bytes, header_info.c_str(),std::min(header_size,319));
-  header_bytes[319]='\0';
-
-  file << header_bytes;
-
-  //============================================= Get relevant items
-  auto NODES_ONLY = chi_math::UnknownManager::GetUnitaryUnknownManager();
-
-  size_t num_local_nodes = discretization_->GetNumLocalDOFs(NODES_ONLY);
-  size_t num_angles      = groupset.quadrature_->abscissae_.size();
-  size_t num_groups      = groupset.groups_.size();
-  size_t num_local_dofs  = psi_new_local_[groupset.id_].size();
-  auto   dof_handler     = groupset.psi_uk_man_;
-
-  //============================================= Write num_ quantities
-  file.write((char*)&num_local_nodes,sizeof(size_t));
-  file.write((char*)&num_angles     ,sizeof(size_t));
-  file.write((char*)&num_groups     ,sizeof(size_t));
-  file.write((char*)&num_local_dofs ,sizeof(size_t));
-
-  auto& sdm = discretization_;
-
-  //============================================= Write per dof data
-  size_t dof_count=0;
-  for (const auto& cell : grid_ptr_->local_cells)
-  {
-    const size_t num_nodes = sdm->GetCellNumNodes(cell);
-    for (unsigned int i=0; i < num_nodes; ++i)
-      for (unsigned int n=0; n<num_angles; ++n)
-        for (unsigned int g=0; g<num_groups; ++g)
-        {
-          if (++dof_count > num_local_dofs) goto close_file;
-
-          uint64_t dof_map = sdm->MapDOFLocal(cell,i,dof_handler,n,g);
-          double value = psi_new_local_[groupset.id_][dof_map];
-
-          file.write((char*)&cell.global_id_, sizeof(size_t));
-          file.write((char*)&i             ,sizeof(unsigned int));
-          file.write((char*)&n             ,sizeof(unsigned int));
-          file.write((char*)&g             ,sizeof(unsigned int));
-          file.write((char*)&value         ,sizeof(double));
-        }
-  }
-
-  //============================================= Clean-up
-  close_file:
-  file.close();
+  WriteBinaryDOFFile(file_name,
+                     BinaryDOFFileHeader::ANGULAR_FLUXES,
+                     groupset.psi_uk_man_,
+                     psi_new_local_[groupset.id_]);
 }
 
 //###################################################################
-/**Prints the groupset's angular fluxes to file.*/
+/**Reads the groupset's angular fluxes from file. Both the compact binary
+ * DOF format and the older record-per-value format are supported.*/
 void lbs::LBSSolver::
   ReadGroupsetAngularFluxes(LBSGroupset& groupset,
                             const std::string& file_base)
@@ -110,6 +35,19 @@ void lbs::LBSSolver::
   std::string file_name =
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
 
+  //============================================= Compact binary format
+  if (IsBinaryDOFFile(file_name))
+  {
+    Chi::log.Log() << "Reading angular flux file " << file_name;
+    psi_new_local_[groupset.id_].resize(
+      discretization_->GetNumLocalDOFs(groupset.psi_uk_man_), 0.0);
+    ReadBinaryDOFFile(file_name,
+                      BinaryDOFFileHeader::ANGULAR_FLUXES,
+                      groupset.psi_uk_man_,
+                      psi_new_local_[groupset.id_]);
+    return;
+  }
+
   //============================================= Open file
   std::ifstream file(file_name,
                      std::ofstream::binary | //binary file
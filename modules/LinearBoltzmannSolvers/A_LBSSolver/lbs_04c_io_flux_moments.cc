@@ -2,6 +2,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 #include <fstream>
 #include <cstring>
@@ -31,136 +32,58 @@ std::vector<double> lbs::LBSSolver::
 
 
 //###################################################################
-/**Writes a given flux-moments vector to file.*/
+/**Writes a given flux-moments vector to file, in the compact binary DOF
+ * format (see BinaryDOFFileHeader).*/
 void lbs::LBSSolver::
   WriteFluxMoments(const std::string &file_base,
                    const std::vector<double>& flux_moments)
 {
+  chi::PerfRegion perf_region("IO::WriteFluxMoments");
+
   std::string file_name =
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
 
-  //============================================= Open file
   Chi::log.Log() << "Writing flux-moments to files with base-name " << file_base
                 << " and extension .data";
-  std::ofstream file(file_name,
-                     std::ofstream::binary | //binary file
-                     std::ofstream::out |    //no accidental reading
-                     std::ofstream::trunc);  //clear file contents when opened
 
-  //============================================= Check file is open
-  if (not file.is_open())
-  {
-    Chi::log.LogAllWarning()
-      << __FUNCTION__ << "Failed to open " << file_name;
-    return;
-  }
-
-  //============================================= Write header
-  std::string header_info =
-    "Chi-Tech LinearBoltzmann: Flux moments file\n"
-    "Header size: 500 bytes\n"
-    "Structure(type-info):\n"
-    "uint64_t num_local_nodes\n"
-    "uint64_t num_moments\n"
-    "uint64_t num_groups\n"
-    "uint64_t num_records\n"
-    "uint64_t num_cells\n"
-    "Each cell:\n"
-    "  uint64_t cell_global_id\n"
-    "  uint64_t num_nodes\n"
-    "  Each node:\n"
-    "    double   x_position\n"
-    "    double   y_position\n"
-    "    double   z_position\n"
-    "Each record:\n"
-    "  uint64_t     cell_global_id\n"
-    "  unsigned int node_number\n"
-    "  unsigned int moment_num\n"
-    "  unsigned int group_num\n"
-    "  double       flux_moment_value\n";
-
-  int header_size = (int)header_info.length();
-
-  char header_bytes[500];
-  memset(header_bytes, '-', 500);
-  strncpy(header_bytes, header_info.c_str(),std::min(header_size,499));
-  header_bytes[499]='\0';
-
-  file << header_bytes;
-
-  //============================================= Get relevant items
-  auto NODES_ONLY = chi_math::UnknownManager::GetUnitaryUnknownManager();
-  auto& sdm = discretization_;
-  uint64_t num_local_nodes = discretization_->GetNumLocalDOFs(NODES_ONLY);
-  uint64_t num_moments_t   = static_cast<uint64_t>(num_moments_);
-  uint64_t num_groups_t    = static_cast<uint64_t>(num_groups_);
-  uint64_t num_local_dofs  = discretization_->GetNumLocalDOFs(flux_moments_uk_man_);
-  uint64_t num_local_cells = grid_ptr_->local_cells.size();
-
-  //============================================= Write num_ quantities
-  file.write((char*)&num_local_nodes,sizeof(uint64_t));
-  file.write((char*)&num_moments_t  ,sizeof(uint64_t));
-  file.write((char*)&num_groups_t   ,sizeof(uint64_t));
-  file.write((char*)&num_local_dofs ,sizeof(uint64_t));
-  file.write((char*)&num_local_cells,sizeof(uint64_t));
-
-  //============================================= Write nodal positions for
-  //                                              each cell
-  for (const auto& cell : grid_ptr_->local_cells)
-  {
-    uint64_t cell_global_id = static_cast<uint64_t>(cell.global_id_);
-    file.write((char *) &cell_global_id, sizeof(uint64_t));
-
-    uint64_t num_nodes = discretization_->GetCellNumNodes(cell);
-    file.write((char *) &num_nodes, sizeof(uint64_t));
-
-    auto   node_locations = discretization_->GetCellNodeLocations(cell);
-    for (const auto& node : node_locations)
-    {
-      file.write((char *) &node.x, sizeof(double));
-      file.write((char *) &node.y, sizeof(double));
-      file.write((char *) &node.z, sizeof(double));
-    }//for node
-  }//for cell
-
-  //============================================= Write per dof data
-  for (const auto& cell : grid_ptr_->local_cells)
-    for (unsigned int i=0; i<sdm->GetCellNumNodes(cell); ++i)
-      for (unsigned int m=0; m<num_moments_t; ++m)
-        for (unsigned int g=0; g < num_groups_; ++g)
-        {
-          uint64_t cell_global_id = cell.global_id_;
-          uint64_t dof_map = sdm->MapDOFLocal(cell, i, flux_moments_uk_man_, m, g);
-
-          assert(dof_map < flux_moments.size());
-          double value = flux_moments[dof_map];
-
-          file.write((char*)&cell_global_id,sizeof(uint64_t));
-          file.write((char*)&i             ,sizeof(unsigned int));
-          file.write((char*)&m             ,sizeof(unsigned int));
-          file.write((char*)&g             ,sizeof(unsigned int));
-          file.write((char*)&value         ,sizeof(double));
-        }
-
-  //============================================= Clean-up
-  file.close();
+  WriteBinaryDOFFile(file_name,
+                     BinaryDOFFileHeader::FLUX_MOMENTS,
+                     flux_moments_uk_man_,
+                     flux_moments);
 }
 
 
 //###################################################################
-/**Reads a flux-moments vector from a file in the specified vector.*/
+/**Reads a flux-moments vector from a file in the specified vector. Both
+ * the compact binary DOF format and the older record-per-value format
+ * are supported.*/
 void lbs::LBSSolver::ReadFluxMoments(
   const std::string &file_base,
   std::vector<double>& flux_moments,
   bool single_file/*=false*/)
 {
+  chi::PerfRegion perf_region("IO::ReadFluxMoments");
+
   std::string file_name =
     file_base + std::to_string(Chi::mpi.location_id) + ".data";
   if (single_file)
     file_name = file_base + ".data";
 
-  //============================================= Open file
   Chi::log.Log() << "Reading flux-moments file " << file_name;
+
+  //============================================= Compact binary format
+  if (IsBinaryDOFFile(file_name))
+  {
+    flux_moments.assign(
+      discretization_->GetNumLocalDOFs(flux_moments_uk_man_), 0.0);
+    ReadBinaryDOFFile(file_name,
+                      BinaryDOFFileHeader::FLUX_MOMENTS,
+                      flux_moments_uk_man_,
+                      flux_moments);
+    return;
+  }
+
+  //============================================= Open file
   std::ifstream file(file_name,
                      std::ofstream::binary | //binary file
                      std::ofstream::in);     //no accidental writing
@@ -0,0 +1,364 @@
+#include "lbs_solver.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_log_exceptions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+/**Writes the contents of a vector as raw bytes.*/
+template<typename T>
+void WriteArray(std::ofstream& file, const std::vector<T>& data)
+{
+  file.write(reinterpret_cast<const char*>(data.data()),
+             static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+
+/**Reads raw bytes into a vector of the given size.*/
+template<typename T>
+void ReadArray(std::ifstream& file, std::vector<T>& data, uint64_t size)
+{
+  data.resize(size);
+  file.read(reinterpret_cast<char*>(data.data()),
+            static_cast<std::streamsize>(size * sizeof(T)));
+}
+}//namespace
+
+//###################################################################
+/**Writes a nodal unknown vector of the local cells, with the layout
+ * given by the unknown manager, to a compact binary DOF file (see
+ * BinaryDOFFileHeader). The values, compressed according to
+ * Options::output_compression, are written with a single bulk write.*/
+void lbs::LBSSolver::
+  WriteBinaryDOFFile(const std::string& file_name,
+                     BinaryDOFFileHeader::Content content,
+                     const chi_math::UnknownManager& uk_man,
+                     const std::vector<double>& values) const
+{
+  ChiInvalidArgumentIf(uk_man.dof_storage_type_ !=
+                       chi_math::UnknownStorageType::NODAL,
+                       "Binary DOF files require nodal unknown storage.");
+
+  const auto& sdm = *discretization_;
+  const uint64_t num_unknowns_per_node = uk_man.GetTotalUnknownStructureSize();
+  const uint64_t num_local_cells = grid_ptr_->local_cells.size();
+
+  //============================================= Build cell table
+  std::vector<uint64_t> cell_global_ids, cell_num_nodes;
+  std::vector<uint64_t> cell_value_offsets = {0};
+  std::vector<double>   node_locations;
+  cell_global_ids.reserve(num_local_cells);
+  cell_num_nodes.reserve(num_local_cells);
+  cell_value_offsets.reserve(num_local_cells + 1);
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const uint64_t num_nodes = sdm.GetCellNumNodes(cell);
+    ChiLogicalErrorIf(static_cast<uint64_t>(
+                        sdm.MapDOFLocal(cell, 0, uk_man, 0, 0)) !=
+                      cell_value_offsets.back(),
+                      "Unknowns are not stored contiguously per cell.");
+
+    cell_global_ids.push_back(cell.global_id_);
+    cell_num_nodes.push_back(num_nodes);
+    cell_value_offsets.push_back(cell_value_offsets.back() +
+                                 num_nodes * num_unknowns_per_node);
+
+    for (const auto& node : sdm.GetCellNodeLocations(cell))
+      node_locations.insert(node_locations.end(), {node.x, node.y, node.z});
+  }
+  ChiInvalidArgumentIf(cell_value_offsets.back() != values.size(),
+                       "Vector size does not match the unknown manager.");
+
+  //============================================= Header
+  BinaryDOFFileHeader header;
+  std::copy(std::begin(BinaryDOFFileHeader::MAGIC),
+            std::end(BinaryDOFFileHeader::MAGIC), header.magic);
+  header.version = BinaryDOFFileHeader::VERSION;
+  header.byte_order_mark = BinaryDOFFileHeader::BYTE_ORDER_MARK;
+  header.content = content;
+  header.num_cells = num_local_cells;
+  header.num_nodes = node_locations.size() / 3;
+  header.num_unknowns = uk_man.unknowns_.size();
+  header.num_components = uk_man.unknowns_.empty() ? 0 :
+                          uk_man.unknowns_.front().NumComponents();
+  header.num_values = values.size();
+
+  const auto compression = options_.output_compression;
+  std::vector<char> compressed_values;
+  if (compression != chi::CompressionType::NONE)
+    compressed_values = chi::CompressDoubles(values.data(), values.size(),
+                                             compression,
+                                             options_.output_compression_tolerance);
+  header.compression = static_cast<uint64_t>(compression);
+  header.compression_tolerance = options_.output_compression_tolerance;
+  header.num_value_bytes = compression == chi::CompressionType::NONE ?
+                           8 * values.size() : compressed_values.size();
+
+  //============================================= Write file
+  std::ofstream file(file_name,
+                     std::ofstream::binary | //binary file
+                     std::ofstream::out |    //no accidental reading
+                     std::ofstream::trunc);  //clear file contents when opened
+
+  if (not file.is_open())
+  {
+    Chi::log.LogAllWarning()
+      << __FUNCTION__ << "Failed to open " << file_name;
+    return;
+  }
+
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  WriteArray(file, cell_global_ids);
+  WriteArray(file, cell_num_nodes);
+  WriteArray(file, cell_value_offsets);
+  WriteArray(file, node_locations);
+  if (compression == chi::CompressionType::NONE)
+    WriteArray(file, values);
+  else
+    WriteArray(file, compressed_values);
+
+  if (not file.good())
+    throw std::runtime_error("Failed to write " + file_name + ".");
+  file.close();
+}
+
+//###################################################################
+/**Reads a nodal unknown vector from a compact binary DOF file into the
+ * given vector, which must already be sized to the local number of
+ * unknowns of the unknown manager. Cells are located with the file's
+ * cell table and their nodes are matched by location, so the file may
+ * contain only some of the local cells, or cells of other locations.
+ * When the file holds exactly the local cells, in the same order and
+ * with the same nodes, the values are read with a single bulk read.
+ * Compressed values are read and decompressed as a whole.
+ * Returns false if the file could not be opened or is incompatible.*/
+bool lbs::LBSSolver::
+  ReadBinaryDOFFile(const std::string& file_name,
+                    BinaryDOFFileHeader::Content content,
+                    const chi_math::UnknownManager& uk_man,
+                    std::vector<double>& values) const
+{
+  const auto& sdm = *discretization_;
+  const uint64_t num_unknowns_per_node = uk_man.GetTotalUnknownStructureSize();
+
+  std::ifstream file(file_name,
+                     std::ifstream::binary | //binary file
+                     std::ifstream::in);     //no accidental writing
+
+  if (not file.is_open())
+  {
+    Chi::log.LogAllWarning()
+      << __FUNCTION__ << "Failed to open " << file_name;
+    return false;
+  }
+
+  //============================================= Check header
+  BinaryDOFFileHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+  if (not file.good() or
+      std::memcmp(header.magic, BinaryDOFFileHeader::MAGIC,
+                  sizeof(header.magic)) != 0 or
+      header.version != BinaryDOFFileHeader::VERSION or
+      header.byte_order_mark != BinaryDOFFileHeader::BYTE_ORDER_MARK)
+    throw std::runtime_error(file_name + " is not a binary DOF file of "
+                             "version " +
+                             std::to_string(BinaryDOFFileHeader::VERSION) +
+                             " with the host byte order.");
+
+  //The counts are bounded by the file size before FileSize is evaluated,
+  //so that corrupt counts can neither overflow it nor cause huge
+  //allocations
+  file.seekg(0, std::ifstream::end);
+  const auto file_size = static_cast<uint64_t>(file.tellg());
+  if (header.num_cells > file_size / 24 or
+      header.num_nodes > file_size / 24 or
+      header.num_value_bytes > file_size or
+      file_size != header.FileSize() or
+      header.compression > static_cast<uint64_t>(chi::CompressionType::LOSSY))
+    throw std::runtime_error(file_name + " is truncated or corrupt.");
+  file.seekg(sizeof(header), std::ifstream::beg);
+
+  const uint64_t num_components = uk_man.unknowns_.empty() ? 0 :
+                                  uk_man.unknowns_.front().NumComponents();
+  if (header.content != content or
+      header.num_unknowns != uk_man.unknowns_.size() or
+      header.num_components != num_components)
+  {
+    Chi::log.LogAll()
+      << "Incompatible DOF data found in file " << file_name << "\n"
+      << "File data vs system:\n"
+      << "num_unknowns  : " << header.num_unknowns << " vs "
+      << uk_man.unknowns_.size() << "\n"
+      << "num_components: " << header.num_components << " vs "
+      << num_components << "\n";
+    return false;
+  }
+
+  //============================================= Read cell table
+  const uint64_t Nc = header.num_cells;
+  std::vector<uint64_t> cell_global_ids, cell_num_nodes, cell_value_offsets;
+  std::vector<double>   node_locations;
+  ReadArray(file, cell_global_ids, Nc);
+  ReadArray(file, cell_num_nodes, Nc);
+  ReadArray(file, cell_value_offsets, Nc + 1);
+  ReadArray(file, node_locations, 3 * header.num_nodes);
+
+  if (not file.good())
+    throw std::runtime_error("Failed to read " + file_name + ".");
+
+  //============================================= Check cell table
+  //Every cell's values must lie within the values and every cell's nodes
+  //within the node locations
+  const auto compression =
+    static_cast<chi::CompressionType>(header.compression);
+  bool valid_table =
+    header.num_values == header.num_nodes * num_unknowns_per_node and
+    (compression != chi::CompressionType::NONE or
+     header.num_value_bytes == 8 * header.num_values) and
+    cell_value_offsets[0] == 0 and
+    cell_value_offsets[Nc] == header.num_values;
+
+  std::vector<uint64_t> cell_node_offsets(Nc + 1, 0);
+  for (uint64_t c = 0; c < Nc and valid_table; ++c)
+  {
+    valid_table = cell_num_nodes[c] <= header.num_nodes -
+                                       cell_node_offsets[c] and
+                  cell_value_offsets[c] <= cell_value_offsets[c + 1] and
+                  cell_value_offsets[c + 1] - cell_value_offsets[c] ==
+                  cell_num_nodes[c] * num_unknowns_per_node;
+    cell_node_offsets[c + 1] = cell_node_offsets[c] + cell_num_nodes[c];
+  }
+  valid_table = valid_table and cell_node_offsets[Nc] == header.num_nodes;
+
+  if (not valid_table)
+    throw std::runtime_error(file_name + " has an invalid cell table.");
+
+  //============================================= Map file cells and nodes
+  //                                              to local cells and nodes
+  struct CellMapping
+  {
+    uint64_t file_cell = 0;
+    const chi_mesh::Cell* cell = nullptr;
+    std::vector<uint64_t> node_map; ///< file node to system node
+  };
+  std::vector<CellMapping> cell_mappings;
+  bool identical_layout = Nc == grid_ptr_->local_cells.size() and
+                          header.num_values == values.size();
+
+  for (uint64_t c = 0; c < Nc; ++c)
+  {
+    const uint64_t cell_global_id = cell_global_ids[c];
+    if (not grid_ptr_->IsCellLocal(cell_global_id))
+    {
+      identical_layout = false;
+      continue;
+    }
+
+    const auto& cell = grid_ptr_->cells[cell_global_id];
+    if (cell.local_id_ != c) identical_layout = false;
+
+    const auto system_nodes = sdm.GetCellNodeLocations(cell);
+    const uint64_t num_nodes = cell_num_nodes[c];
+    if (system_nodes.size() != num_nodes)
+      throw std::logic_error(std::string(__FUNCTION__) +
+        ": Incompatible number of nodes for a cell was encountered. Mapping "
+        "could not be performed.");
+
+    CellMapping mapping{c, &cell, std::vector<uint64_t>(num_nodes)};
+    for (uint64_t n = 0; n < num_nodes; ++n)
+    {
+      const double* xyz = &node_locations[3 * (cell_node_offsets[c] + n)];
+      const chi_mesh::Vector3 file_node(xyz[0], xyz[1], xyz[2]);
+
+      bool mapping_found = false;
+      for (uint64_t m = 0; m < num_nodes; ++m)
+        if ((system_nodes[m] - file_node).NormSquare() < 1.0e-12)
+        {
+          mapping.node_map[n] = m;
+          mapping_found = true;
+          break;
+        }
+
+      if (not mapping_found)
+        throw std::logic_error(std::string(__FUNCTION__) +
+          ": Incompatible node locations for a cell was encountered. Mapping "
+          "unsuccessful.");
+      if (mapping.node_map[n] != n) identical_layout = false;
+    }
+
+    cell_mappings.push_back(std::move(mapping));
+  }//for file cell
+
+  //============================================= Read values
+  std::vector<double> file_values; //Only when compressed
+
+  file.seekg(static_cast<std::streamoff>(header.ValuesOffset()),
+             std::ifstream::beg);
+  if (compression != chi::CompressionType::NONE)
+  {
+    std::vector<char> compressed_values;
+    ReadArray(file, compressed_values, header.num_value_bytes);
+    file_values.resize(header.num_values);
+    chi::DecompressDoubles(compressed_values.data(), compressed_values.size(),
+                           compression, header.compression_tolerance,
+                           file_values.data(), file_values.size());
+  }
+
+  if (identical_layout)
+  {
+    if (compression != chi::CompressionType::NONE)
+      values = file_values;
+    else
+      file.read(reinterpret_cast<char*>(values.data()),
+                static_cast<std::streamsize>(values.size() * sizeof(double)));
+  }
+  else
+  {
+    // Cell mappings are in file order, hence reads only seek forward
+    std::vector<double> cell_values;
+    for (const auto& mapping : cell_mappings)
+    {
+      const uint64_t c = mapping.file_cell;
+      const uint64_t num_cell_values =
+        cell_value_offsets[c + 1] - cell_value_offsets[c];
+
+      if (compression != chi::CompressionType::NONE)
+      {
+        const auto begin = file_values.begin() +
+                           static_cast<int64_t>(cell_value_offsets[c]);
+        cell_values.assign(begin, begin + num_cell_values);
+      }
+      else
+      {
+        file.seekg(static_cast<std::streamoff>(header.ValuesOffset() +
+                                               8 * cell_value_offsets[c]),
+                   std::ifstream::beg);
+        ReadArray(file, cell_values, num_cell_values);
+      }
+
+      for (uint64_t n = 0; n < mapping.node_map.size(); ++n)
+      {
+        const int64_t address = sdm.MapDOFLocal(*mapping.cell,
+                                                mapping.node_map[n],
+                                                uk_man, 0, 0);
+        std::copy_n(cell_values.begin() +
+                      static_cast<int64_t>(n * num_unknowns_per_node),
+                    num_unknowns_per_node,
+                    values.begin() + address);
+      }
+    }//for cell mapping
+  }
+
+  if (not file.good())
+    throw std::runtime_error("Failed to read " + file_name + ".");
+
+  Chi::log.Log0Verbose1() << "Read " << cell_mappings.size()
+                          << " cells from " << file_name;
+
+  return true;
+}
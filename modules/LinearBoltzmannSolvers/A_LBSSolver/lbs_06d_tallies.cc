@@ -0,0 +1,215 @@
+#include "A_LBSSolver/lbs_solver.h"
+
+#include "mesh/LogicalVolume/LogicalVolume.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace
+{
+/**Returns the cross section of a tally reaction, or nullptr for flux
+ * tallies.*/
+const std::vector<double>* ReactionXS(const chi_physics::MultiGroupXS& xs,
+                                      lbs::TallyReaction reaction)
+{
+  switch (reaction)
+  {
+    case lbs::TallyReaction::TOTAL:      return &xs.SigmaTotal();
+    case lbs::TallyReaction::ABSORPTION: return &xs.SigmaAbsorption();
+    case lbs::TallyReaction::FISSION:
+    case lbs::TallyReaction::POWER:      return &xs.SigmaFission();
+    case lbs::TallyReaction::NU_FISSION: return &xs.NuSigmaF();
+    default:                             return nullptr;
+  }
+}
+}//namespace
+
+//###################################################################
+/**Adds an in-situ tally. Tallies are evaluated by ComputeTallies.*/
+void lbs::LBSSolver::AddTally(Tally tally)
+{
+  for (const auto& existing : tallies_)
+    ChiInvalidArgumentIf(existing.name == tally.name,
+                         "A tally named \"" + tally.name +
+                         "\" already exists.");
+
+  const auto& bins = tally.bin_first_groups;
+  ChiInvalidArgumentIf(bins.empty() or bins.front() != 0,
+                       "Tally \"" + tally.name + "\": group bins must start "
+                       "at group 0.");
+  for (size_t b = 1; b < bins.size(); ++b)
+    ChiInvalidArgumentIf(bins[b] <= bins[b - 1],
+                         "Tally \"" + tally.name + "\": group bins must be "
+                         "increasing.");
+
+  tally.values.assign(bins.size(), 0.0);
+  tallies_.push_back(std::move(tally));
+  cell_tally_ids_valid_ = false;
+}
+
+//###################################################################
+const std::vector<lbs::Tally>& lbs::LBSSolver::Tallies() const
+{
+  return tallies_;
+}
+
+//###################################################################
+/**Returns the tally with the given name.*/
+const lbs::Tally& lbs::LBSSolver::GetTally(const std::string& name) const
+{
+  for (const auto& tally : tallies_)
+    if (tally.name == name) return tally;
+
+  throw std::invalid_argument("No tally named \"" + name + "\" exists.");
+}
+
+//###################################################################
+/**Determines, once per partitioning, which tallies contain each local
+ * cell so that evaluations never query the logical volumes.*/
+void lbs::LBSSolver::MapTallyCells()
+{
+  for (const auto& tally : tallies_)
+    ChiInvalidArgumentIf(tally.bin_first_groups.back() >= num_groups_,
+                         "Tally \"" + tally.name + "\": group bin beyond "
+                         "the last group.");
+
+  cell_tally_ids_.assign(grid_ptr_->local_cells.size(), {});
+  for (const auto& cell : grid_ptr_->local_cells)
+    for (size_t t = 0; t < tallies_.size(); ++t)
+    {
+      const auto& logical_volume = tallies_[t].logical_volume;
+      if (not logical_volume or logical_volume->Inside(cell.centroid_))
+        cell_tally_ids_[cell.local_id_].push_back(t);
+    }
+
+  cell_tally_ids_valid_ = true;
+}
+
+//###################################################################
+/**Evaluates all tallies from the current scalar flux (phi-old) in a
+ * single pass over the local cells. The cell-integrated group fluxes are
+ * computed once per cell and shared by all tallies containing the cell.
+ * The values of all tallies are reduced with a single collective.*/
+void lbs::LBSSolver::ComputeTallies()
+{
+  if (tallies_.empty()) return;
+  if (not cell_tally_ids_valid_) MapTallyCells();
+
+  //============================================= Layout of all bins in
+  //                                              one buffer
+  const size_t num_tallies = tallies_.size();
+  std::vector<size_t> tally_offsets(num_tallies + 1, 0);
+  std::vector<std::vector<size_t>> group_to_bin(num_tallies);
+  for (size_t t = 0; t < num_tallies; ++t)
+  {
+    const auto& bins = tallies_[t].bin_first_groups;
+    tally_offsets[t + 1] = tally_offsets[t] + bins.size();
+
+    auto& map = group_to_bin[t];
+    map.assign(num_groups_, 0);
+    for (size_t b = 1; b < bins.size(); ++b)
+      for (size_t g = bins[b]; g < num_groups_; ++g)
+        map[g] = b;
+  }
+
+  //============================================= Accumulate local values
+  const auto& phi = phi_old_local_;
+  std::vector<double> local_values(tally_offsets.back(), 0.0);
+  std::vector<double> cell_phi(num_groups_);
+
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const auto& tally_ids = cell_tally_ids_[cell.local_id_];
+    if (tally_ids.empty()) continue;
+
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const auto& cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto& xs = transport_view.XS();
+
+    //==================================== Cell integrated group fluxes
+    cell_phi.assign(num_groups_, 0.0);
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+    {
+      const size_t uk_map = transport_view.MapDOF(i, 0, 0);
+      const double IntV_ShapeI = cell_matrices.Vi_vectors[i];
+      for (size_t g = 0; g < num_groups_; ++g)
+        cell_phi[g] += phi[uk_map + g] * IntV_ShapeI;
+    }
+
+    //==================================== Contributions
+    for (const size_t t : tally_ids)
+    {
+      const auto reaction = tallies_[t].reaction;
+      const auto* sigma = ReactionXS(xs, reaction);
+      const bool fission_reaction = reaction == TallyReaction::FISSION or
+                                    reaction == TallyReaction::NU_FISSION or
+                                    reaction == TallyReaction::POWER;
+      if (fission_reaction and not xs.IsFissionable()) continue;
+      if (sigma and sigma->size() < num_groups_) continue;
+
+      const double factor = reaction == TallyReaction::POWER ?
+                            options_.power_default_kappa : 1.0;
+      const auto& bin = group_to_bin[t];
+      double* values = &local_values[tally_offsets[t]];
+
+      for (size_t g = 0; g < num_groups_; ++g)
+        values[bin[g]] += factor * (sigma ? (*sigma)[g] : 1.0) * cell_phi[g];
+    }
+  }//for cell
+
+  //============================================= Reduce all tallies at once
+  std::vector<double> global_values(local_values.size(), 0.0);
+  MPI_Allreduce(local_values.data(),                   //sendbuf
+                global_values.data(),                  //recvbuf
+                static_cast<int>(local_values.size()), //count
+                MPI_DOUBLE,                            //datatype
+                MPI_SUM,                               //operation
+                Chi::mpi.comm);                        //communicator
+
+  for (size_t t = 0; t < num_tallies; ++t)
+    tallies_[t].values.assign(global_values.begin() + tally_offsets[t],
+                              global_values.begin() + tally_offsets[t + 1]);
+  ++num_tally_evaluations_;
+
+  if (not options_.tally_output_file.empty() and Chi::mpi.location_id == 0)
+    WriteTallyValues();
+
+  Chi::log.Log() << TextName() << ": Computed " << num_tallies
+                 << " tallies, evaluation " << num_tally_evaluations_;
+}
+
+//###################################################################
+/**Appends the values of the last evaluation as one row of the tally
+ * output file. The first evaluation replaces the file and writes a
+ * header naming every column.*/
+void lbs::LBSSolver::WriteTallyValues() const
+{
+  const auto& file_name = options_.tally_output_file;
+  const bool first = num_tally_evaluations_ == 1;
+
+  std::ofstream file(file_name, first ? std::ios_base::trunc
+                                      : std::ios_base::app);
+  if (not file.is_open())
+    throw std::runtime_error("Failed to open tally output file " +
+                             file_name + ".");
+
+  if (first)
+  {
+    file << "evaluation";
+    for (const auto& tally : tallies_)
+      for (const size_t g : tally.bin_first_groups)
+        file << " " << tally.name << "_g" << g;
+    file << "\n";
+  }
+
+  file << num_tally_evaluations_ << std::scientific << std::setprecision(12);
+  for (const auto& tally : tallies_)
+    for (const double value : tally.values)
+      file << " " << value;
+  file << "\n";
+}
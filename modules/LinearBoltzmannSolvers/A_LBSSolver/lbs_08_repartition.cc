@@ -0,0 +1,271 @@
+#include "lbs_solver.h"
+
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/VolumeMesher/chi_volumemesher.h"
+#include "mesh/chi_mesh_sfc.h"
+#include "physics/FieldFunction/fieldfunction_gridbased.h"
+
+#include "mpi/chi_mpi_utils_map_all2all.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_log_exceptions.h"
+#include "chi_mpi.h"
+#include "utils/chi_timer.h"
+
+#include <algorithm>
+
+namespace
+{
+//###################################################################
+/**Returns the maximum and average over all locations of a local value.*/
+std::pair<double, double> MaxAndAverage(double local_value)
+{
+  double max_value = 0.0, sum_value = 0.0;
+  MPI_Allreduce(&local_value, //sendbuf
+                &max_value,   //recvbuf
+                1, MPI_DOUBLE, //count+datatype
+                MPI_MAX,      //operation
+                Chi::mpi.comm);//comm
+  MPI_Allreduce(&local_value, //sendbuf
+                &sum_value,   //recvbuf
+                1, MPI_DOUBLE, //count+datatype
+                MPI_SUM,      //operation
+                Chi::mpi.comm);//comm
+
+  return {max_value, sum_value / Chi::mpi.process_count};
+}
+}//namespace
+
+//###################################################################
+/**Repartitions the grid such that every location carries roughly the
+ * same measured transport cost, and migrates the solver's unknowns to
+ * the new partitions. The per-cell costs are those accumulated since
+ * the last repartitioning when the option `measure_cell_costs` is set.
+ * Without measurements the number of nodes squared is used as the cell
+ * cost.
+ *
+ * The new partitions are computed from a Hilbert curve through the cell
+ * centroids, which keeps the migration to a small number of locations
+ * when the costs change slowly. Afterwards the spatial discretization,
+ * the parallel arrays, the field functions, the boundaries and the
+ * solver schemes are rebuilt on the new grid. Flux moments, angular
+ * fluxes and precursors are carried over. Collective, and must be called
+ * between solves. Returns the global number of cells that moved to
+ * another location.*/
+uint64_t lbs::LBSSolver::Repartition()
+{
+  auto& mesh_handler = chi_mesh::GetCurrentHandler();
+  ChiLogicalErrorIf(mesh_handler.GetGrid() != grid_ptr_,
+                    "The solver's grid is not the grid of the current mesh "
+                    "handler.");
+  auto& mesher = mesh_handler.GetVolumeMesher();
+
+  // Sweeps on a partitioning that is not KBA-style can have cycles
+  if (Chi::mpi.process_count > 1 and
+      options_.geometry_type != GeometryType::ONED_SLAB)
+    for (const auto& groupset : groupsets_)
+      ChiLogicalErrorIf(not groupset.allow_cycles_,
+                        "Repartitioning requires all groupsets to allow "
+                        "cycles.");
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Repartitioning " << TextName() << ".";
+
+  //======================================== Cell costs
+  const size_t num_local_cells = grid_ptr_->local_cells.size();
+  std::vector<double> weights(num_local_cells, 0.0);
+  std::vector<chi_mesh::Vector3> centroids(num_local_cells);
+  double local_cost = 0.0;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    weights[cell.local_id_] =
+      cell_transport_views_[cell.local_id_].MeasuredCost();
+    centroids[cell.local_id_] = cell.centroid_;
+    local_cost += weights[cell.local_id_];
+  }
+
+  double global_cost = 0.0;
+  MPI_Allreduce(&local_cost,  //sendbuf
+                &global_cost, //recvbuf
+                1, MPI_DOUBLE, //count+datatype
+                MPI_SUM,      //operation
+                Chi::mpi.comm);//comm
+
+  if (global_cost <= 0.0)
+  {
+    Chi::log.Log() << "No measured cell costs available. Using the number "
+                      "of cell nodes squared as cell cost.";
+    local_cost = 0.0;
+    for (const auto& cell : grid_ptr_->local_cells)
+    {
+      const double num_nodes =
+        cell_transport_views_[cell.local_id_].NumNodes();
+      weights[cell.local_id_] = num_nodes * num_nodes;
+      local_cost += weights[cell.local_id_];
+    }
+  }
+
+  //======================================== New partitions
+  const auto new_pids = chi_mesh::sfc::PartitionPoints(centroids,
+                                                       weights,
+                                                       /*hilbert=*/true);
+
+  std::vector<double> new_location_costs(Chi::mpi.process_count, 0.0);
+  for (size_t c = 0; c < num_local_cells; ++c)
+    new_location_costs[new_pids[c]] += weights[c];
+  MPI_Allreduce(MPI_IN_PLACE,              //sendbuf
+                new_location_costs.data(), //recvbuf
+                Chi::mpi.process_count, MPI_DOUBLE, //count+datatype
+                MPI_SUM,                   //operation
+                Chi::mpi.comm);            //comm
+
+  const auto [max_cost, avg_cost] = MaxAndAverage(local_cost);
+  const double new_max_cost = *std::max_element(new_location_costs.begin(),
+                                                new_location_costs.end());
+  if (avg_cost > 0.0)
+    Chi::log.Log() << "Cost imbalance (max/avg) before repartitioning: "
+                   << max_cost / avg_cost
+                   << ", predicted after: " << new_max_cost / avg_cost;
+
+  uint64_t num_migrated = 0;
+  for (size_t c = 0; c < num_local_cells; ++c)
+    if (new_pids[c] != static_cast<int64_t>(Chi::mpi.location_id))
+      ++num_migrated;
+  MPI_Allreduce(MPI_IN_PLACE,              //sendbuf
+                &num_migrated,             //recvbuf
+                1, MPI_UINT64_T,           //count+datatype
+                MPI_SUM,                   //operation
+                Chi::mpi.comm);            //comm
+
+  //======================================== Pack unknowns
+  // Per cell: phi-old, phi-new, psi per groupset and the precursors, in
+  // the order given by the cell's transport view and dof mapping.
+  auto PackOrUnpackCell = [this](const chi_mesh::Cell& cell,
+                                 std::vector<double>& buffer,
+                                 size_t& address,
+                                 bool pack)
+  {
+    const auto& sdm = *discretization_;
+    auto Transfer = [&buffer, &address, pack](double& value)
+    {
+      if (pack) buffer.push_back(value);
+      else value = buffer[address++];
+    };
+
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+      for (size_t m = 0; m < num_moments_; ++m)
+        for (size_t g = 0; g < num_groups_; ++g)
+        {
+          const size_t dof_map = transport_view.MapDOF(i, m, g);
+          Transfer(phi_old_local_[dof_map]);
+          Transfer(phi_new_local_[dof_map]);
+        }
+
+    if (options_.save_angular_flux)
+      for (auto& groupset : groupsets_)
+      {
+        const size_t num_angles = groupset.quadrature_->abscissae_.size();
+        const size_t num_gs_groups = groupset.groups_.size();
+        auto& psi = psi_new_local_[groupset.id_];
+        for (int i = 0; i < num_nodes; ++i)
+          for (size_t n = 0; n < num_angles; ++n)
+            for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+              Transfer(psi[sdm.MapDOFLocal(cell, i, groupset.psi_uk_man_,
+                                           n, gsg)]);
+      }
+
+    if (options_.use_precursors)
+      for (size_t j = 0; j < max_precursors_per_material_; ++j)
+        Transfer(precursor_new_local_[
+          cell.local_id_ * max_precursors_per_material_ + j]);
+  };
+
+  std::map<int, std::vector<uint64_t>> cell_ids_to_send;
+  std::map<int, std::vector<double>> cell_data_to_send;
+  for (auto& cell : grid_ptr_->local_cells)
+  {
+    const auto location = static_cast<int>(new_pids[cell.local_id_]);
+    cell_ids_to_send[location].push_back(cell.global_id_);
+    size_t address = 0;
+    PackOrUnpackCell(cell, cell_data_to_send[location], address, true);
+  }
+
+  const auto cell_ids_received =
+    chi_mpi_utils::MapAllToAll(cell_ids_to_send, MPI_UINT64_T);
+  cell_ids_to_send.clear();
+  auto cell_data_received =
+    chi_mpi_utils::MapAllToAll(cell_data_to_send, MPI_DOUBLE);
+  cell_data_to_send.clear();
+
+  //======================================== Migrate grid
+  // The old grid is kept alive until the objects referring to it have
+  // been replaced
+  auto old_grid = grid_ptr_;
+  auto new_grid = grid_ptr_->MakeRepartitioned(new_pids);
+  mesher.SetContinuum(new_grid);
+  new_grid->RegisterMemoryUsage();
+  mesher.options.partition_type = chi_mesh::VolumeMesher::SFC_HILBERT;
+  grid_ptr_ = new_grid;
+
+  //======================================== Rebuild solver structures
+  const bool read_restart_data = options_.read_restart_data;
+  options_.read_restart_data = false;
+
+  InitMaterials();
+  unit_ghost_cell_matrices_.clear();
+  InitializeSpatialDiscretization();
+  InitializeParrays();
+  options_.read_restart_data = read_restart_data;
+
+  // Field functions hold the old discretization and are replaced in
+  // place, keeping their names and stack positions.
+  for (auto& field_function : field_functions_)
+  {
+    auto new_field_function =
+      std::make_shared<chi_physics::FieldFunctionGridBased>(
+        field_function->TextName(),
+        discretization_,
+        chi_math::Unknown(chi_math::UnknownType::SCALAR));
+
+    std::replace(Chi::field_function_stack.begin(),
+                 Chi::field_function_stack.end(),
+                 std::static_pointer_cast<chi_physics::FieldFunction>(
+                   field_function),
+                 std::static_pointer_cast<chi_physics::FieldFunction>(
+                   new_field_function));
+    field_function = new_field_function;
+  }
+
+  InitializeBoundaries();
+  InitializePointSources();
+  cell_tally_ids_valid_ = false;
+
+  //======================================== Unpack unknowns
+  for (auto& [location, gids] : cell_ids_received)
+  {
+    auto& data = cell_data_received.at(location);
+    size_t address = 0;
+    for (uint64_t gid : gids)
+      PackOrUnpackCell(grid_ptr_->cells[gid], data, address, false);
+  }
+
+  InitializeAfterRepartition();
+  UpdateFieldFunctions();
+
+  Chi::log.Log() << Chi::program_timer.GetTimeString()
+                 << " Done repartitioning. Local cells: "
+                 << grid_ptr_->local_cells.size()
+                 << ", cells migrated: " << num_migrated;
+
+  return num_migrated;
+}
+
+//###################################################################
+/**Rebuilds the solver schemes after the grid has been repartitioned.*/
+void lbs::LBSSolver::InitializeAfterRepartition()
+{
+  InitializeSolverSchemes();
+}
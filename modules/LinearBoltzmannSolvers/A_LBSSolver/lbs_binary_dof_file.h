@@ -0,0 +1,86 @@
+#ifndef CHITECH_LBS_BINARY_DOF_FILE_H
+#define CHITECH_LBS_BINARY_DOF_FILE_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace lbs
+{
+
+//##################################################
+/**Header of the compact binary format for nodal unknown vectors, i.e.,
+ * flux moments and groupset angular fluxes. One file is written per
+ * location. Per-cell information is written once, followed by the values
+ * in their in-memory (nodal) layout so that a whole vector is written or
+ * read with a single bulk operation.
+ *
+ * The header is followed by arrays stored in host byte order, in the
+ * order listed below. Nc is the number of cells (local-id order), Nn the
+ * total number of nodes and Nv the number of values:
+ * - uint64 cell_global_ids[Nc]
+ * - uint64 cell_num_nodes[Nc]
+ * - uint64 cell_value_offsets[Nc+1], offsets of each cell's values
+ * - double node_locations[3*Nn]
+ * - double values[Nv], or num_value_bytes of compressed values
+ *
+ * For a cell, the values are ordered by node, then by unknown (moment or
+ * angle), then by component (group). The cell table acts as an index for
+ * random access to the values of any cell. Compressed values (see
+ * chi::CompressDoubles) are decompressed as a whole by readers.*/
+struct BinaryDOFFileHeader
+{
+  static constexpr char     MAGIC[8] = {'C','H','I','L','B','S','D','F'};
+  static constexpr uint64_t VERSION = 2;
+  /**Written as-is to detect files written with another byte order.*/
+  static constexpr uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+
+  enum Content : uint64_t
+  {
+    FLUX_MOMENTS   = 1,
+    ANGULAR_FLUXES = 2
+  };
+
+  char     magic[8] = {};
+  uint64_t version = 0;
+  uint64_t byte_order_mark = 0;
+  uint64_t content = 0;
+
+  uint64_t num_cells = 0;
+  uint64_t num_nodes = 0;
+  uint64_t num_unknowns = 0;   ///< Moments or angles
+  uint64_t num_components = 0; ///< Groups
+  uint64_t num_values = 0;
+
+  uint64_t compression = 0;          ///< chi::CompressionType
+  double   compression_tolerance = 0.0;
+  uint64_t num_value_bytes = 0;      ///< Size of the stored values
+
+  /**Offset, in bytes, of the values array.*/
+  uint64_t ValuesOffset() const
+  {
+    return sizeof(BinaryDOFFileHeader) +
+           8 * (num_cells + num_cells + (num_cells + 1) + 3 * num_nodes);
+  }
+
+  /**Total file size in bytes implied by the counts.*/
+  uint64_t FileSize() const { return ValuesOffset() + num_value_bytes; }
+};
+
+/**Determines whether a file starts with the compact binary DOF file magic
+ * number. Files written in the older record-per-value format do not.*/
+inline bool IsBinaryDOFFile(const std::string& file_name)
+{
+  std::ifstream file(file_name, std::ifstream::binary | std::ifstream::in);
+  char magic[8] = {};
+  file.read(magic, sizeof(magic));
+
+  return file.good() and std::memcmp(magic,
+                                     BinaryDOFFileHeader::MAGIC,
+                                     sizeof(magic)) == 0;
+}
+
+}//namespace lbs
+
+#endif //CHITECH_LBS_BINARY_DOF_FILE_H
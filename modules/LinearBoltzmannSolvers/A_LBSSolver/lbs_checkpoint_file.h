@@ -0,0 +1,94 @@
+#ifndef CHITECH_LBS_CHECKPOINT_FILE_H
+#define CHITECH_LBS_CHECKPOINT_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lbs
+{
+
+//##################################################
+/**Header of the single-file restart (checkpoint) format. The file is
+ * written and read collectively with MPI-IO. All data are keyed by
+ * global cell-id and cell node, so that a checkpoint can be read on any
+ * number of locations and with any partitioning of the same mesh.
+ *
+ * The header is followed, in host byte order, by:
+ * - CheckpointItemRecord items[num_items]
+ * - uint64 cell_num_nodes[num_global_cells], in global-id order
+ * - the data of each nodal or cell item, at the record's data offset.
+ *   Nodal items store, for every cell in global-id order, the values of
+ *   each of its nodes. Cell items store the values of every cell in
+ *   global-id order.
+ *
+ * The data of a compressed item (see chi::CompressDoubles) is split into
+ * chunks, each holding the values of a contiguous range of global
+ * cell-ids. It consists of uint64 num_chunks, CheckpointChunkRecord
+ * chunks[num_chunks] and the compressed chunks, each padded to a multiple
+ * of 8 bytes.*/
+struct CheckpointFileHeader
+{
+  static constexpr char     MAGIC[8] = {'C','H','I','L','B','S','C','K'};
+  static constexpr uint64_t VERSION = 2;
+  /**Written as-is to detect files written with another byte order.*/
+  static constexpr uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+
+  char     magic[8] = {};
+  uint64_t version = 0;
+  uint64_t byte_order_mark = 0;
+  uint64_t num_global_cells = 0;
+  uint64_t num_global_nodes = 0;
+  uint64_t num_items = 0;
+};
+
+/**Describes one item stored in a checkpoint file.*/
+struct CheckpointItemRecord
+{
+  static constexpr int MAX_NAME_LENGTH = 48;
+
+  char     name[MAX_NAME_LENGTH] = {};
+  uint64_t layout = 0;           ///< CheckpointItem::Layout
+  uint64_t values_per_entry = 0; ///< Per node or per cell
+  uint64_t data_offset = 0;      ///< Bytes from the start of the file
+  double   scalar_value = 0.0;
+  uint64_t compression = 0;      ///< chi::CompressionType
+  double   compression_tolerance = 0.0;
+};
+
+/**Describes one compressed chunk of an item.*/
+struct CheckpointChunkRecord
+{
+  uint64_t global_id_begin = 0;
+  uint64_t global_id_end = 0;
+  uint64_t num_values = 0;
+  uint64_t num_bytes = 0;   ///< Compressed size, without padding
+  uint64_t data_offset = 0; ///< Bytes from the start of the item's data
+};
+
+/**The local data of a checkpoint file, staged in memory so that the file
+ * can be written after the solver state has moved on.*/
+struct CheckpointSnapshot
+{
+  /**Blocks of values at increasing displacements from a base offset.*/
+  struct Blocks
+  {
+    uint64_t base_offset = 0;             ///< Bytes from the start of the file
+    std::vector<int> lengths;             ///< Number of 8-byte values
+    std::vector<uint64_t> displacements;  ///< Bytes from the base offset
+  };
+
+  std::string file_name;
+  uint64_t file_size = 0;
+  std::vector<char> preamble; ///< Header and item records, location 0 only
+
+  Blocks cell_table_blocks;
+  std::vector<uint64_t> cell_num_nodes;
+
+  std::vector<Blocks> item_blocks;
+  std::vector<std::vector<double>> item_values;
+};
+
+}//namespace lbs
+
+#endif //CHITECH_LBS_CHECKPOINT_FILE_H
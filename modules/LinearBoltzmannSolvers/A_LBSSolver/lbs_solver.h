@@ -7,10 +7,12 @@
 #include "math/SpatialDiscretization/spatial_discretization.h"
 #include "math/LinearSolver/linear_solver.h"
 #include "lbs_structs.h"
+#include "lbs_binary_dof_file.h"
 #include "mesh/SweepUtilities/sweep_namespace.h"
 #include "mesh/SweepUtilities/SweepBoundary/sweep_boundaries.h"
 
 #include "A_LBSSolver/PointSource/lbs_point_source.h"
+#include "A_LBSSolver/Tools/lbs_async_checkpoint_writer.h"
 
 #include <petscksp.h>
 
@@ -57,6 +59,15 @@ protected:
 
   size_t source_event_tag_ = 0;
   double last_restart_write_ = 0.0;
+  std::vector<CheckpointItem> checkpoint_items_;
+  CheckpointSnapshot checkpoint_staging_;
+  AsyncCheckpointWriter checkpoint_writer_;
+
+  std::vector<Tally> tallies_;
+  /**Per local cell, the indices of the tallies containing the cell.*/
+  std::vector<std::vector<size_t>> cell_tally_ids_;
+  bool cell_tally_ids_valid_ = false;
+  size_t num_tally_evaluations_ = 0;
 
   lbs::Options options_;
   size_t num_moments_ = 0;
@@ -116,7 +127,7 @@ public:
   LBSSolver(const LBSSolver&) = delete;
   LBSSolver& operator=(const LBSSolver&) = delete;
 
-  virtual ~LBSSolver() = default;
+  virtual ~LBSSolver();
 
   size_t GetSourceEventTag() const;
 
@@ -128,8 +139,10 @@ public:
 
   static chi::InputParameters OptionsBlock();
   static chi::InputParameters BoundaryOptionsBlock();
+  static chi::InputParameters TallyOptionsBlock();
   void SetOptions(const chi::InputParameters& params);
   void SetBoundaryOptions(const chi::InputParameters& params);
+  void SetTallyOptions(const chi::InputParameters& params);
 
   size_t NumMoments() const;
   size_t NumGroups() const;
@@ -274,10 +287,15 @@ protected:
   // 04 File IO
 public:
   // 04a
+  virtual std::vector<CheckpointItem> MakeCheckpointItems();
+  void AddCheckpointItem(const CheckpointItem& item);
+  void FillCheckpointSnapshot(const std::string& file_name,
+                              CheckpointSnapshot& snapshot);
   void WriteRestartData(const std::string& folder_name,
                         const std::string& file_base);
-  void ReadRestartData(const std::string& folder_name,
+  bool ReadRestartData(const std::string& folder_name,
                        const std::string& file_base);
+  void WriteRestartDataIfDue(bool final_write);
   // 04b
   void WriteGroupsetAngularFluxes(const LBSGroupset& groupset,
                                   const std::string& file_base);
@@ -292,6 +310,18 @@ public:
                        std::vector<double>& flux_moments,
                        bool single_file = false);
 
+  // 04d
+protected:
+  void WriteBinaryDOFFile(const std::string& file_name,
+                          BinaryDOFFileHeader::Content content,
+                          const chi_math::UnknownManager& uk_man,
+                          const std::vector<double>& values) const;
+  bool ReadBinaryDOFFile(const std::string& file_name,
+                         BinaryDOFFileHeader::Content content,
+                         const chi_math::UnknownManager& uk_man,
+                         std::vector<double>& values) const;
+
+public:
   // 05a
   void UpdateFieldFunctions();
   void SetPhiFromFieldFunctions(PhiSTLOption which_phi,
@@ -307,6 +337,17 @@ public:
 public:
   void ComputePrecursors();
 
+  // 06d
+public:
+  void AddTally(Tally tally);
+  const std::vector<Tally>& Tallies() const;
+  const Tally& GetTally(const std::string& name) const;
+  void ComputeTallies();
+
+protected:
+  void MapTallyCells();
+  void WriteTallyValues() const;
+
   // 07 Vector assembly
 public:
   virtual void SetPhiVectorScalarValues(std::vector<double>& phi_vector,
@@ -339,6 +380,13 @@ public:
 
   virtual void SetPrimarySTLvectorFromMultiGSPETScVecFrom(
     const std::vector<int>& gs_ids, Vec x_src, PhiSTLOption which_phi);
+
+  // 08 Repartitioning
+public:
+  uint64_t Repartition();
+
+protected:
+  virtual void InitializeAfterRepartition();
 };
 
 } // namespace lbs
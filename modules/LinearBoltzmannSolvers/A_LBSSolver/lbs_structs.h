@@ -4,10 +4,16 @@
 #include "math/chi_math.h"
 #include "physics/PhysicsMaterial/MultiGroupXS/multigroup_xs.h"
 #include "physics/PhysicsMaterial/material_property_isotropic_mg_src.h"
+#include "utils/chi_compression.h"
 
 #include <functional>
 #include <map>
 
+namespace chi_mesh
+{
+class LogicalVolume;
+}
+
 namespace lbs
 {
 
@@ -93,7 +99,9 @@ enum SourceFlags : int
   APPLY_AGS_SCATTER_SOURCES = (1 << 2),
   APPLY_WGS_FISSION_SOURCES = (1 << 3),
   APPLY_AGS_FISSION_SOURCES = (1 << 4),
-  SUPPRESS_WG_SCATTER       = (1 << 5)
+  SUPPRESS_WG_SCATTER       = (1 << 5),
+  KEEP_INCOMING_DELAYED_PSI = (1 << 6)  ///< Fixed sources without resetting
+                                        ///< lagged angular fluxes
 };
 
 inline SourceFlags operator|(const SourceFlags f1,
@@ -118,6 +126,18 @@ typedef std::function<void(LBSGroupset&               groupset,
 
 class AGSSchemeEntry;
 
+/**Ordering of the groupset solves within an across-groupset iteration.
+ * With GAUSS_SEIDEL each groupset immediately sees the updated fluxes of
+ * the groupsets solved before it. With BLOCK_JACOBI every groupset is
+ * solved against the fluxes of the previous across-groupset iteration,
+ * which makes the groupset solves within an iteration independent of
+ * each other.*/
+enum class AGSIterationType
+{
+  GAUSS_SEIDEL = 0,
+  BLOCK_JACOBI = 1
+};
+
 /**Struct for storing LBS options.*/
 struct Options
 {
@@ -136,6 +156,11 @@ struct Options
   std::string write_restart_folder_name = std::string("YRestart");
   std::string write_restart_file_base   = std::string("restart");
   double write_restart_interval = 30.0;
+  bool write_restart_async = false;
+
+  /**Compression of angular flux, flux moment and restart files.*/
+  chi::CompressionType output_compression = chi::CompressionType::NONE;
+  double output_compression_tolerance = 1.0e-8; ///< For lossy compression
 
   bool use_precursors = false;
   bool use_src_moments = false;
@@ -146,6 +171,10 @@ struct Options
   bool verbose_ags_iterations = false;
   bool verbose_outer_iterations = true;
 
+  AGSIterationType ags_iteration_type = AGSIterationType::GAUSS_SEIDEL;
+  int max_ags_iterations = 0; ///< 0 means the default of the iteration type
+  double ags_tolerance = 1.0e-6;
+
   bool power_field_function_on = false;
   double power_default_kappa = 3.20435e-11; //200MeV to Joule
   double power_normalization = -1.0;
@@ -153,6 +182,12 @@ struct Options
   std::string field_function_prefix_option = "prefix";
   std::string field_function_prefix; //Default is empty
 
+  bool measure_cell_costs = false;
+
+  /**File to which tally values are appended after every evaluation. Empty
+   * means the values are only kept in memory.*/
+  std::string tally_output_file;
+
   Options() = default;
 
   std::vector<AGSSchemeEntry> ags_scheme;
@@ -171,6 +206,10 @@ private:
   double volume_;
   std::vector<bool> face_local_flags_ = {};
   std::vector<double> outflow_;
+  /**Measured compute time spent on this cell (sweeps and sources), see
+   * Options::measure_cell_costs. Mutable since it is accumulated by
+   * routines that otherwise only read the view.*/
+  mutable double measured_cost_ = 0.0;
 
 public:
   CellLBSView(size_t phi_address,
@@ -221,6 +260,10 @@ public:
 
   void ReassingXS(const chi_physics::MultiGroupXS& xs_mapped)
   { xs_ = &xs_mapped; }
+
+  void AddMeasuredCost(double seconds) const {measured_cost_ += seconds;}
+  double MeasuredCost() const {return measured_cost_;}
+  void ResetMeasuredCost() {measured_cost_ = 0.0;}
 };
 
 
@@ -236,6 +279,55 @@ struct UnitCellMatrices
   std::vector<VecDbl>  face_Si_vectors;
 };
 
+/**A solver quantity stored in restart (checkpoint) files. Nodal items
+ * hold the unknowns of the given unknown manager for every node of the
+ * local cells. Cell items hold `values_per_cell` values per local cell,
+ * stored at `local_id * values_per_cell`. Scalar items are a single
+ * value common to all locations.*/
+struct CheckpointItem
+{
+  enum class Layout : uint64_t
+  {
+    NODAL  = 1,
+    CELL   = 2,
+    SCALAR = 3
+  };
+
+  std::string name;
+  Layout layout = Layout::SCALAR;
+  std::vector<double>* vector = nullptr;
+  const chi_math::UnknownManager* uk_man = nullptr; ///< Nodal items
+  size_t values_per_cell = 0;                       ///< Cell items
+  double* scalar = nullptr;                         ///< Scalar items
+};
+
+/**Reaction rate accumulated by a tally. FLUX tallies the group flux
+ * itself.*/
+enum class TallyReaction
+{
+  FLUX       = 0,
+  TOTAL      = 1,
+  ABSORPTION = 2,
+  FISSION    = 3,
+  NU_FISSION = 4,
+  POWER      = 5  ///< Uses the default kappa, as the power field function
+};
+
+/**An in-situ tally: the volume integral of a reaction rate over the local
+ * cells whose centroids are inside a logical volume, binned over a coarse
+ * group structure. Bin b spans the groups from `bin_first_groups[b]` up to
+ * the first group of the next bin. Without a logical volume the entire
+ * domain is tallied.*/
+struct Tally
+{
+  std::string name;
+  std::shared_ptr<const chi_mesh::LogicalVolume> logical_volume = nullptr;
+  TallyReaction reaction = TallyReaction::FLUX;
+  std::vector<size_t> bin_first_groups = {0};
+
+  std::vector<double> values; ///< Global values per bin of the last evaluation
+};
+
 enum class AGSSchemeEntryType
 {
   GROUPSET_ID = 1,
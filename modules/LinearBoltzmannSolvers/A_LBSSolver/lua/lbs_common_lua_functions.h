@@ -34,11 +34,15 @@ namespace lbs::common_lua_utils
   int chiLBSReadFluxMoments(lua_State *L);
 
   int chiLBSComputeFissionRate(lua_State *L);
+  int chiLBSGetTallyValues(lua_State *L);
+  int chiLBSGetSweepCount(lua_State *L);
   int chiLBSInitializeMaterials(lua_State* L);
 
   int chiLBSAddPointSource(lua_State *L);
   int chiLBSClearPointSources(lua_State *L);
   int chiLBSInitializePointSources(lua_State *L);
+
+  int chiLBSRepartition(lua_State *L);
 }
 
 #endif //CHITECH_LBS_COMMON_LUA_FUNCTIONS_H
@@ -0,0 +1,52 @@
+#include "A_LBSSolver/lbs_solver.h"
+#include "A_LBSSolver/IterativeMethods/wgs_context.h"
+
+#include "chi_runtime.h"
+
+namespace lbs::common_lua_utils
+{
+
+//###################################################################
+/**Returns the number of sweeps (applications of the inverse transport
+ * operator) performed by all the groupsets of a solver since it was
+ * initialized.
+ *
+\param SolverIndex int Handle to the solver maintaining the information.
+
+\return int The number of sweeps.
+
+\ingroup LBSLuaFunctions
+\author Jan*/
+int chiLBSGetSweepCount(lua_State *L)
+{
+  const std::string fname = "chiLBSGetSweepCount";
+  const int num_args = lua_gettop(L);
+
+  if (num_args != 1)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckNilValue(fname, L, 1);
+
+  //============================================= Get pointer to solver
+  const int solver_handle = lua_tonumber(L, 1);
+
+  auto& lbs_solver =
+    Chi::GetStackItem<lbs::LBSSolver>(Chi::object_stack,
+                                      solver_handle,
+                                      fname);
+
+  size_t count = 0;
+  for (auto& wgs_solver : lbs_solver.GetWGSSolvers())
+  {
+    auto wgs_context =
+      std::dynamic_pointer_cast<lbs::WGSContext<Mat, Vec, KSP>>(
+        wgs_solver->GetContext());
+    if (wgs_context) count += wgs_context->counter_applications_of_inv_op_;
+  }
+
+  lua_pushinteger(L, static_cast<lua_Integer>(count));
+
+  return 1;
+}
+
+}//namespace lbs::common_lua_utils
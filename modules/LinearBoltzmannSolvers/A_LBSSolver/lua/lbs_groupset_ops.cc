@@ -573,6 +573,19 @@ Biconjugate Gradient Stabilized method.\n\n
 KRYLOV_BICGSTAB_CYCLES\n
 Biconjugate Gradient Stabilized method with cyclic dependency convergence.\n\n
 
+KRYLOV_LGMRES\n
+Augmented GMRES that retains error approximations across restarts.\n\n
+
+KRYLOV_LGMRES_CYCLES\n
+Augmented GMRES with cyclic dependency convergence.\n\n
+
+KRYLOV_DGMRES\n
+Deflated GMRES. The deflation space is retained between successive solves
+of the same groupset, e.g., across power iteration outers.\n\n
+
+KRYLOV_DGMRES_CYCLES\n
+Deflated GMRES with cyclic dependency convergence.\n\n
+
 
 ##_
 
@@ -705,6 +718,24 @@ int chiLBSGroupsetSetIterativeMethod(lua_State *L)
       groupset->allow_cycles_ = true;
       groupset->iterative_method_ = IterativeMethod::KRYLOV_BICGSTAB;
     }
+    else if (iter_method == sc_int(IterativeMethod::KRYLOV_LGMRES))
+    {
+      groupset->iterative_method_ = IterativeMethod::KRYLOV_LGMRES;
+    }
+    else if (iter_method == sc_int(IterativeMethod::KRYLOV_LGMRES_CYCLES))
+    {
+      groupset->allow_cycles_ = true;
+      groupset->iterative_method_ = IterativeMethod::KRYLOV_LGMRES;
+    }
+    else if (iter_method == sc_int(IterativeMethod::KRYLOV_DGMRES))
+    {
+      groupset->iterative_method_ = IterativeMethod::KRYLOV_DGMRES;
+    }
+    else if (iter_method == sc_int(IterativeMethod::KRYLOV_DGMRES_CYCLES))
+    {
+      groupset->allow_cycles_ = true;
+      groupset->iterative_method_ = IterativeMethod::KRYLOV_DGMRES;
+    }
     else
     {
       Chi::log.LogAllError()
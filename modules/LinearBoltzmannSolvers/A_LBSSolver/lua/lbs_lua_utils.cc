@@ -72,6 +72,10 @@ namespace lbs::common_lua_utils
       RegisterNumber(KRYLOV_GMRES_CYCLES         , 8);
       RegisterNumber(KRYLOV_BICGSTAB             , 9);
       RegisterNumber(KRYLOV_BICGSTAB_CYCLES      , 10);
+      RegisterNumber(KRYLOV_LGMRES               , 11);
+      RegisterNumber(KRYLOV_LGMRES_CYCLES        , 12);
+      RegisterNumber(KRYLOV_DGMRES               , 13);
+      RegisterNumber(KRYLOV_DGMRES_CYCLES        , 14);
     RegisterFunction(chiLBSGroupsetSetResidualTolerance);
     RegisterFunction(chiLBSGroupsetSetMaxIterations);
     RegisterFunction(chiLBSGroupsetSetGMRESRestartIntvl);
@@ -91,10 +95,14 @@ namespace lbs::common_lua_utils
     RegisterFunction(chiLBSReadFluxMoments);
 
     RegisterFunction(chiLBSComputeFissionRate);
+    RegisterFunction(chiLBSGetTallyValues);
+    RegisterFunction(chiLBSGetSweepCount);
     RegisterFunction(chiLBSInitializeMaterials);
 
     RegisterFunction(chiLBSAddPointSource);
     RegisterFunction(chiLBSClearPointSources);
     RegisterFunction(chiLBSInitializePointSources);
+
+    RegisterFunction(chiLBSRepartition);
   }
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "A_LBSSolver/lbs_solver.h"
+
+#include "chi_runtime.h"
+
+namespace lbs::common_lua_utils
+{
+
+//###################################################################
+/**Repartitions the solver's grid such that the locations carry roughly
+ * equal transport cost, and migrates the flux moments, angular fluxes and
+ * precursors to the new partitions. The cost of each cell is the sweep
+ * and source time measured when the option `measure_cell_costs` is
+ * enabled, otherwise an estimate based on the number of cell nodes.
+ * Must be called between solves. In parallel, all groupsets must allow
+ * cycles.
+ *
+\param SolverIndex int Handle to the solver maintaining the information.
+
+\return int The number of cells that moved to another location.
+
+\ingroup LBSLuaFunctions
+\author Jan*/
+int chiLBSRepartition(lua_State *L)
+{
+  const std::string fname = "chiLBSRepartition";
+  const int num_args = lua_gettop(L);
+
+  if (num_args != 1)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  LuaCheckNilValue(fname, L, 1);
+
+  //============================================= Get pointer to solver
+  const int solver_handle = lua_tonumber(L, 1);
+
+  auto& lbs_solver =
+    Chi::GetStackItem<lbs::LBSSolver>(Chi::object_stack,
+                                      solver_handle,
+                                      fname);
+
+  const uint64_t num_migrated = lbs_solver.Repartition();
+
+  lua_pushinteger(L, static_cast<lua_Integer>(num_migrated));
+  return 1;
+}
+
+}//namespace lbs::common_lua_utils
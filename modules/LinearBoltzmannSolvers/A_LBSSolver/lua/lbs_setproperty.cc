@@ -60,7 +60,8 @@ READ_RESTART_DATA\n
  The value can be followed by two
  optional strings. The first is the folder name which can be relative or
  absolute, and the second is the file base name. These are defaulted to
- "YRestart" and "restart" respectively.\n\n
+ "YRestart" and "restart" respectively. The restart file may have been
+ written with a different number of processes.\n\n
 
 SAVE_ANGULAR_FLUX\n
 Sets the flag for saving the angular flux. Expects to be followed by true/false.
@@ -90,12 +91,13 @@ chiLBSSetProperty(phys1,READ_RESTART_DATA,"YRestart1")
 \endcode
 
 WRITE_RESTART_DATA\n
- Indicates the writing of restart data to restart files.
+ Indicates the writing of restart data to a single restart file,
+ `<folder>/<filebase>.r`, at the end of an execution.
  The value can be followed by two optional strings and a number
  optional strings. The first string is the folder name which can be relative or
  absolute, and the second string is the file base name. The number is the time
- interval (in minutes) for a restart write to be triggered (apart from GMRES
- restarts and the conclusion of groupset completions) .These are defaulted to
+ interval (in minutes) for a restart write to be triggered between outer
+ (power) iterations. These are defaulted to
  "YRestart", "restart" and 30 minutes respectively.\n\n
 
 \code
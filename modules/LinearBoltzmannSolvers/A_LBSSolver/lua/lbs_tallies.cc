@@ -0,0 +1,52 @@
+#include "A_LBSSolver/lbs_solver.h"
+
+#include "chi_runtime.h"
+
+namespace lbs::common_lua_utils
+{
+
+//###################################################################
+/**Returns the values of a tally from its last evaluation. Tallies are
+ * specified with the solver option `tallies` and are evaluated after every
+ * solve.
+ *
+\param SolverIndex int Handle to the solver maintaining the information.
+\param TallyName string Name of the tally.
+
+\return table The value of each group bin (indexed from 1).
+
+\ingroup LBSLuaFunctions
+\author Jan*/
+int chiLBSGetTallyValues(lua_State *L)
+{
+  const std::string fname = "chiLBSGetTallyValues";
+  const int num_args = lua_gettop(L);
+
+  if (num_args != 2)
+    LuaPostArgAmountError(fname, 2, num_args);
+
+  LuaCheckNilValue(fname, L, 1);
+  LuaCheckStringValue(fname, L, 2);
+
+  //============================================= Get pointer to solver
+  const int solver_handle = lua_tonumber(L, 1);
+
+  const auto& lbs_solver =
+    Chi::GetStackItem<lbs::LBSSolver>(Chi::object_stack,
+                                      solver_handle,
+                                      fname);
+
+  const auto& tally = lbs_solver.GetTally(lua_tostring(L, 2));
+
+  lua_newtable(L);
+  for (size_t b = 0; b < tally.values.size(); ++b)
+  {
+    lua_pushinteger(L, static_cast<lua_Integer>(b + 1));
+    lua_pushnumber(L, tally.values[b]);
+    lua_settable(L, -3);
+  }
+
+  return 1;
+}
+
+}//namespace lbs::common_lua_utils
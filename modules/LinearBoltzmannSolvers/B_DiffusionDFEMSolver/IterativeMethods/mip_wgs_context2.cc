@@ -26,12 +26,18 @@ void MIPWGSContext2<Mat, Vec, KSP>::PreSetupCallback()
     std::string method_name;
     switch (groupset_.iterative_method_)
     {
+      case IterativeMethod::CLASSICRICHARDSON:
+        method_name = "CLASSICRICHARDSON"; break;
       case IterativeMethod::KRYLOV_RICHARDSON:
         method_name = "KRYLOV_RICHARDSON"; break;
       case IterativeMethod::KRYLOV_GMRES:
         method_name = "KRYLOV_GMRES"; break;
       case IterativeMethod::KRYLOV_BICGSTAB:
         method_name = "KRYLOV_BICGSTAB"; break;
+      case IterativeMethod::KRYLOV_LGMRES:
+        method_name = "KRYLOV_LGMRES"; break;
+      case IterativeMethod::KRYLOV_DGMRES:
+        method_name = "KRYLOV_DGMRES"; break;
       default: method_name = "KRYLOV_GMRES";
     }
     Chi::log.Log()
@@ -24,12 +24,18 @@ void SweepWGSContext<Mat, Vec, KSP>::PreSetupCallback()
     std::string method_name;
     switch (groupset_.iterative_method_)
     {
+      case IterativeMethod::CLASSICRICHARDSON:
+        method_name = "CLASSICRICHARDSON"; break;
       case IterativeMethod::KRYLOV_RICHARDSON:
         method_name = "KRYLOV_RICHARDSON"; break;
       case IterativeMethod::KRYLOV_GMRES:
         method_name = "KRYLOV_GMRES"; break;
       case IterativeMethod::KRYLOV_BICGSTAB:
         method_name = "KRYLOV_BICGSTAB"; break;
+      case IterativeMethod::KRYLOV_LGMRES:
+        method_name = "KRYLOV_LGMRES"; break;
+      case IterativeMethod::KRYLOV_DGMRES:
+        method_name = "KRYLOV_DGMRES"; break;
       default: method_name = "KRYLOV_GMRES";
     }
     Chi::log.Log()
@@ -112,7 +118,8 @@ void SweepWGSContext<Mat, Vec, KSP>::ApplyInverseTransportOperator(int scope)
 
   sweep_scheduler_.SetBoundarySourceActiveFlag(use_bndry_source_flag);
 
-  if (scope & APPLY_FIXED_SOURCES)
+  if ((scope & APPLY_FIXED_SOURCES) and
+      not (scope & KEEP_INCOMING_DELAYED_PSI))
     sweep_scheduler_.ZeroIncomingDelayedPsi();
 
   //Sweep
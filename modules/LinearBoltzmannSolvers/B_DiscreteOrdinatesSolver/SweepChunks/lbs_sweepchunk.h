@@ -65,6 +65,12 @@ protected:
   size_t gs_ss_size_ = 0;
   size_t gs_ss_begin_ = 0;
   int gs_gi_ = 0;
+  /**Per group-subset group flags, false if the group is masked out
+   * of the sweep (see LBSGroupset::group_active_flags_).*/
+  std::vector<bool> gs_ss_group_active_;
+  /**If set, the time spent on each cell is added to its transport view
+   * (see Options::measure_cell_costs).*/
+  bool measure_cell_costs_ = false;
 
   // Runtime params
   std::vector<std::vector<double>> Amat_;
@@ -128,6 +134,8 @@ public:
                 int num_moments,
                 int max_num_cell_dofs);
 
+  void SetMeasureCellCosts(bool flag) {measure_cell_costs_ = flag;}
+
   // 01
   void Sweep(chi_mesh::sweep_management::AngleSet* angle_set) override;
 
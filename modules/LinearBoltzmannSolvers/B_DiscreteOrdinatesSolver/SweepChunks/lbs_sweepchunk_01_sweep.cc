@@ -2,6 +2,8 @@
 
 #include "math/SpatialDiscretization/spatial_discretization.h"
 
+#include <chrono>
+
 #define scint static_cast<int>
 
 namespace lbs
@@ -16,6 +18,20 @@ void LBSSweepChunk::Sweep(chi_mesh::sweep_management::AngleSet* angle_set)
   gs_ss_begin_ = grp_ss_info.ss_begin;
   gs_gi_ = groupset_.groups_[gs_ss_begin_].id_;
 
+  // ====================================================== Group masking
+  gs_ss_group_active_.assign(gs_ss_size_, true);
+  if (not groupset_.group_active_flags_.empty())
+  {
+    bool any_active = false;
+    for (size_t gsg = 0; gsg < gs_ss_size_; ++gsg)
+    {
+      gs_ss_group_active_[gsg] =
+        groupset_.group_active_flags_[gs_ss_begin_ + gsg];
+      any_active = any_active or gs_ss_group_active_[gsg];
+    }
+    if (not any_active) return;
+  }
+
   int deploc_face_counter = -1;
   int preloc_face_counter = -1;
 
@@ -31,8 +47,12 @@ void LBSSweepChunk::Sweep(chi_mesh::sweep_management::AngleSet* angle_set)
   const auto& spds = angle_set->GetSPDS();
   const auto& spls = spds.spls.item_id;
   const size_t num_spls = spls.size();
+  typedef std::chrono::steady_clock Clock;
   for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
   {
+    const auto cell_start_time =
+      measure_cell_costs_ ? Clock::now() : Clock::time_point();
+
     cell_local_id_ = spls[spls_index];
     cell_ = &grid_.local_cells[cell_local_id_];
     cell_mapping_ = &grid_fe_view_.GetCellMapping(*cell_);
@@ -127,6 +147,7 @@ void LBSSweepChunk::Sweep(chi_mesh::sweep_management::AngleSet* angle_set)
       //                                          Assembling mass terms
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
       {
+        if (not gs_ss_group_active_[gsg]) continue;
         g_ = gs_gi_ + gsg;
         gsg_ = gsg;
         sigma_tg_ = sigma_t[g_];
@@ -174,6 +195,10 @@ void LBSSweepChunk::Sweep(chi_mesh::sweep_management::AngleSet* angle_set)
 
       ExecuteKernels(post_cell_dir_sweep_callbacks_);
     } // for n
+
+    if (measure_cell_costs_)
+      cell_transport_view_->AddMeasuredCost(
+        std::chrono::duration<double>(Clock::now() - cell_start_time).count());
   }   // for cell
 }
 
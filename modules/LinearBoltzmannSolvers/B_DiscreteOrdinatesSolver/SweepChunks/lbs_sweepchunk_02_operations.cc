@@ -59,11 +59,13 @@ void LBSSweepChunk::OutgoingSurfaceOperations()
 
     if (not sss_info.on_boundary or sss_info.is_reflecting_bndry_)
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        psi[gsg] = b_[gsg][i];
+        if (gs_ss_group_active_[gsg])
+          psi[gsg] = b_[gsg][i];
     if (sss_info.on_boundary and not sss_info.is_reflecting_bndry_)
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        cell_transport_view_->AddOutflow(gs_gi_ + gsg,
-                                         wt * mu * b_[gsg][i] * IntF_shapeI[i]);
+        if (gs_ss_group_active_[gsg])
+          cell_transport_view_->AddOutflow(
+            gs_gi_ + gsg, wt * mu * b_[gsg][i] * IntF_shapeI[i]);
   } // for fi
 }
 
@@ -91,7 +91,8 @@ void LBSSweepChunk::KernelPhiUpdate()
     {
       const size_t ir = cell_transport_view_->MapDOF(i, m, gs_gi_);
       for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-        output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
+        if (gs_ss_group_active_[gsg])
+          output_phi[ir + gsg] += wn_d2m * b_[gsg][i];
     }
   }
 }
@@ -111,7 +112,8 @@ void LBSSweepChunk::KernelPsiUpdate()
     cint64_t imap = grid_fe_view_.MapDOFLocal(
       *cell_, i, groupset_.psi_uk_man_, direction_num_, gs_ss_begin_);
     for (int gsg = 0; gsg < gs_ss_size_; ++gsg)
-      output_psi[imap + gsg] = b_[gsg][i];
+      if (gs_ss_group_active_[gsg])
+        output_psi[imap + gsg] = b_[gsg][i];
   } // for i
 }
 
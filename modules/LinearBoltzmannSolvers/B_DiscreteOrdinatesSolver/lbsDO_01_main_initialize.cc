@@ -6,6 +6,7 @@
 
 #include "chi_runtime.h"
 #include "chi_log.h"
+#include "utils/chi_perf_region.h"
 
 typedef chi_mesh::sweep_management::SweepChunk SweepChunk;
 
@@ -24,11 +25,15 @@ void lbs::DiscreteOrdinatesSolver::Initialize()
 
   //================================================== Initialize groupsets for
   //                                                   sweeping
-  InitializeSweepDataStructures();
+  {
+    chi::PerfRegion perf_region("LBS::InitializeSweepDataStructures");
+    InitializeSweepDataStructures();
+  }
   for (auto& groupset : groupsets_)
   {
     InitFluxDataStructures(groupset);
 
+    chi::PerfRegion perf_region("DSA::Initialize");
     InitWGDSA(groupset);
     InitTGDSA(groupset);
   }
@@ -0,0 +1,21 @@
+#include "lbs_discrete_ordinates_solver.h"
+
+//###################################################################
+/**Rebuilds the sweep orderings, the flux data structures and the
+ * acceleration solvers on the repartitioned grid.*/
+void lbs::DiscreteOrdinatesSolver::InitializeAfterRepartition()
+{
+  InitializeSweepDataStructures();
+  for (auto& groupset : groupsets_)
+  {
+    CleanUpWGDSA(groupset);
+    CleanUpTGDSA(groupset);
+
+    InitFluxDataStructures(groupset);
+
+    InitWGDSA(groupset);
+    InitTGDSA(groupset);
+  }
+
+  InitializeSolverSchemes();
+}
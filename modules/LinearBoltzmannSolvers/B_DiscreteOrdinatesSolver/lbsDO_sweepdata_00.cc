@@ -8,14 +8,21 @@
 #include "utils/chi_timer.h"
 
 #define ParallelParmetisNeedsCycles \
-"When using PARMETIS type partitioning then groupset iterative method" \
-" must be NPT_CLASSICRICHARDSON_CYCLES or NPT_GMRES_CYCLES"
+"When using PARMETIS, SFC_HILBERT or SFC_MORTON type partitioning then" \
+" groupset iterative method must be NPT_CLASSICRICHARDSON_CYCLES or" \
+" NPT_GMRES_CYCLES"
 
 #define IsParallel Chi::mpi.process_count>1
 
 #define IsPartitionTypeParmetis \
 mesher.options.partition_type == chi_mesh::VolumeMesher::PartitionType::PARMETIS
 
+#define IsPartitionTypeSFC \
+(mesher.options.partition_type == \
+   chi_mesh::VolumeMesher::PartitionType::SFC_HILBERT or \
+ mesher.options.partition_type == \
+   chi_mesh::VolumeMesher::PartitionType::SFC_MORTON)
+
 namespace lbs
 {
 /**This routine initializes basic sweep datastructures that are agnostic of
@@ -44,7 +51,8 @@ void DiscreteOrdinatesSolver::InitializeSweepDataStructures()
     for (const auto& groupset : groupsets_)
     {
       bool no_cycles_parmetis_partitioning =
-        (IsPartitionTypeParmetis and (not groupset.allow_cycles_));
+        ((IsPartitionTypeParmetis or IsPartitionTypeSFC) and
+         (not groupset.allow_cycles_));
 
       bool is_1D_geometry = options_.geometry_type == GeometryType::ONED_SLAB;
 
@@ -38,5 +38,7 @@ std::shared_ptr<SweepChunk> lbs::DiscreteOrdinatesSolver::
     num_moments_,
     max_cell_dof_count_);
 
+  sweep_chunk->SetMeasureCellCosts(options_.measure_cell_costs);
+
   return sweep_chunk;
 }
\ No newline at end of file
@@ -60,6 +60,9 @@ protected:
   void ResetSweepOrderings(LBSGroupset& groupset);
   virtual std::shared_ptr<SweepChunk> SetSweepChunk(LBSGroupset& groupset);
 
+  // Repartitioning
+  void InitializeAfterRepartition() override;
+
   // Vector assembly
 public:
   void ScalePhiVector(PhiSTLOption which_phi, double value) override;
@@ -45,5 +45,6 @@ void lbs::DiscreteOrdinatesAdjointSolver::Execute()
   }//for cell
 
   UpdateFieldFunctions();
+  ComputeTallies();
 
 }
\ No newline at end of file
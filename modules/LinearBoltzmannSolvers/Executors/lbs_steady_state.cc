@@ -51,6 +51,9 @@ void SteadyStateSolver::Execute()
     lbs_solver_.ComputePrecursors();
 
   lbs_solver_.UpdateFieldFunctions();
+  lbs_solver_.ComputeTallies();
+
+  lbs_solver_.WriteRestartDataIfDue(/*final_write=*/true);
 }
 
 } // namespace lbs
\ No newline at end of file
@@ -93,6 +93,7 @@ void XXNonLinearKEigen::Execute()
   }
 
   lbs_solver_.UpdateFieldFunctions();
+  lbs_solver_.ComputeTallies();
 
   Chi::log.Log()
     << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
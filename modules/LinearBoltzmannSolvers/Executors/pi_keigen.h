@@ -15,6 +15,11 @@ protected:
   double k_tolerance_;
   bool reinit_phi_1_;
 
+  const bool adaptive_inner_tol_;
+  const double inner_tol_max_;
+  const double inner_tol_gamma_;
+  const double inner_tol_alpha_;
+
   VecDbl& q_moments_local_;
   VecDbl& phi_old_local_;
   VecDbl& phi_new_local_;
@@ -26,6 +31,16 @@ protected:
   std::shared_ptr<lbs::WGSContext<Mat, Vec, KSP>> front_wgs_context_;
 
   double k_eff_ = 1.0;
+  /**True when the flux moments and k_eff were read from restart data, in
+   * which case the power iterations continue from them.*/
+  bool restarted_ = false;
+
+  /**State of the adaptive inner tolerance schedule. The floors are the
+   * user specified groupset tolerances.*/
+  std::vector<double> inner_tol_floors_;
+  double inner_eta_prev_ = 0.0;
+  double outer_residual_prev_ = 0.0;
+  VecDbl q_fission_prev_;
 
 public:
   static chi::InputParameters GetInputParameters();
@@ -39,6 +54,10 @@ protected:
   void SetLBSFissionSource(const VecDbl& input, bool additive);
   void SetLBSScatterSource(const VecDbl& input, bool additive,
                            bool suppress_wg_scat = false);
+
+  double ComputeFissionSourceResidual();
+  bool UpdateInnerTolerances(double outer_residual);
+  size_t TotalSweepCount() const;
 };
 
 }
@@ -36,6 +36,37 @@ chi::InputParameters XXPowerIterationKEigen::GetInputParameters()
   params.AddOptionalParameter(
     "reinit_phi_1", true, "If true, reinitializes scalar phi fluxes to 1");
 
+  params.AddOptionalParameter(
+    "adaptive_inner_tol",
+    false,
+    "If true, the within-groupset tolerances are adapted every outer "
+    "iteration with an Eisenstat-Walker type schedule. Early outers use loose "
+    "inner tolerances, which are tightened as the fission source residual "
+    "and the k-eigenvalue change decrease. The groupset tolerances act as "
+    "the lower limit and convergence is only declared on an outer with "
+    "inner tolerances at this limit.");
+  params.AddOptionalParameter(
+    "inner_tol_max",
+    1.0e-2,
+    "Upper limit of the adaptive inner tolerance, also used for the first "
+    "outer iteration.");
+  params.AddOptionalParameter(
+    "inner_tol_gamma",
+    0.9,
+    "Eisenstat-Walker gamma factor for the adaptive inner tolerance.");
+  params.AddOptionalParameter(
+    "inner_tol_alpha",
+    2.0,
+    "Eisenstat-Walker alpha exponent for the adaptive inner tolerance.");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange(
+    "inner_tol_max", AllowableRangeLowHighLimit::New(1.0e-18, 1.0));
+  params.ConstrainParameterRange(
+    "inner_tol_gamma", AllowableRangeLowHighLimit::New(1.0e-6, 1.0));
+  params.ConstrainParameterRange(
+    "inner_tol_alpha", AllowableRangeLowHighLimit::New(1.0, 2.0));
+
   return params;
 }
 
@@ -47,6 +78,10 @@ XXPowerIterationKEigen::XXPowerIterationKEigen(
     max_iters_(params.GetParamValue<size_t>("max_iters")),
     k_tolerance_(params.GetParamValue<double>("k_tol")),
     reinit_phi_1_(params.GetParamValue<bool>("reinit_phi_1")),
+    adaptive_inner_tol_(params.GetParamValue<bool>("adaptive_inner_tol")),
+    inner_tol_max_(params.GetParamValue<double>("inner_tol_max")),
+    inner_tol_gamma_(params.GetParamValue<double>("inner_tol_gamma")),
+    inner_tol_alpha_(params.GetParamValue<double>("inner_tol_alpha")),
 
     q_moments_local_(lbs_solver_.QMomentsLocal()),
     phi_old_local_(lbs_solver_.PhiOldLocal()),
@@ -54,6 +89,9 @@ XXPowerIterationKEigen::XXPowerIterationKEigen(
     groupsets_(lbs_solver_.Groupsets()),
     front_gs_(groupsets_.front())
 {
+  lbs_solver_.AddCheckpointItem(
+    {"k_eff", CheckpointItem::Layout::SCALAR,
+     nullptr, nullptr, 0, &k_eff_});
 }
 
 } // namespace lbs
\ No newline at end of file
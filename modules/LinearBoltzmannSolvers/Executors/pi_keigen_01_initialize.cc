@@ -40,7 +40,19 @@ void XXPowerIterationKEigen::Initialize()
 
   ChiLogicalErrorIf(not front_wgs_context_, ": Casting failure");
 
-  if (reinit_phi_1_) lbs_solver_.SetPhiVectorScalarValues(phi_old_local_, 1.0);
+  inner_tol_floors_.clear();
+  for (auto& wgs_solver : lbs_solver_.GetWGSSolvers())
+    inner_tol_floors_.push_back(wgs_solver->ToleranceOptions().residual_absolute);
+  inner_eta_prev_ = 0.0;
+  outer_residual_prev_ = 0.0;
+  q_fission_prev_.clear();
+
+  //A failed restart read leaves the fluxes zero
+  restarted_ = lbs_solver_.Options().read_restart_data and
+               lbs_solver_.ComputeFissionProduction(phi_old_local_) > 0.0;
+
+  if (reinit_phi_1_ and not restarted_)
+    lbs_solver_.SetPhiVectorScalarValues(phi_old_local_, 1.0);
 }
 
 } // namespace lbs
\ No newline at end of file
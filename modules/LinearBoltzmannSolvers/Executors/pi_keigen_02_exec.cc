@@ -18,8 +18,12 @@ void XXPowerIterationKEigen::Execute()
   using namespace chi_math;
 
   double F_prev = 1.0;
-  k_eff_ = 1.0;
-  double k_eff_prev = 1.0;
+  if (restarted_)
+    F_prev = lbs_solver_.ComputeFissionProduction(phi_old_local_);
+  else
+    k_eff_ = 1.0;
+  restarted_ = false;
+  double k_eff_prev = k_eff_;
   double k_eff_change = 1.0;
 
   //================================================== Start power iterations
@@ -31,6 +35,12 @@ void XXPowerIterationKEigen::Execute()
     SetLBSFissionSource(phi_old_local_, /*additive=*/false);
     Scale(q_moments_local_, 1.0 / k_eff_);
 
+    //================================= Adapt the inner tolerances
+    bool inners_converged = true;
+    if (adaptive_inner_tol_)
+      inners_converged = UpdateInnerTolerances(
+        std::max(ComputeFissionSourceResidual(), k_eff_change));
+
     //================================= This solves the inners for transport
     primary_ags_solver_->Setup();
     primary_ags_solver_->Solve();
@@ -46,7 +56,8 @@ void XXPowerIterationKEigen::Execute()
     F_prev = F_new;
     nit += 1;
 
-    if (k_eff_change < std::max(k_tolerance_, 1.0e-12)) converged = true;
+    if (k_eff_change < std::max(k_tolerance_, 1.0e-12) and inners_converged)
+      converged = true;
 
     //================================= Print iteration summary
     if (lbs_solver_.Options().verbose_outer_iterations)
@@ -57,12 +68,17 @@ void XXPowerIterationKEigen::Execute()
                   << std::setw(11) << std::setprecision(7) << k_eff_
                   << "  k_eff change " << std::setw(12) << k_eff_change
                   << "  reactivity " << std::setw(10) << reactivity * 1e5;
+      if (adaptive_inner_tol_)
+        k_iter_info << "  inner_tol " << std::setw(10)
+                    << front_wgs_solver_->ToleranceOptions().residual_absolute;
       if (converged) k_iter_info << " CONVERGED\n";
 
       Chi::log.Log() << k_iter_info.str();
     }
 
     if (converged) break;
+
+    lbs_solver_.WriteRestartDataIfDue(/*final_write=*/false);
   } // for k iterations
 
   //================================================== Print summary
@@ -73,6 +89,9 @@ void XXPowerIterationKEigen::Execute()
                  << std::setprecision(6) << k_eff_change << " (num_TrOps:"
                  << front_wgs_context_->counter_applications_of_inv_op_ << ")"
                  << "\n";
+  Chi::log.Log() << "        Outer iterations      :        " << nit;
+  Chi::log.Log() << "        Total sweeps          :        "
+                 << TotalSweepCount();
   Chi::log.Log() << "\n";
 
   if (lbs_solver_.Options().use_precursors)
@@ -82,6 +101,9 @@ void XXPowerIterationKEigen::Execute()
   }
 
   lbs_solver_.UpdateFieldFunctions();
+  lbs_solver_.ComputeTallies();
+
+  lbs_solver_.WriteRestartDataIfDue(/*final_write=*/true);
 
   Chi::log.Log()
     << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
@@ -3,6 +3,8 @@
 #include "chi_runtime.h"
 #include "chi_log.h"
 
+#include <cmath>
+
 namespace lbs
 {
 
@@ -33,4 +35,88 @@ void XXPowerIterationKEigen::SetLBSScatterSource(
       (suppress_wg_scat ? SUPPRESS_WG_SCATTER : NO_FLAGS_SET));
 }
 
-} // namespace lbs
\ No newline at end of file
+// ##################################################################
+/**Computes the relative change of the fission source, currently held in
+ * the q-moments vector, since the previous call. Returns 1.0 on the first
+ * call.*/
+double XXPowerIterationKEigen::ComputeFissionSourceResidual()
+{
+  double local_norms[2] = {0.0, 0.0};
+  if (q_fission_prev_.size() == q_moments_local_.size())
+    for (size_t i = 0; i < q_moments_local_.size(); ++i)
+    {
+      const double delta = q_moments_local_[i] - q_fission_prev_[i];
+      local_norms[0] += delta * delta;
+      local_norms[1] += q_moments_local_[i] * q_moments_local_[i];
+    }
+  const bool first_call = q_fission_prev_.size() != q_moments_local_.size();
+  q_fission_prev_ = q_moments_local_;
+
+  if (first_call) return 1.0;
+
+  double global_norms[2] = {0.0, 0.0};
+  MPI_Allreduce(local_norms,    // sendbuf
+                global_norms,   // recvbuf
+                2, MPI_DOUBLE,  // count+datatype
+                MPI_SUM,        // operation
+                Chi::mpi.comm); // comm
+
+  if (global_norms[1] < 1.0e-50) return 0.0;
+
+  return std::sqrt(global_norms[0] / global_norms[1]);
+}
+
+// ##################################################################
+/**Sets the within-groupset tolerances for the next outer iteration using
+ * an Eisenstat-Walker (choice 2) forcing term,
+ * \f$ \eta_k = \gamma (r_k / r_{k-1})^\alpha \f$, safeguarded against
+ * sudden decreases. The tolerance applied is \f$ \eta_k r_k \f$, limited
+ * to the range between the groupset tolerance and `inner_tol_max`.
+ * Returns true if all the groupsets are solved to their own tolerance.*/
+bool XXPowerIterationKEigen::UpdateInnerTolerances(const double outer_residual)
+{
+  double eta = inner_tol_max_;
+  if (outer_residual_prev_ > 0.0)
+  {
+    eta = inner_tol_gamma_ * std::pow(outer_residual / outer_residual_prev_,
+                                      inner_tol_alpha_);
+    const double eta_safeguard =
+      inner_tol_gamma_ * std::pow(inner_eta_prev_, inner_tol_alpha_);
+    if (eta_safeguard > 0.1) eta = std::max(eta, eta_safeguard);
+    eta = std::min(eta, inner_tol_max_);
+  }
+  inner_eta_prev_ = eta;
+  outer_residual_prev_ = outer_residual;
+
+  const double tol = std::min(eta * outer_residual, inner_tol_max_);
+
+  bool all_at_floor = true;
+  auto& wgs_solvers = lbs_solver_.GetWGSSolvers();
+  for (size_t gs = 0; gs < wgs_solvers.size(); ++gs)
+  {
+    const double floor = inner_tol_floors_[gs];
+    const double gs_tol = std::max(tol, floor);
+    wgs_solvers[gs]->ToleranceOptions().residual_absolute = gs_tol;
+    if (gs_tol > floor) all_at_floor = false;
+  }
+
+  return all_at_floor;
+}
+
+// ##################################################################
+/**Returns the number of sweeps (applications of the inverse transport
+ * operator) performed by all the groupsets.*/
+size_t XXPowerIterationKEigen::TotalSweepCount() const
+{
+  size_t count = 0;
+  for (auto& wgs_solver : lbs_solver_.GetWGSSolvers())
+  {
+    auto wgs_context =
+      std::dynamic_pointer_cast<lbs::WGSContext<Mat, Vec, KSP>>(
+        wgs_solver->GetContext());
+    if (wgs_context) count += wgs_context->counter_applications_of_inv_op_;
+  }
+  return count;
+}
+
+} // namespace lbs
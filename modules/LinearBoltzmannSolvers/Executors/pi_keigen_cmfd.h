@@ -0,0 +1,100 @@
+#ifndef CHITECH_PI_KEIGEN_CMFD_H
+#define CHITECH_PI_KEIGEN_CMFD_H
+
+#include "pi_keigen.h"
+
+namespace chi_mesh
+{
+class LogicalVolume;
+}
+
+namespace lbs
+{
+
+/**Power iteration k-eigenvalue executor accelerated with Coarse Mesh Finite
+ * Difference (CMFD) or partial-current CMFD (pCMFD).
+ *
+ * After every transport outer the fine-mesh flux is homogenized onto a
+ * user specified coarse grid (either an orthogonal overlay or a list of
+ * logical volumes), net/partial currents are tallied on coarse interfaces
+ * from the swept angular fluxes, and a small coarse eigenproblem, with
+ * nonlinear diffusion coefficient corrections that preserve the transport
+ * currents, is solved. The fine flux is then prolonged by the ratio of
+ * the new to the old coarse flux.*/
+class XXPowerIterationKEigenCMFD : public XXPowerIterationKEigen
+{
+protected:
+  typedef std::shared_ptr<const chi_mesh::LogicalVolume> LogicalVolumePtr;
+
+  /**Interface between two coarse cells, or between a coarse cell and
+   * a non-reflecting boundary (in which case `neighbor` is -1).*/
+  struct CoarseFace
+  {
+    int64_t cell = 0;
+    int64_t neighbor = -1;
+    double area = 0.0;
+    chi_mesh::Vector3 centroid;
+    size_t reverse_face = 0; ///< Index of the face with cell/neighbor swapped
+  };
+
+  const std::string cmfd_type_;
+  std::vector<size_t> coarse_divisions_;
+  std::vector<LogicalVolumePtr> coarse_logical_volumes_;
+  int coarse_max_iters_;
+  double coarse_k_tol_;
+  double coarse_linear_tol_;
+  int coarse_linear_max_iters_;
+  bool coarse_verbose_;
+
+  chi_mesh::Vector3 overlay_min_;
+  chi_mesh::Vector3 overlay_max_;
+
+  size_t num_coarse_cells_ = 0;
+  std::vector<int64_t> local_cell_coarse_ids_;
+  /**Coarse face index for each local cell face, -1 if the face is internal
+   * to a coarse cell or on a reflecting boundary.*/
+  std::vector<std::vector<int64_t>> local_face_coarse_face_ids_;
+  std::vector<double> coarse_volumes_;
+  std::vector<chi_mesh::Vector3> coarse_centroids_;
+  std::vector<CoarseFace> coarse_faces_;
+  std::map<std::pair<int64_t, int64_t>, size_t> coarse_face_map_;
+
+  /**Coarse cell homogenized quantities, indexed [I*G+g] (or
+   * [(I*G+g)*G+gp] for group-to-group quantities).*/
+  struct CoarseXS
+  {
+    std::vector<double> phi;
+    std::vector<double> sigma_t;
+    std::vector<double> diffusion_coeff;
+    std::vector<double> sigma_s;
+    std::vector<double> production;
+  };
+
+public:
+  static chi::InputParameters GetInputParameters();
+
+  explicit XXPowerIterationKEigenCMFD(const chi::InputParameters& params);
+
+  void Initialize() override;
+  void Execute() override;
+
+protected:
+  // 01
+  int64_t MapPointToCoarseCell(const chi_mesh::Vector3& point) const;
+  void BuildCoarseGrid();
+
+  // 03
+  CoarseXS HomogenizeOntoCoarseGrid(const VecDbl& phi) const;
+  std::vector<double> ComputeCoarsePartialCurrents() const;
+  double SolveCoarseEigenProblem(const CoarseXS& coarse_xs,
+                                 const std::vector<double>& partial_currents,
+                                 std::vector<double>& coarse_phi,
+                                 double k_guess) const;
+  void ProlongCoarseCorrection(const std::vector<double>& coarse_phi_old,
+                               const std::vector<double>& coarse_phi_new,
+                               VecDbl& phi) const;
+};
+
+} // namespace lbs
+
+#endif // CHITECH_PI_KEIGEN_CMFD_H
@@ -0,0 +1,117 @@
+#include "pi_keigen_cmfd.h"
+
+#include "mesh/LogicalVolume/LogicalVolume.h"
+
+#include "ChiObjectFactory.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+namespace lbs
+{
+
+RegisterChiObject(lbs, XXPowerIterationKEigenCMFD);
+
+chi::InputParameters XXPowerIterationKEigenCMFD::GetInputParameters()
+{
+  chi::InputParameters params = XXPowerIterationKEigen::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Generalized implementation of a k-Eigenvalue solver using Power "
+    "Iteration and with Coarse Mesh Finite Difference (CMFD) acceleration. "
+    "The coarse grid is either an orthogonal overlay of the mesh bounding "
+    "box (see \"coarse_divisions\"), or a list of logical volumes (see "
+    "\"coarse_logical_volumes\"). Angular fluxes are saved automatically "
+    "since the coarse interface currents are computed from them.");
+  params.SetDocGroup("LBSExecutors");
+
+  params.ChangeExistingParamToOptional("name", "XXPowerIterationKEigenCMFD");
+
+  params.AddOptionalParameter(
+    "cmfd_type",
+    "pcmfd",
+    "The type of coarse mesh correction. \"cmfd\" uses a single net-current "
+    "correction per coarse interface whilst \"pcmfd\" uses partial-current "
+    "corrections which are more robust for optically thick coarse cells.");
+
+  params.AddOptionalParameterArray(
+    "coarse_divisions",
+    std::vector<size_t>{},
+    "Number of coarse cells in x, y and z for an orthogonal overlay of the "
+    "global mesh bounding box. Unused dimensions should be set to 1.");
+
+  params.AddOptionalParameterArray(
+    "coarse_logical_volumes",
+    std::vector<size_t>{},
+    "Handles to logical volumes each defining a coarse cell. A fine cell is "
+    "assigned to the first logical volume containing its centroid. Cells not "
+    "within any logical volume are lumped into one additional coarse cell.");
+
+  params.AddOptionalParameter(
+    "coarse_max_iters",
+    100,
+    "Maximum allowable power iterations for the coarse eigenproblem");
+  params.AddOptionalParameter(
+    "coarse_k_tol",
+    1.0e-10,
+    "K-eigenvalue tolerance for the coarse eigenproblem");
+  params.AddOptionalParameter(
+    "coarse_linear_tol",
+    1.0e-10,
+    "Relative residual tolerance for the coarse linear solves");
+  params.AddOptionalParameter(
+    "coarse_linear_max_iters",
+    500,
+    "Maximum allowable iterations for the coarse linear solves");
+  params.AddOptionalParameter(
+    "coarse_verbose",
+    false,
+    "Flag, if set will result in verbose output from the coarse "
+    "eigenproblem");
+
+  using namespace chi_data_types;
+  params.ConstrainParameterRange("cmfd_type",
+                                 AllowableRangeList::New({"cmfd", "pcmfd"}));
+  params.ConstrainParameterRange("coarse_max_iters",
+                                 AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("coarse_linear_max_iters",
+                                 AllowableRangeLowLimit::New(1));
+
+  return params;
+}
+
+XXPowerIterationKEigenCMFD::XXPowerIterationKEigenCMFD(
+  const chi::InputParameters& params)
+  : XXPowerIterationKEigen(params),
+    cmfd_type_(params.GetParamValue<std::string>("cmfd_type")),
+    coarse_divisions_(params.GetParamVectorValue<size_t>("coarse_divisions")),
+    coarse_max_iters_(params.GetParamValue<int>("coarse_max_iters")),
+    coarse_k_tol_(params.GetParamValue<double>("coarse_k_tol")),
+    coarse_linear_tol_(params.GetParamValue<double>("coarse_linear_tol")),
+    coarse_linear_max_iters_(
+      params.GetParamValue<int>("coarse_linear_max_iters")),
+    coarse_verbose_(params.GetParamValue<bool>("coarse_verbose"))
+{
+  const auto lv_handles =
+    params.GetParamVectorValue<size_t>("coarse_logical_volumes");
+  for (const size_t lv_handle : lv_handles)
+    coarse_logical_volumes_.push_back(
+      Chi::GetStackItemPtrAsType<chi_mesh::LogicalVolume>(
+        Chi::object_stack, lv_handle, __FUNCTION__));
+
+  ChiInvalidArgumentIf(
+    coarse_divisions_.empty() and coarse_logical_volumes_.empty(),
+    "Either \"coarse_divisions\" or \"coarse_logical_volumes\" must be "
+    "specified.");
+  ChiInvalidArgumentIf(
+    not coarse_divisions_.empty() and not coarse_logical_volumes_.empty(),
+    "Only one of \"coarse_divisions\" and \"coarse_logical_volumes\" can be "
+    "specified.");
+  ChiInvalidArgumentIf(not coarse_divisions_.empty() and
+                         coarse_divisions_.size() != 3,
+                       "\"coarse_divisions\" requires exactly 3 entries.");
+  for (const size_t n : coarse_divisions_)
+    ChiInvalidArgumentIf(n == 0, "\"coarse_divisions\" entries must be > 0.");
+}
+
+} // namespace lbs
@@ -0,0 +1,284 @@
+#include "pi_keigen_cmfd.h"
+
+#include "mesh/LogicalVolume/LogicalVolume.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <array>
+
+namespace lbs
+{
+
+// ##################################################################
+/**Initializer.*/
+void XXPowerIterationKEigenCMFD::Initialize()
+{
+  //=========================================== Coarse currents are computed
+  //                                            from the angular fluxes
+  lbs_solver_.Options().save_angular_flux = true;
+
+  XXPowerIterationKEigen::Initialize();
+
+  BuildCoarseGrid();
+
+  Chi::log.Log() << TextName() << ": " << cmfd_type_ << " coarse grid with "
+                 << num_coarse_cells_ << " cells and "
+                 << coarse_faces_.size() << " interfaces.";
+}
+
+// ##################################################################
+/**Maps a point to the index of the coarse cell containing it.*/
+int64_t
+XXPowerIterationKEigenCMFD::MapPointToCoarseCell(
+  const chi_mesh::Vector3& point) const
+{
+  if (not coarse_logical_volumes_.empty())
+  {
+    const size_t num_lvs = coarse_logical_volumes_.size();
+    for (size_t lv = 0; lv < num_lvs; ++lv)
+      if (coarse_logical_volumes_[lv]->Inside(point))
+        return static_cast<int64_t>(lv);
+    return static_cast<int64_t>(num_lvs);
+  }
+
+  //=========================================== Orthogonal overlay
+  std::array<int64_t, 3> ijk = {0, 0, 0};
+  for (int d = 0; d < 3; ++d)
+  {
+    const auto n = static_cast<int64_t>(coarse_divisions_[d]);
+    const double length = overlay_max_[d] - overlay_min_[d];
+    if (n == 1 or length <= 0.0) continue;
+
+    const auto index =
+      static_cast<int64_t>((point[d] - overlay_min_[d]) / length * n);
+    ijk[d] = std::max(int64_t(0), std::min(n - 1, index));
+  }
+
+  const auto nx = static_cast<int64_t>(coarse_divisions_[0]);
+  const auto ny = static_cast<int64_t>(coarse_divisions_[1]);
+
+  return ijk[0] + nx * (ijk[1] + ny * ijk[2]);
+}
+
+// ##################################################################
+/**Builds the coarse cell map, the coarse volumes and centroids, as well
+ * as the list of coarse interfaces. All coarse data is replicated on
+ * all locations.*/
+void XXPowerIterationKEigenCMFD::BuildCoarseGrid()
+{
+  const auto& grid = lbs_solver_.Grid();
+  const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
+  const auto& sweep_boundaries = lbs_solver_.SweepBoundaries();
+
+  //=========================================== Determine number of coarse
+  //                                            cells
+  if (not coarse_logical_volumes_.empty())
+    num_coarse_cells_ = coarse_logical_volumes_.size() + 1;
+  else
+  {
+    num_coarse_cells_ =
+      coarse_divisions_[0] * coarse_divisions_[1] * coarse_divisions_[2];
+
+    const auto [local_min, local_max] = grid.GetLocalBoundingBox();
+    std::array<double, 3> local_min_arr = {local_min.x,
+                                           local_min.y,
+                                           local_min.z};
+    std::array<double, 3> local_max_arr = {local_max.x,
+                                           local_max.y,
+                                           local_max.z};
+    std::array<double, 3> global_min_arr = {0.0, 0.0, 0.0};
+    std::array<double, 3> global_max_arr = {0.0, 0.0, 0.0};
+
+    MPI_Allreduce(local_min_arr.data(),  // sendbuf
+                  global_min_arr.data(), // recvbuf
+                  3, MPI_DOUBLE,         // count+datatype
+                  MPI_MIN,               // operation
+                  Chi::mpi.comm);        // comm
+    MPI_Allreduce(local_max_arr.data(),  // sendbuf
+                  global_max_arr.data(), // recvbuf
+                  3, MPI_DOUBLE,         // count+datatype
+                  MPI_MAX,               // operation
+                  Chi::mpi.comm);        // comm
+
+    overlay_min_ = chi_mesh::Vector3(
+      global_min_arr[0], global_min_arr[1], global_min_arr[2]);
+    overlay_max_ = chi_mesh::Vector3(
+      global_max_arr[0], global_max_arr[1], global_max_arr[2]);
+  }
+
+  //=========================================== Map local cells and compute
+  //                                            coarse volumes and centroids
+  const size_t Nc = num_coarse_cells_;
+  local_cell_coarse_ids_.assign(grid.local_cells.size(), 0);
+  std::vector<double> local_vol_data(4 * Nc, 0.0);
+  for (const auto& cell : grid.local_cells)
+  {
+    const int64_t I = MapPointToCoarseCell(cell.centroid_);
+    local_cell_coarse_ids_[cell.local_id_] = I;
+
+    double volume = 0.0;
+    for (const double intV_shapeI : unit_cell_matrices[cell.local_id_].Vi_vectors)
+      volume += intV_shapeI;
+
+    local_vol_data[4 * I + 0] += volume;
+    local_vol_data[4 * I + 1] += volume * cell.centroid_.x;
+    local_vol_data[4 * I + 2] += volume * cell.centroid_.y;
+    local_vol_data[4 * I + 3] += volume * cell.centroid_.z;
+  }
+
+  std::vector<double> global_vol_data(4 * Nc, 0.0);
+  MPI_Allreduce(local_vol_data.data(),                // sendbuf
+                global_vol_data.data(),               // recvbuf
+                static_cast<int>(4 * Nc), MPI_DOUBLE, // count+datatype
+                MPI_SUM,                              // operation
+                Chi::mpi.comm);                       // comm
+
+  coarse_volumes_.assign(Nc, 0.0);
+  coarse_centroids_.assign(Nc, chi_mesh::Vector3());
+  for (size_t I = 0; I < Nc; ++I)
+  {
+    const double V = global_vol_data[4 * I];
+    coarse_volumes_[I] = V;
+    if (V > 0.0)
+      coarse_centroids_[I] = chi_mesh::Vector3(global_vol_data[4 * I + 1],
+                                               global_vol_data[4 * I + 2],
+                                               global_vol_data[4 * I + 3]) /
+                             V;
+  }
+
+  //=========================================== Tally local coarse interfaces
+  //                                            (area, area*centroid)
+  //                                            Faces internal to a coarse
+  //                                            cell or on reflecting
+  //                                            boundaries are flagged with
+  //                                            a neighbor of -2.
+  typedef std::pair<int64_t, int64_t> FaceKey;
+  std::map<FaceKey, std::array<double, 4>> local_faces;
+  std::vector<std::vector<int64_t>> local_face_neighbors;
+  local_face_neighbors.reserve(grid.local_cells.size());
+  for (const auto& cell : grid.local_cells)
+  {
+    const int64_t I = local_cell_coarse_ids_[cell.local_id_];
+    const auto& face_Si_vectors =
+      unit_cell_matrices[cell.local_id_].face_Si_vectors;
+
+    auto& face_neighbors = local_face_neighbors.emplace_back(
+      cell.faces_.size(), -2);
+
+    size_t f = 0;
+    for (const auto& face : cell.faces_)
+    {
+      int64_t J = -1;
+      if (face.has_neighbor_)
+      {
+        J = MapPointToCoarseCell(grid.cells[face.neighbor_id_].centroid_);
+        if (J == I) { ++f; continue; }
+      }
+      else if (sweep_boundaries.at(face.neighbor_id_)->IsReflecting())
+      {
+        ++f;
+        continue;
+      }
+      face_neighbors[f] = J;
+
+      double area = 0.0;
+      for (const double intF_shapeI : face_Si_vectors[f])
+        area += intF_shapeI;
+
+      auto& entry = local_faces[{I, J}];
+      entry[0] += area;
+      entry[1] += area * face.centroid_.x;
+      entry[2] += area * face.centroid_.y;
+      entry[3] += area * face.centroid_.z;
+      ++f;
+    } // for face
+  }   // for cell
+
+  //=========================================== Gather all interfaces
+  std::vector<double> local_face_data;
+  local_face_data.reserve(6 * local_faces.size());
+  for (const auto& [key, entry] : local_faces)
+  {
+    local_face_data.push_back(static_cast<double>(key.first));
+    local_face_data.push_back(static_cast<double>(key.second));
+    for (const double value : entry)
+      local_face_data.push_back(value);
+  }
+
+  const int local_count = static_cast<int>(local_face_data.size());
+  std::vector<int> recv_counts(Chi::mpi.process_count, 0);
+  MPI_Allgather(&local_count, 1, MPI_INT,        // send
+                recv_counts.data(), 1, MPI_INT,  // recv
+                Chi::mpi.comm);                  // comm
+
+  std::vector<int> recv_displs(Chi::mpi.process_count, 0);
+  int total_count = 0;
+  for (int p = 0; p < Chi::mpi.process_count; ++p)
+  {
+    recv_displs[p] = total_count;
+    total_count += recv_counts[p];
+  }
+
+  std::vector<double> global_face_data(total_count, 0.0);
+  MPI_Allgatherv(local_face_data.data(), local_count, MPI_DOUBLE, // send
+                 global_face_data.data(),                          // recv
+                 recv_counts.data(), recv_displs.data(), MPI_DOUBLE,
+                 Chi::mpi.comm);                                   // comm
+
+  std::map<FaceKey, std::array<double, 4>> global_faces;
+  for (size_t k = 0; k < global_face_data.size(); k += 6)
+  {
+    const FaceKey key = {static_cast<int64_t>(global_face_data[k]),
+                         static_cast<int64_t>(global_face_data[k + 1])};
+    auto& entry = global_faces[key];
+    for (size_t j = 0; j < 4; ++j)
+      entry[j] += global_face_data[k + 2 + j];
+  }
+
+  //=========================================== Build coarse faces
+  coarse_faces_.clear();
+  coarse_face_map_.clear();
+  for (const auto& [key, entry] : global_faces)
+  {
+    CoarseFace coarse_face;
+    coarse_face.cell = key.first;
+    coarse_face.neighbor = key.second;
+    coarse_face.area = entry[0];
+    if (entry[0] > 0.0)
+      coarse_face.centroid =
+        chi_mesh::Vector3(entry[1], entry[2], entry[3]) / entry[0];
+
+    coarse_face_map_[key] = coarse_faces_.size();
+    coarse_faces_.push_back(coarse_face);
+  }
+
+  for (auto& coarse_face : coarse_faces_)
+  {
+    if (coarse_face.neighbor < 0) continue;
+    const FaceKey reverse_key = {coarse_face.neighbor, coarse_face.cell};
+    ChiLogicalErrorIf(coarse_face_map_.count(reverse_key) == 0,
+                      "Coarse interface without a matching reverse "
+                      "interface.");
+    coarse_face.reverse_face = coarse_face_map_.at(reverse_key);
+  }
+
+  //=========================================== Map local faces to coarse
+  //                                            faces
+  local_face_coarse_face_ids_.assign(grid.local_cells.size(), {});
+  for (const auto& cell : grid.local_cells)
+  {
+    const int64_t I = local_cell_coarse_ids_[cell.local_id_];
+    const auto& face_neighbors = local_face_neighbors[cell.local_id_];
+
+    auto& face_ids = local_face_coarse_face_ids_[cell.local_id_];
+    face_ids.assign(face_neighbors.size(), -1);
+    for (size_t f = 0; f < face_neighbors.size(); ++f)
+      if (face_neighbors[f] != -2)
+        face_ids[f] = static_cast<int64_t>(
+          coarse_face_map_.at({I, face_neighbors[f]}));
+  }
+}
+
+} // namespace lbs
@@ -0,0 +1,113 @@
+#include "pi_keigen_cmfd.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "utils/chi_timer.h"
+
+#include "A_LBSSolver/IterativeMethods/ags_linear_solver.h"
+
+#include <iomanip>
+
+namespace lbs
+{
+
+// ##################################################################
+/**Executes the solver.*/
+void XXPowerIterationKEigenCMFD::Execute()
+{
+  using namespace chi_math;
+
+  k_eff_ = 1.0;
+  double k_eff_prev = 1.0;
+  double k_eff_change = 1.0;
+
+  //================================================== Start power iterations
+  size_t nit = 0;
+  bool converged = false;
+  while (nit < max_iters_)
+  {
+    //================================= Set the fission source
+    SetLBSFissionSource(phi_old_local_, /*additive=*/false);
+    Scale(q_moments_local_, 1.0 / k_eff_);
+
+    //================================= Adapt the inner tolerances
+    bool inners_converged = true;
+    if (adaptive_inner_tol_)
+      inners_converged = UpdateInnerTolerances(
+        std::max(ComputeFissionSourceResidual(), k_eff_change));
+
+    //================================= This solves the inners for transport
+    primary_ags_solver_->Setup();
+    primary_ags_solver_->Solve();
+
+    //================================= Homogenize and tally coarse currents
+    const auto coarse_xs = HomogenizeOntoCoarseGrid(phi_new_local_);
+    const auto partial_currents = ComputeCoarsePartialCurrents();
+
+    //================================= Solve the coarse eigenproblem
+    auto coarse_phi = coarse_xs.phi;
+    k_eff_ = SolveCoarseEigenProblem(
+      coarse_xs, partial_currents, coarse_phi, k_eff_);
+
+    //================================= Prolong the coarse correction
+    ProlongCoarseCorrection(coarse_xs.phi, coarse_phi, phi_new_local_);
+    phi_old_local_ = phi_new_local_;
+
+    double reactivity = (k_eff_ - 1.0) / k_eff_;
+
+    //================================= Check convergence, bookkeeping
+    k_eff_change = fabs(k_eff_ - k_eff_prev) / k_eff_;
+    k_eff_prev = k_eff_;
+    nit += 1;
+
+    if (k_eff_change < std::max(k_tolerance_, 1.0e-12) and inners_converged)
+      converged = true;
+
+    //================================= Print iteration summary
+    if (lbs_solver_.Options().verbose_outer_iterations)
+    {
+      std::stringstream k_iter_info;
+      k_iter_info << Chi::program_timer.GetTimeString() << " "
+                  << "  Iteration " << std::setw(5) << nit << "  k_eff "
+                  << std::setw(11) << std::setprecision(7) << k_eff_
+                  << "  k_eff change " << std::setw(12) << k_eff_change
+                  << "  reactivity " << std::setw(10) << reactivity * 1e5
+                  << "  num_TrOps "
+                  << front_wgs_context_->counter_applications_of_inv_op_;
+      if (adaptive_inner_tol_)
+        k_iter_info << "  inner_tol " << std::setw(10)
+                    << front_wgs_solver_->ToleranceOptions().residual_absolute;
+      if (converged) k_iter_info << " CONVERGED\n";
+
+      Chi::log.Log() << k_iter_info.str();
+    }
+
+    if (converged) break;
+  } // for k iterations
+
+  //================================================== Print summary
+  Chi::log.Log() << "\n";
+  Chi::log.Log() << "        Final k-eigenvalue    :        "
+                 << std::setprecision(7) << k_eff_;
+  Chi::log.Log() << "        Final change          :        "
+                 << std::setprecision(6) << k_eff_change << " (num_TrOps:"
+                 << front_wgs_context_->counter_applications_of_inv_op_ << ")"
+                 << "\n";
+  Chi::log.Log() << "        Total sweeps          :        "
+                 << TotalSweepCount();
+  Chi::log.Log() << "\n";
+
+  if (lbs_solver_.Options().use_precursors)
+  {
+    lbs_solver_.ComputePrecursors();
+    chi_math::Scale(lbs_solver_.PrecursorsNewLocal(), 1.0 / k_eff_);
+  }
+
+  lbs_solver_.UpdateFieldFunctions();
+  lbs_solver_.ComputeTallies();
+
+  Chi::log.Log()
+    << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
+}
+
+} // namespace lbs
@@ -0,0 +1,486 @@
+#include "pi_keigen_cmfd.h"
+
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "math/SpatialDiscretization/spatial_discretization.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include <petscksp.h>
+
+#include <iomanip>
+
+namespace lbs
+{
+
+// ##################################################################
+/**Computes flux-weighted coarse cell cross sections and volume averaged
+ * coarse scalar fluxes from the given fine-mesh flux moments.*/
+XXPowerIterationKEigenCMFD::CoarseXS
+XXPowerIterationKEigenCMFD::HomogenizeOntoCoarseGrid(const VecDbl& phi) const
+{
+  const auto& grid = lbs_solver_.Grid();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
+  const bool use_precursors = lbs_solver_.Options().use_precursors;
+
+  const size_t Nc = num_coarse_cells_;
+  const size_t G = lbs_solver_.NumGroups();
+  const size_t NG = Nc * G;
+
+  //=========================================== Data layout of the packed
+  //                                            buffer
+  const size_t phi_offset = 0;
+  const size_t sigt_offset = NG;
+  const size_t diff_offset = 2 * NG;
+  const size_t sigs_offset = 3 * NG;
+  const size_t prod_offset = 3 * NG + NG * G;
+
+  std::vector<double> local_data(3 * NG + 2 * NG * G, 0.0);
+  std::vector<double> int_phi(G, 0.0);
+
+  //=========================================== Loop over local cells
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto& Vi = unit_cell_matrices[cell.local_id_].Vi_vectors;
+    const auto& xs = transport_view.XS();
+    const auto& sigma_t = xs.SigmaTotal();
+    const size_t I = local_cell_coarse_ids_[cell.local_id_];
+
+    //==================================== Integrate the scalar flux
+    int_phi.assign(G, 0.0);
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+    {
+      const size_t uk_map = transport_view.MapDOF(i, 0, 0);
+      for (size_t g = 0; g < G; ++g)
+        int_phi[g] += Vi[i] * phi[uk_map + g];
+    }
+
+    //==================================== Tally reaction rates
+    for (size_t g = 0; g < G; ++g)
+    {
+      const size_t Ig = I * G + g;
+      const double D = xs.DiffusionInitialized()
+                         ? xs.DiffusionCoefficient()[g]
+                         : 1.0 / (3.0 * sigma_t[g]);
+
+      local_data[phi_offset + Ig] += int_phi[g];
+      local_data[sigt_offset + Ig] += sigma_t[g] * int_phi[g];
+      local_data[diff_offset + Ig] += D * int_phi[g];
+    }
+
+    if (not xs.TransferMatrices().empty())
+    {
+      const auto& S0 = xs.TransferMatrix(0);
+      for (size_t g = 0; g < G; ++g)
+        for (const auto& [_, gp, sigma_sm] : S0.Row(g))
+          local_data[sigs_offset + (I * G + g) * G + gp] +=
+            sigma_sm * int_phi[gp];
+    }
+
+    if (xs.IsFissionable())
+    {
+      const auto F = xs.ProductionMatrix();
+      for (size_t g = 0; g < G; ++g)
+        for (size_t gp = 0; gp < G; ++gp)
+          local_data[prod_offset + (I * G + g) * G + gp] +=
+            F[g][gp] * int_phi[gp];
+
+      if (use_precursors)
+      {
+        const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
+        for (const auto& precursor : xs.Precursors())
+          for (size_t g = 0; g < G; ++g)
+            for (size_t gp = 0; gp < G; ++gp)
+              local_data[prod_offset + (I * G + g) * G + gp] +=
+                precursor.emission_spectrum[g] * precursor.fractional_yield *
+                nu_delayed_sigma_f[gp] * int_phi[gp];
+      }
+    }
+  } // for cell
+
+  std::vector<double> global_data(local_data.size(), 0.0);
+  MPI_Allreduce(local_data.data(),                                 // sendbuf
+                global_data.data(),                                // recvbuf
+                static_cast<int>(local_data.size()), MPI_DOUBLE,   // count+type
+                MPI_SUM,                                           // operation
+                Chi::mpi.comm);                                    // comm
+
+  //=========================================== Normalize
+  CoarseXS coarse_xs;
+  coarse_xs.phi.assign(NG, 0.0);
+  coarse_xs.sigma_t.assign(NG, 0.0);
+  coarse_xs.diffusion_coeff.assign(NG, 0.0);
+  coarse_xs.sigma_s.assign(NG * G, 0.0);
+  coarse_xs.production.assign(NG * G, 0.0);
+
+  for (size_t I = 0; I < Nc; ++I)
+  {
+    const double V = coarse_volumes_[I];
+    if (V <= 0.0) continue;
+
+    for (size_t g = 0; g < G; ++g)
+    {
+      const size_t Ig = I * G + g;
+      const double int_phi_g = global_data[phi_offset + Ig];
+      coarse_xs.phi[Ig] = int_phi_g / V;
+
+      if (int_phi_g <= 0.0) continue;
+      coarse_xs.sigma_t[Ig] = global_data[sigt_offset + Ig] / int_phi_g;
+      coarse_xs.diffusion_coeff[Ig] = global_data[diff_offset + Ig] / int_phi_g;
+    }
+
+    for (size_t g = 0; g < G; ++g)
+      for (size_t gp = 0; gp < G; ++gp)
+      {
+        const double int_phi_gp = global_data[phi_offset + I * G + gp];
+        if (int_phi_gp <= 0.0) continue;
+
+        const size_t Iggp = (I * G + g) * G + gp;
+        coarse_xs.sigma_s[Iggp] = global_data[sigs_offset + Iggp] / int_phi_gp;
+        coarse_xs.production[Iggp] =
+          global_data[prod_offset + Iggp] / int_phi_gp;
+      }
+  } // for I
+
+  return coarse_xs;
+}
+
+// ##################################################################
+/**Tallies, from the saved angular fluxes, the outgoing partial current
+ * (integrated over the interface) for every coarse face and group.
+ * Indexed as [face*G+g].*/
+std::vector<double>
+XXPowerIterationKEigenCMFD::ComputeCoarsePartialCurrents() const
+{
+  const auto& grid = lbs_solver_.Grid();
+  const auto& sdm = lbs_solver_.SpatialDiscretization();
+  const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
+  const auto& psi_new_local = lbs_solver_.PsiNewLocal();
+
+  const size_t G = lbs_solver_.NumGroups();
+
+  std::vector<double> local_currents(coarse_faces_.size() * G, 0.0);
+
+  for (const auto& groupset : groupsets_)
+  {
+    const auto& psi_uk_man = groupset.psi_uk_man_;
+    const auto& quadrature = groupset.quadrature_;
+    const auto& psi = psi_new_local[groupset.id_];
+
+    const size_t num_angles = quadrature->omegas_.size();
+    const int gsi = groupset.groups_.front().id_;
+    const int gsf = groupset.groups_.back().id_;
+    const int gs_num_groups = gsf + 1 - gsi;
+
+    for (const auto& cell : grid.local_cells)
+    {
+      const auto& cell_mapping = sdm.GetCellMapping(cell);
+      const auto& face_Si_vectors =
+        unit_cell_matrices[cell.local_id_].face_Si_vectors;
+      const auto& face_ids = local_face_coarse_face_ids_[cell.local_id_];
+
+      size_t f = 0;
+      for (const auto& face : cell.faces_)
+      {
+        if (face_ids[f] < 0) { ++f; continue; }
+        const auto cf = static_cast<size_t>(face_ids[f]);
+
+        const auto& IntF_shapeI = face_Si_vectors[f];
+        const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+          for (size_t n = 0; n < num_angles; ++n)
+          {
+            const double mu = quadrature->omegas_[n].Dot(face.normal_);
+            if (mu <= 0.0) continue;
+
+            const double wt_mu_intF = quadrature->weights_[n] * mu * IntF_shapeI[i];
+            const int64_t imap = sdm.MapDOFLocal(cell, i, psi_uk_man, n, 0);
+            for (int gi = 0; gi < gs_num_groups; ++gi)
+              local_currents[cf * G + gsi + gi] += wt_mu_intF * psi[imap + gi];
+          } // for n
+        }   // for face node
+        ++f;
+      } // for face
+    }   // for cell
+  }     // for groupset
+
+  std::vector<double> global_currents(local_currents.size(), 0.0);
+  MPI_Allreduce(local_currents.data(),                                // sendbuf
+                global_currents.data(),                               // recvbuf
+                static_cast<int>(local_currents.size()), MPI_DOUBLE,  // count+type
+                MPI_SUM,                                              // operation
+                Chi::mpi.comm);                                       // comm
+
+  return global_currents;
+}
+
+// ##################################################################
+/**Assembles the coarse operator, with nonlinear current corrections
+ * computed from the transport partial currents, and solves the coarse
+ * eigenproblem with power iteration. The coarse system is small and is
+ * therefore replicated and solved serially on each location. On return
+ * `coarse_phi` contains the new coarse flux normalized to the same total
+ * fission production as the input flux.*/
+double XXPowerIterationKEigenCMFD::SolveCoarseEigenProblem(
+  const CoarseXS& coarse_xs,
+  const std::vector<double>& partial_currents,
+  std::vector<double>& coarse_phi,
+  const double k_guess) const
+{
+  const size_t Nc = num_coarse_cells_;
+  const size_t G = lbs_solver_.NumGroups();
+  const auto N = static_cast<int64_t>(Nc * G);
+  const bool partial_current_cmfd = (cmfd_type_ == "pcmfd");
+  const double eps = 1.0e-30;
+
+  //=========================================== Determine row nonzeros
+  std::vector<int64_t> nnz(N, static_cast<int64_t>(G));
+  for (const auto& coarse_face : coarse_faces_)
+    if (coarse_face.neighbor >= 0)
+      for (size_t g = 0; g < G; ++g)
+        nnz[coarse_face.cell * G + g] += 1;
+
+  //=========================================== Create matrix
+  Mat A;
+  MatCreate(PETSC_COMM_SELF, &A);
+  MatSetSizes(A, N, N, N, N);
+  MatSetType(A, MATSEQAIJ);
+  MatSeqAIJSetPreallocation(A, 0, nnz.data());
+  MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+
+  //=========================================== Removal and scattering
+  for (size_t I = 0; I < Nc; ++I)
+  {
+    const double V = coarse_volumes_[I];
+    for (size_t g = 0; g < G; ++g)
+    {
+      const int64_t row = static_cast<int64_t>(I * G + g);
+      if (V <= 0.0)
+      {
+        MatSetValue(A, row, row, 1.0, ADD_VALUES);
+        continue;
+      }
+
+      MatSetValue(A, row, row, V * coarse_xs.sigma_t[I * G + g], ADD_VALUES);
+      for (size_t gp = 0; gp < G; ++gp)
+      {
+        const double sigma_s = coarse_xs.sigma_s[(I * G + g) * G + gp];
+        if (std::fabs(sigma_s) > 0.0)
+          MatSetValue(A,
+                      row,
+                      static_cast<int64_t>(I * G + gp),
+                      -V * sigma_s,
+                      ADD_VALUES);
+      }
+    } // for g
+  }   // for I
+
+  //=========================================== Interface couplings
+  for (size_t cf = 0; cf < coarse_faces_.size(); ++cf)
+  {
+    const auto& coarse_face = coarse_faces_[cf];
+    const int64_t I = coarse_face.cell;
+    const int64_t J = coarse_face.neighbor;
+    const double A_f = coarse_face.area;
+    if (A_f <= 0.0) continue;
+
+    for (size_t g = 0; g < G; ++g)
+    {
+      const int64_t row = static_cast<int64_t>(I * G + g);
+      const double phi_I = coarse_xs.phi[I * G + g];
+      const double j_out = partial_currents[cf * G + g] / A_f;
+
+      //============================ Non-reflecting boundary
+      if (J < 0)
+      {
+        const double D_hat = (phi_I > eps) ? j_out / phi_I : 0.0;
+        MatSetValue(A, row, row, A_f * D_hat, ADD_VALUES);
+        continue;
+      }
+
+      //============================ Interior interface
+      const int64_t col = static_cast<int64_t>(J * G + g);
+      const double phi_J = coarse_xs.phi[J * G + g];
+      const double j_in = partial_currents[coarse_face.reverse_face * G + g] / A_f;
+
+      const double D_I = coarse_xs.diffusion_coeff[I * G + g];
+      const double D_J = coarse_xs.diffusion_coeff[J * G + g];
+      const double d_I = (coarse_face.centroid - coarse_centroids_[I]).Norm();
+      const double d_J = (coarse_face.centroid - coarse_centroids_[J]).Norm();
+      const double denom = D_I * d_J + D_J * d_I;
+      const double D_tilde = (denom > eps) ? D_I * D_J / denom : 0.0;
+
+      if (partial_current_cmfd)
+      {
+        const double D_hat_p =
+          (phi_I > eps) ? (j_out + 0.5 * D_tilde * (phi_J - phi_I)) / phi_I
+                        : 0.0;
+        const double D_hat_m =
+          (phi_J > eps) ? (j_in - 0.5 * D_tilde * (phi_J - phi_I)) / phi_J
+                        : 0.0;
+
+        MatSetValue(A, row, row, A_f * (D_tilde + D_hat_p), ADD_VALUES);
+        MatSetValue(A, row, col, -A_f * (D_tilde + D_hat_m), ADD_VALUES);
+      }
+      else
+      {
+        const double j_net = j_out - j_in;
+        const double D_hat =
+          (phi_I + phi_J > eps)
+            ? -(j_net + D_tilde * (phi_J - phi_I)) / (phi_I + phi_J)
+            : 0.0;
+
+        MatSetValue(A, row, row, A_f * (D_tilde - D_hat), ADD_VALUES);
+        MatSetValue(A, row, col, -A_f * (D_tilde + D_hat), ADD_VALUES);
+      }
+    } // for g
+  }   // for coarse face
+
+  MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
+
+  //=========================================== Create solver
+  Vec x, b;
+  VecCreateSeq(PETSC_COMM_SELF, N, &x);
+  VecDuplicate(x, &b);
+
+  KSP ksp;
+  KSPCreate(PETSC_COMM_SELF, &ksp);
+  KSPSetOperators(ksp, A, A);
+  KSPSetType(ksp, KSPGMRES);
+  PC pc;
+  KSPGetPC(ksp, &pc);
+  PCSetType(pc, PCILU);
+  KSPSetTolerances(
+    ksp, coarse_linear_tol_, 1.0e-50, 1.0e10, coarse_linear_max_iters_);
+  KSPSetInitialGuessNonzero(ksp, PETSC_TRUE);
+
+  //=========================================== Fission production
+  auto ComputeProduction = [this, &coarse_xs, Nc, G](const double* phi,
+                                                     double* fission_src)
+  {
+    double production = 0.0;
+    for (size_t I = 0; I < Nc; ++I)
+    {
+      const double V = coarse_volumes_[I];
+      for (size_t g = 0; g < G; ++g)
+      {
+        double value = 0.0;
+        for (size_t gp = 0; gp < G; ++gp)
+          value += coarse_xs.production[(I * G + g) * G + gp] * phi[I * G + gp];
+        if (fission_src) fission_src[I * G + g] = V * value;
+        production += V * value;
+      }
+    }
+    return production;
+  };
+
+  //=========================================== Power iterations
+  double* x_raw;
+  VecGetArray(x, &x_raw);
+  for (int64_t i = 0; i < N; ++i)
+    x_raw[i] = coarse_phi[i];
+  VecRestoreArray(x, &x_raw);
+
+  const double production_initial =
+    ComputeProduction(coarse_phi.data(), nullptr);
+  double production = production_initial;
+  double k = k_guess;
+  int total_linear_its = 0;
+  for (int nit = 0; nit < coarse_max_iters_; ++nit)
+  {
+    double* b_raw;
+    VecGetArray(x, &x_raw);
+    VecGetArray(b, &b_raw);
+    ComputeProduction(x_raw, b_raw);
+    for (int64_t i = 0; i < N; ++i)
+      b_raw[i] /= k;
+    VecRestoreArray(b, &b_raw);
+    VecRestoreArray(x, &x_raw);
+
+    KSPSolve(ksp, b, x);
+
+    PetscInt its;
+    KSPGetIterationNumber(ksp, &its);
+    total_linear_its += static_cast<int>(its);
+
+    VecGetArray(x, &x_raw);
+    const double production_new = ComputeProduction(x_raw, nullptr);
+    VecRestoreArray(x, &x_raw);
+
+    if (production <= 0.0 or production_new <= 0.0) break;
+
+    const double k_new = k * production_new / production;
+    const double k_change = std::fabs(k_new - k) / k_new;
+    k = k_new;
+    production = production_new;
+
+    if (coarse_verbose_)
+      Chi::log.Log() << "CMFD iteration " << nit << " k " << std::setprecision(10)
+                     << k << " k change " << k_change << " linear its "
+                     << its;
+
+    if (k_change < coarse_k_tol_) break;
+  }
+
+  //=========================================== Normalize coarse flux
+  const double scale =
+    (production > 0.0) ? production_initial / production : 1.0;
+  VecGetArray(x, &x_raw);
+  for (int64_t i = 0; i < N; ++i)
+    coarse_phi[i] = scale * x_raw[i];
+  VecRestoreArray(x, &x_raw);
+
+  if (coarse_verbose_)
+    Chi::log.Log() << "CMFD coarse solve total linear iterations "
+                   << total_linear_its;
+
+  KSPDestroy(&ksp);
+  VecDestroy(&x);
+  VecDestroy(&b);
+  MatDestroy(&A);
+
+  return k;
+}
+
+// ##################################################################
+/**Scales all the flux moments in each coarse cell and group by the ratio of
+ * the new to the old coarse scalar flux.*/
+void XXPowerIterationKEigenCMFD::ProlongCoarseCorrection(
+  const std::vector<double>& coarse_phi_old,
+  const std::vector<double>& coarse_phi_new,
+  VecDbl& phi) const
+{
+  const auto& grid = lbs_solver_.Grid();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+
+  const size_t G = lbs_solver_.NumGroups();
+  const size_t num_moments = lbs_solver_.NumMoments();
+
+  std::vector<double> ratio(coarse_phi_old.size(), 1.0);
+  for (size_t i = 0; i < ratio.size(); ++i)
+    if (coarse_phi_old[i] > 0.0 and coarse_phi_new[i] > 0.0)
+      ratio[i] = coarse_phi_new[i] / coarse_phi_old[i];
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const size_t I = local_cell_coarse_ids_[cell.local_id_];
+
+    const int num_nodes = transport_view.NumNodes();
+    for (int i = 0; i < num_nodes; ++i)
+      for (size_t m = 0; m < num_moments; ++m)
+      {
+        const size_t uk_map = transport_view.MapDOF(i, m, 0);
+        for (size_t g = 0; g < G; ++g)
+          phi[uk_map + g] *= ratio[I * G + g];
+      }
+  } // for cell
+}
+
+} // namespace lbs
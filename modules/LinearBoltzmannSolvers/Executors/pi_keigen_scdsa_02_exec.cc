@@ -45,6 +45,12 @@ void XXPowerIterationKEigenSCDSA::Execute()
     SetLBSFissionSource(phi_old_local_, /*additive=*/false);
     Scale(q_moments_local_, 1.0 / k_eff_);
 
+    //================================= Adapt the inner tolerances
+    bool inners_converged = true;
+    if (adaptive_inner_tol_)
+      inners_converged = UpdateInnerTolerances(
+        std::max(ComputeFissionSourceResidual(), k_eff_change));
+
     auto Sf_ell = q_moments_local_;
     auto Sf0_ell = CopyOnlyPhi0(front_gs_, q_moments_local_);
 
@@ -146,7 +152,8 @@ void XXPowerIterationKEigenSCDSA::Execute()
     k_eff_prev = k_eff_;
     nit += 1;
 
-    if (k_eff_change < std::max(k_tolerance_, 1.0e-12)) converged = true;
+    if (k_eff_change < std::max(k_tolerance_, 1.0e-12) and inners_converged)
+      converged = true;
 
     //================================= Print iteration summary
     if (lbs_solver_.Options().verbose_outer_iterations)
@@ -157,6 +164,9 @@ void XXPowerIterationKEigenSCDSA::Execute()
                   << std::setw(11) << std::setprecision(7) << k_eff_
                   << "  k_eff change " << std::setw(12) << k_eff_change
                   << "  reactivity " << std::setw(10) << reactivity * 1e5;
+      if (adaptive_inner_tol_)
+        k_iter_info << "  inner_tol " << std::setw(10)
+                    << front_wgs_solver_->ToleranceOptions().residual_absolute;
       if (converged) k_iter_info << " CONVERGED\n";
 
       Chi::log.Log() << k_iter_info.str();
@@ -173,6 +183,8 @@ void XXPowerIterationKEigenSCDSA::Execute()
                  << std::setprecision(6) << k_eff_change << " (num_TrOps:"
                  << front_wgs_context_->counter_applications_of_inv_op_ << ")"
                  << "\n";
+  Chi::log.Log() << "        Total sweeps          :        "
+                 << TotalSweepCount();
   Chi::log.Log() << "\n";
 
   if (lbs_solver_.Options().use_precursors)
@@ -182,6 +194,7 @@ void XXPowerIterationKEigenSCDSA::Execute()
   }
 
   lbs_solver_.UpdateFieldFunctions();
+  lbs_solver_.ComputeTallies();
 
   Chi::log.Log()
     << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
@@ -0,0 +1,98 @@
+#include "data_types/flat_index_map.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+#include "utils/chi_timer.h"
+
+#include <map>
+#include <random>
+#include <algorithm>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_data_types_Test01_FlatIndexMap(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_data_types_Test01_FlatIndexMap,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_data_types_Test01_FlatIndexMap);
+
+/**Checks chi_data_types::FlatIndexMap against std::map and compares the
+ * lookup times of both for a typical global-to-local cell-id mapping,
+ * i.e., a block of sparse global-ids queried in face-neighbor order.*/
+chi::ParameterBlock
+chi_data_types_Test01_FlatIndexMap(const chi::InputParameters&)
+{
+  const size_t num_entries = 200000;
+  const size_t num_lookups = 20;
+
+  //======================================== Generate sparse global ids
+  std::mt19937_64 rng(12345);
+  std::vector<uint64_t> global_ids(num_entries);
+  uint64_t gid = 0;
+  for (auto& id : global_ids)
+  {
+    gid += 1 + rng() % 7;
+    id = gid;
+  }
+
+  std::vector<uint64_t> queries = global_ids;
+  std::shuffle(queries.begin(), queries.end(), rng);
+
+  //======================================== Populate maps
+  std::map<uint64_t, uint64_t> std_map;
+  chi_data_types::FlatIndexMap flat_map;
+  flat_map.Reserve(num_entries);
+  for (size_t i = 0; i < num_entries; ++i)
+  {
+    std_map.insert(std::make_pair(global_ids[i], i));
+    flat_map.Insert(global_ids[i], i);
+  }
+
+  //======================================== Check correctness
+  bool passed = flat_map.size() == std_map.size();
+  for (const auto& [key, value] : std_map)
+    if (flat_map.Find(key) != value) passed = false;
+
+  // Keys that were never inserted
+  if (flat_map.Find(0) != chi_data_types::FlatIndexMap::INVALID)
+    passed = false;
+  if (flat_map.Find(gid + 1) != chi_data_types::FlatIndexMap::INVALID)
+    passed = false;
+
+  // Existing keys must not be overwritten
+  if (flat_map.Insert(global_ids[0], 99) or flat_map.Find(global_ids[0]) != 0)
+    passed = false;
+
+  //======================================== Time lookups
+  chi::Timer timer;
+  uint64_t checksum_std = 0;
+  for (size_t l = 0; l < num_lookups; ++l)
+    for (uint64_t q : queries)
+      checksum_std += std_map.at(q);
+  const double time_std = timer.GetTime();
+
+  timer.Reset();
+  uint64_t checksum_flat = 0;
+  for (size_t l = 0; l < num_lookups; ++l)
+    for (uint64_t q : queries)
+      checksum_flat += flat_map.Find(q);
+  const double time_flat = timer.GetTime();
+
+  if (checksum_std != checksum_flat) passed = false;
+
+  Chi::log.Log() << "FlatIndexMap lookups: std::map " << time_std
+                 << " ms, FlatIndexMap " << time_flat << " ms, "
+                 << "memory " << flat_map.MemoryUsage() / 1024 << " kB";
+
+  if (passed) Chi::log.Log() << "FlatIndexMap test passed";
+  else Chi::log.Log() << "FlatIndexMap test failed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1 @@
+chi_unit_tests.chi_data_types_Test01_FlatIndexMap()
\ No newline at end of file
@@ -0,0 +1,51 @@
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+nodes={}
+N=10
+L=1.0
+for i=1,(N+1) do
+  nodes[i] = (i-1)*L/N
+end
+
+chiMeshCreateUnpartitioned3DOrthoMesh(nodes,nodes,nodes)
+chiVolumeMesherExecute();
+
+chiVolumeMesherSetMatIDToAll(1)
+
+exported_stats = chi_unit_tests.chi_mesh_Statistics_Test02()
+
+--############################################### Export and reload
+chiMeshHandlerExportMeshToBinary("BinaryMesh_ExportAndLoad")
+
+chiMeshHandlerCreate()
+chiVolumeMesherCreate(VOLUMEMESHER_BINARY, "BinaryMesh_ExportAndLoad")
+chiVolumeMesherExecute();
+
+--############################################### Check reloaded mesh
+chi_unit_tests.chi_mesh_Topology_Test00()
+
+loaded_stats = chi_unit_tests.chi_mesh_Statistics_Test02()
+
+passed = (exported_stats.num_cells == N*N*N)
+for key,value in pairs(exported_stats) do
+  if (key == "volume") then
+    passed = passed and (math.abs(loaded_stats[key] - value) < 1.0e-12)
+  else
+    passed = passed and (loaded_stats[key] == value)
+  end
+end
+for key,value in pairs(loaded_stats) do
+  passed = passed and (exported_stats[key] ~= nil)
+end
+
+if (passed) then
+  chiLog(LOG_0, "Binary mesh reload test passed")
+else
+  chiLog(LOG_0, "Binary mesh reload test failed")
+end
+
+chiMPIBarrier()
+if (chi_location_id == 0) then
+  os.execute("rm BinaryMesh_ExportAndLoad_*.cmsh")
+end
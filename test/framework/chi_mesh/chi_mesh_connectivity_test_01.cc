@@ -0,0 +1,219 @@
+#include "mesh/UnpartitionedMesh/chi_unpartitioned_mesh.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include <memory>
+#include <set>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_mesh_Connectivity_Test01(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_mesh_Connectivity_Test01,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_mesh_Connectivity_Test01);
+
+namespace
+{
+
+typedef chi_mesh::UnpartitionedMesh::LightWeightCell LWCell;
+
+/**Unpartitioned mesh exposing its boundary cells.*/
+class ConnectivityTestMesh : public chi_mesh::UnpartitionedMesh
+{
+public:
+  void AddBoundaryCell(LWCell* cell) { raw_boundary_cells_.push_back(cell); }
+  const std::vector<LWCell*>& GetBoundaryCells() const
+  {
+    return raw_boundary_cells_;
+  }
+};
+
+/**Builds an N x N quadrilateral mesh with a hole in the middle. The
+ * left, right and bottom sides have boundary cells, the top side and the
+ * hole have none. The first bottom edge has a second boundary cell with
+ * another boundary-id, the first one must be assigned.*/
+std::unique_ptr<ConnectivityTestMesh> BuildTestMesh(size_t N)
+{
+  auto mesh = std::make_unique<ConnectivityTestMesh>();
+
+  auto& vertices = mesh->GetVertices();
+  for (size_t j = 0; j <= N; ++j)
+    for (size_t i = 0; i <= N; ++i)
+      vertices.emplace_back(static_cast<double>(i), static_cast<double>(j), 0.0);
+
+  auto VID = [N](size_t i, size_t j) { return uint64_t(j * (N + 1) + i); };
+
+  for (size_t j = 0; j < N; ++j)
+    for (size_t i = 0; i < N; ++i)
+    {
+      if (i >= N / 3 and i < N / 2 and j >= N / 3 and j < N / 2) continue;
+
+      auto cell = new LWCell(chi_mesh::CellType::POLYGON,
+                             chi_mesh::CellType::QUADRILATERAL);
+      cell->material_id = 0;
+      cell->vertex_ids = {VID(i, j), VID(i + 1, j),
+                          VID(i + 1, j + 1), VID(i, j + 1)};
+
+      //Rotate the starting vertex so that neighboring faces are
+      //listed in different orders
+      const size_t rotation = (i + 2 * j) % 4;
+      for (size_t f = 0; f < 4; ++f)
+      {
+        const size_t v0 = (f + rotation) % 4;
+        const size_t v1 = (f + rotation + 1) % 4;
+        cell->faces.emplace_back(std::vector<uint64_t>{cell->vertex_ids[v0],
+                                                       cell->vertex_ids[v1]});
+      }
+      mesh->AddCell(cell);
+    }
+
+  auto AddBoundaryCell = [&mesh](uint64_t v0, uint64_t v1, int bndry_id)
+  {
+    auto cell = new LWCell(chi_mesh::CellType::SLAB, chi_mesh::CellType::SLAB);
+    cell->material_id = bndry_id;
+    cell->vertex_ids = {v0, v1};
+    mesh->AddBoundaryCell(cell);
+  };
+
+  for (size_t k = 0; k < N; ++k)
+  {
+    AddBoundaryCell(VID(0, k + 1), VID(0, k), 1); //left
+    AddBoundaryCell(VID(N, k), VID(N, k + 1), 2); //right
+    AddBoundaryCell(VID(k, 0), VID(k + 1, 0), 3); //bottom
+  }
+  AddBoundaryCell(VID(1, 0), VID(0, 0), 4);
+
+  return mesh;
+}
+
+/**The vertex-set comparison of every face against every other face that
+ * the hash-based connectivity replaced.*/
+void BuildReferenceConnectivity(const std::vector<LWCell*>& cells,
+                                const std::vector<LWCell*>& bndry_cells)
+{
+  const size_t num_cells = cells.size();
+  for (size_t c = 0; c < num_cells; ++c)
+    for (auto& face : cells[c]->faces)
+    {
+      if (face.has_neighbor) continue;
+      const std::set<uint64_t> fvids(face.vertex_ids.begin(),
+                                     face.vertex_ids.end());
+
+      for (size_t ac = 0; ac < num_cells and not face.has_neighbor; ++ac)
+      {
+        if (ac == c) continue;
+        for (auto& adj_face : cells[ac]->faces)
+        {
+          if (adj_face.has_neighbor) continue;
+          const std::set<uint64_t> afvids(adj_face.vertex_ids.begin(),
+                                          adj_face.vertex_ids.end());
+          if (fvids != afvids) continue;
+
+          face.neighbor = ac;
+          adj_face.neighbor = c;
+          face.has_neighbor = true;
+          adj_face.has_neighbor = true;
+          break;
+        }
+      }
+    }
+
+  for (auto& cell : cells)
+    for (auto& face : cell->faces)
+    {
+      if (face.has_neighbor) continue;
+      const std::set<uint64_t> fvids(face.vertex_ids.begin(),
+                                     face.vertex_ids.end());
+
+      for (const auto& bndry_cell : bndry_cells)
+      {
+        const std::set<uint64_t> bvids(bndry_cell->vertex_ids.begin(),
+                                       bndry_cell->vertex_ids.end());
+        if (fvids != bvids) continue;
+
+        face.neighbor = bndry_cell->material_id;
+        break;
+      }
+    }
+}
+
+/**Returns true if both meshes have the same neighbors and boundary-ids.*/
+bool SameConnectivity(const ConnectivityTestMesh& mesh_a,
+                      const ConnectivityTestMesh& mesh_b)
+{
+  const auto& cells_a = mesh_a.GetRawCells();
+  const auto& cells_b = mesh_b.GetRawCells();
+  if (cells_a.size() != cells_b.size()) return false;
+
+  for (size_t c = 0; c < cells_a.size(); ++c)
+  {
+    const auto& faces_a = cells_a[c]->faces;
+    const auto& faces_b = cells_b[c]->faces;
+    if (faces_a.size() != faces_b.size()) return false;
+
+    for (size_t f = 0; f < faces_a.size(); ++f)
+      if (faces_a[f].has_neighbor != faces_b[f].has_neighbor or
+          faces_a[f].neighbor != faces_b[f].neighbor)
+        return false;
+  }
+  return true;
+}
+
+}//namespace
+
+/**Checks that the hash-based face connectivity of an unpartitioned mesh
+ * gives the same neighbors and boundary-ids as the reference vertex-set
+ * comparison, with one thread and with the number of threads given by
+ * `--mesh_threads`.*/
+chi::ParameterBlock
+chi_mesh_Connectivity_Test01(const chi::InputParameters&)
+{
+  const size_t N = 24;
+  const size_t num_threads = Chi::run_time::num_mesh_threads_;
+
+  auto reference_mesh = BuildTestMesh(N);
+  BuildReferenceConnectivity(reference_mesh->GetRawCells(),
+                             reference_mesh->GetBoundaryCells());
+
+  Chi::run_time::num_mesh_threads_ = 1;
+  auto serial_mesh = BuildTestMesh(N);
+  serial_mesh->BuildMeshConnectivity();
+
+  Chi::run_time::num_mesh_threads_ = num_threads;
+  auto threaded_mesh = BuildTestMesh(N);
+  threaded_mesh->BuildMeshConnectivity();
+
+  //============================================= Sanity check of the
+  //                                              reference
+  size_t num_internal = 0, num_bndry = 0, num_bndry_4 = 0;
+  for (const auto& cell : reference_mesh->GetRawCells())
+    for (const auto& face : cell->faces)
+    {
+      if (face.has_neighbor) ++num_internal;
+      else if (face.neighbor != 0) ++num_bndry;
+      if (not face.has_neighbor and face.neighbor == 4) ++num_bndry_4;
+    }
+
+  bool passed = num_internal > 0 and num_bndry == 3 * N and num_bndry_4 == 0;
+  passed = passed and SameConnectivity(*reference_mesh, *serial_mesh);
+  passed = passed and SameConnectivity(*reference_mesh, *threaded_mesh);
+
+  Chi::log.Log() << "Connectivity with " << num_threads << " thread(s): "
+                 << num_internal << " internal faces, " << num_bndry
+                 << " boundary faces with boundary-ids.";
+
+  if (passed) Chi::log.Log() << "Connectivity test passed";
+  else Chi::log.Log() << "Connectivity test failed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
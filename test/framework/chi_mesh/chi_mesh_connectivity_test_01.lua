@@ -0,0 +1 @@
+chi_unit_tests.chi_mesh_Connectivity_Test01()
@@ -0,0 +1,99 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "math/SpatialDiscretization/CellMappings/cell_mapping_base.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include <algorithm>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_mesh_Statistics_Test02(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_mesh_Statistics_Test02,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_mesh_Statistics_Test02);
+
+/**Computes the global number of cells, the total volume and the number of
+ * boundary faces per boundary-id of the current grid. The values are
+ * logged and returned as a table with the keys `num_cells`, `volume` and
+ * `boundary_faces_<id>` so that two meshes can be compared in lua.*/
+chi::ParameterBlock
+chi_mesh_Statistics_Test02(const chi::InputParameters&)
+{
+  const auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+
+  //============================================= Local values
+  double local_volume = 0.0;
+  uint64_t local_max_bndry_id = 0;
+  std::vector<double> areas;
+  for (const auto& cell : grid.local_cells)
+  {
+    double cell_volume = 0.0;
+    chi_math::CellMapping::ComputeCellVolumeAndAreas(grid, cell,
+                                                     cell_volume, areas);
+    local_volume += cell_volume;
+
+    for (const auto& face : cell.faces_)
+      if (not face.has_neighbor_)
+        local_max_bndry_id = std::max(local_max_bndry_id, face.neighbor_id_);
+  }
+
+  uint64_t max_bndry_id = 0;
+  MPI_Allreduce(&local_max_bndry_id,   //sendbuf
+                &max_bndry_id,         //recvbuf
+                1, MPI_UINT64_T,       //count + datatype
+                MPI_MAX,               //operation
+                Chi::mpi.comm);        //communicator
+
+  std::vector<uint64_t> local_bndry_counts(max_bndry_id + 1, 0);
+  for (const auto& cell : grid.local_cells)
+    for (const auto& face : cell.faces_)
+      if (not face.has_neighbor_)
+        ++local_bndry_counts[face.neighbor_id_];
+
+  //============================================= Global values
+  double volume = 0.0;
+  MPI_Allreduce(&local_volume,         //sendbuf
+                &volume,               //recvbuf
+                1, MPI_DOUBLE,         //count + datatype
+                MPI_SUM,               //operation
+                Chi::mpi.comm);        //communicator
+
+  const int num_bndry_ids = static_cast<int>(max_bndry_id + 1);
+  std::vector<uint64_t> bndry_counts(num_bndry_ids, 0);
+  MPI_Allreduce(local_bndry_counts.data(), //sendbuf
+                bndry_counts.data(),       //recvbuf
+                num_bndry_ids,             //count
+                MPI_UINT64_T,              //datatype
+                MPI_SUM,                   //operation
+                Chi::mpi.comm);            //communicator
+
+  const size_t num_cells = grid.GetGlobalNumberOfCells();
+
+  //============================================= Report
+  chi::ParameterBlock stats;
+  stats.AddParameter("num_cells", static_cast<int64_t>(num_cells));
+  stats.AddParameter("volume", volume);
+
+  Chi::log.Log() << "Mesh statistics: num_cells= " << num_cells;
+  Chi::log.Log() << "Mesh statistics: volume= " << volume;
+  for (int b = 0; b < num_bndry_ids; ++b)
+  {
+    if (bndry_counts[b] == 0) continue;
+    const std::string key = "boundary_faces_" + std::to_string(b);
+    stats.AddParameter(key, static_cast<int64_t>(bndry_counts[b]));
+    Chi::log.Log() << "Mesh statistics: " << key << "= " << bndry_counts[b];
+  }
+
+  return stats;
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,115 @@
+#include "mesh/MeshHandler/chi_meshhandler.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum.h"
+#include "mesh/MeshContinuum/chi_meshcontinuum_topology.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include "console/chi_console.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_mesh_Topology_Test00(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_mesh_Topology_Test00,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_mesh_Topology_Test00);
+
+/**Checks the CellView/FaceView API of chi_mesh::MeshTopology against
+ * the chi_mesh::Cell objects of the current grid and reports the memory
+ * used by both representations.*/
+chi::ParameterBlock
+chi_mesh_Topology_Test00(const chi::InputParameters&)
+{
+  const auto& grid = *chi_mesh::GetCurrentHandler().GetGrid();
+  const auto& topology = grid.GetTopology();
+
+  bool passed = topology.NumLocalCells() == grid.local_cells.size();
+  passed = passed and topology.NumCells() ==
+                      grid.local_cells.size() + grid.cells.GetNumGhosts();
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const auto cell_view = topology.Cell(cell.local_id_);
+
+    passed = passed and cell_view.IsLocal();
+    passed = passed and cell_view.GlobalID() == cell.global_id_;
+    passed = passed and cell_view.PartitionID() == cell.partition_id_;
+    passed = passed and cell_view.MaterialID() == cell.material_id_;
+    passed = passed and cell_view.Type() == cell.Type();
+    passed = passed and cell_view.SubType() == cell.SubType();
+    passed = passed and
+             (cell_view.Centroid() - cell.centroid_).NormSquare() == 0.0;
+
+    const auto vids = cell_view.VertexIDs();
+    passed = passed and std::equal(vids.begin(), vids.end(),
+                                   cell.vertex_ids_.begin(),
+                                   cell.vertex_ids_.end());
+
+    passed = passed and cell_view.NumFaces() == cell.faces_.size();
+    if (not passed) break;
+
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      const auto face_view = cell_view.Face(f);
+
+      const auto fvids = face_view.VertexIDs();
+      passed = passed and std::equal(fvids.begin(), fvids.end(),
+                                     face.vertex_ids_.begin(),
+                                     face.vertex_ids_.end());
+      passed = passed and face_view.HasNeighbor() == face.has_neighbor_;
+      passed = passed and face_view.NeighborID() == face.neighbor_id_;
+      passed = passed and
+               std::fabs(face_view.Area() - face.ComputeFaceArea(grid)) < 1e-12;
+
+      if (face.has_neighbor_)
+      {
+        passed = passed and face_view.IsNeighborStored();
+        passed = passed and
+                 face_view.IsNeighborLocal() == face.IsNeighborLocal(grid);
+        passed = passed and
+                 face_view.NeighborPartitionID() ==
+                 static_cast<uint64_t>(face.GetNeighborPartitionID(grid));
+        passed = passed and
+                 face_view.NeighborAssociatedFace() ==
+                 face.GetNeighborAssociatedFace(grid);
+        if (face_view.IsNeighborLocal())
+          passed = passed and
+                   face_view.NeighborIndex() ==
+                   static_cast<uint64_t>(face.GetNeighborLocalID(grid));
+      }
+    }//for face
+    if (not passed) break;
+  }//for cell
+
+  Chi::log.LogAll() << "MeshTopology memory: "
+                    << topology.MemoryUsage() / 1024 << " kB, "
+                    << "Cell objects: "
+                    << chi_mesh::MeshTopology::EstimateCellObjectMemory(grid) /
+                       1024 << " kB";
+
+  grid.InvalidateTopology();
+
+  int local_passed = passed ? 1 : 0;
+  int global_passed = 0;
+  MPI_Allreduce(&local_passed,  //sendbuf
+                &global_passed, //recvbuf
+                1, MPI_INT,     //count + datatype
+                MPI_MIN,        //operation
+                Chi::mpi.comm); //comm
+
+  if (global_passed == 1) Chi::log.Log() << "MeshTopology test passed";
+  else Chi::log.Log() << "MeshTopology test failed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
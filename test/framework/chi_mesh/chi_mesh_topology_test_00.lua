@@ -0,0 +1,16 @@
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+nodes={}
+N=12
+L=1.0
+for i=1,(N+1) do
+  nodes[i] = (i-1)*L/N
+end
+
+chiMeshCreateUnpartitioned3DOrthoMesh(nodes,nodes,nodes)
+chiVolumeMesherExecute();
+
+chiVolumeMesherSetMatIDToAll(0)
+
+chi_unit_tests.chi_mesh_Topology_Test00()
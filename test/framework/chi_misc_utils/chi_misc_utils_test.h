@@ -0,0 +1,40 @@
+#ifndef CHITECH_CHI_MISC_UTILS_TEST_H
+#define CHITECH_CHI_MISC_UTILS_TEST_H
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+#include "chi_mpi.h"
+
+#include <string>
+
+namespace chi_unit_tests
+{
+
+/**Logs the result of a work loop from every location, so that the loop
+ * cannot be optimized away.*/
+inline void LogChecksum(double sum)
+{
+  Chi::log.LogAll() << "Checksum " << sum;
+}
+
+/**Combines the local results of a test over all locations and logs
+ * "<test_name> test passed" or "<test_name> test failed". Collective.*/
+inline bool LogCollectiveTestResult(const std::string& test_name, bool passed)
+{
+  int local_passed = passed ? 1 : 0;
+  int all_passed = 0;
+  MPI_Allreduce(&local_passed,  //sendbuf
+                &all_passed,    //recvbuf
+                1, MPI_INT,     //count + datatype
+                MPI_LAND,       //operation
+                Chi::mpi.comm); //communicator
+
+  if (all_passed) Chi::log.Log() << test_name << " test passed";
+  else Chi::log.Log() << test_name << " test failed";
+
+  return all_passed != 0;
+}
+
+} // namespace chi_unit_tests
+
+#endif // CHITECH_CHI_MISC_UTILS_TEST_H
@@ -0,0 +1,136 @@
+#include "utils/chi_compression.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_misc_utils_Test01_Compression(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_misc_utils_Test01_Compression,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_misc_utils_Test01_Compression);
+
+/**Round-trips a smooth, flux-like field through every compression type
+ * and checks the reproduced values against the compression guarantees.*/
+chi::ParameterBlock
+chi_misc_utils_Test01_Compression(const chi::InputParameters&)
+{
+  const size_t N = 100000;
+  const double tolerance = 1.0e-6;
+
+  std::vector<double> field(N);
+  for (size_t i = 0; i < N; ++i)
+    field[i] = std::exp(-1.0e-4 * double(i)) *
+               (1.0 + 0.1 * std::sin(1.0e-2 * double(i)));
+
+  bool passed = true;
+
+  //======================================== Lossless and lossy round-trips
+  using chi::CompressionType;
+  for (const auto type : {CompressionType::NONE,
+                          CompressionType::SHUFFLE_LZ,
+                          CompressionType::LOSSY})
+  {
+    const auto data = chi::CompressDoubles(field.data(), N, type, tolerance);
+
+    std::vector<double> values(N);
+    chi::DecompressDoubles(data.data(), data.size(), type, tolerance,
+                           values.data(), N);
+
+    double max_error = 0.0;
+    for (size_t i = 0; i < N; ++i)
+      max_error = std::max(max_error, std::fabs(values[i] - field[i]));
+
+    const double allowed = type == CompressionType::LOSSY ? tolerance : 0.0;
+    if (max_error > allowed) passed = false;
+
+    Chi::log.Log() << "Compression type " << static_cast<uint64_t>(type)
+                   << ": ratio "
+                   << double(8 * N) / double(data.size())
+                   << ", max error " << max_error;
+  }
+
+  //======================================== Lossy falls back to lossless
+  //                                         for non-finite values
+  std::vector<double> special = {1.0, std::numeric_limits<double>::infinity(),
+                                 std::numeric_limits<double>::quiet_NaN(),
+                                 -2.5};
+  const auto data = chi::CompressDoubles(special.data(), special.size(),
+                                         CompressionType::LOSSY, tolerance);
+  std::vector<double> values(special.size());
+  chi::DecompressDoubles(data.data(), data.size(), CompressionType::LOSSY,
+                         tolerance, values.data(), values.size());
+  if (values[0] != 1.0 or not std::isinf(values[1]) or
+      not std::isnan(values[2]) or values[3] != -2.5)
+    passed = false;
+
+  //======================================== Lossy honors tolerances near
+  //                                         machine precision
+  const double eps = std::numeric_limits<double>::epsilon();
+  for (const double tiny_tolerance : {eps, 0.3 * eps, 1.0e-300})
+  {
+    std::vector<double> near_one(1000);
+    for (size_t i = 0; i < near_one.size(); ++i)
+      near_one[i] = 1.0 + 0.37 * eps * double(i);
+
+    const auto tiny_data = chi::CompressDoubles(near_one.data(),
+                                                near_one.size(),
+                                                CompressionType::LOSSY,
+                                                tiny_tolerance);
+    std::vector<double> tiny_values(near_one.size());
+    chi::DecompressDoubles(tiny_data.data(), tiny_data.size(),
+                           CompressionType::LOSSY, tiny_tolerance,
+                           tiny_values.data(), tiny_values.size());
+
+    double max_error = 0.0;
+    for (size_t i = 0; i < near_one.size(); ++i)
+      max_error = std::max(max_error,
+                           std::fabs(tiny_values[i] - near_one[i]));
+    if (max_error > tiny_tolerance) passed = false;
+
+    Chi::log.Log() << "Lossy tolerance " << tiny_tolerance
+                   << ": max error " << max_error;
+  }
+
+  //======================================== Corrupt streams are detected
+  auto lz = chi::CompressDoubles(field.data(), N, CompressionType::SHUFFLE_LZ);
+  lz.resize(lz.size() / 2);
+  try
+  {
+    chi::DecompressDoubles(lz.data(), lz.size(), CompressionType::SHUFFLE_LZ,
+                           0.0, field.data(), N);
+    passed = false;
+  }
+  catch (const std::runtime_error&) {}
+
+  //Corrupt varint size of a quantized stream, which must be rejected
+  //before it is used to allocate
+  auto lossy = chi::CompressDoubles(field.data(), N, CompressionType::LOSSY,
+                                    tolerance);
+  const uint64_t huge_size = uint64_t(1) << 62;
+  std::memcpy(lossy.data() + 1, &huge_size, sizeof(huge_size));
+  try
+  {
+    chi::DecompressDoubles(lossy.data(), lossy.size(), CompressionType::LOSSY,
+                           tolerance, field.data(), N);
+    passed = false;
+  }
+  catch (const std::runtime_error&) {}
+
+  if (passed) Chi::log.Log() << "Compression test passed";
+  else Chi::log.Log() << "Compression test failed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,81 @@
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+#include <sstream>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_misc_utils_Test02_EventLog(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_misc_utils_Test02_EventLog,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_misc_utils_Test02_EventLog);
+
+/**Logs many repeating events and checks the aggregated statistics and that
+ * the retained event history stays bounded.*/
+chi::ParameterBlock
+chi_misc_utils_Test02_EventLog(const chi::InputParameters&)
+{
+  typedef chi::ChiLog::EventType EvType;
+  typedef chi::ChiLog::EventOperation EvOp;
+
+  const size_t N = 100000;
+  const size_t capacity = 16;
+
+  const size_t tag = Chi::log.GetRepeatingEventTag("Event Log Test");
+  Chi::log.SetEventHistoryCapacity(tag, capacity);
+
+  for (size_t i = 0; i < N; ++i)
+  {
+    Chi::log.LogEvent(tag, EvType::EVENT_BEGIN);
+    Chi::log.LogEvent(
+      tag, EvType::SINGLE_OCCURRENCE,
+      std::make_shared<chi::ChiLog::EventInfo>(static_cast<double>(i % 10)));
+    Chi::log.LogEvent(tag, EvType::EVENT_END);
+  }
+
+  bool passed = true;
+
+  //======================================== Aggregates
+  const double num_occ = Chi::log.ProcessEvent(tag, EvOp::NUMBER_OF_OCCURRENCES);
+  const double max_val = Chi::log.ProcessEvent(tag, EvOp::MAX_VALUE);
+  const double min_val = Chi::log.ProcessEvent(tag, EvOp::MIN_VALUE);
+  const double avg_val = Chi::log.ProcessEvent(tag, EvOp::AVERAGE_VALUE);
+  const double min_dur = Chi::log.ProcessEvent(tag, EvOp::MIN_DURATION);
+  const double avg_dur = Chi::log.ProcessEvent(tag, EvOp::AVERAGE_DURATION);
+  const double max_dur = Chi::log.ProcessEvent(tag, EvOp::MAX_DURATION);
+
+  // Creation, plus a begin and a single occurrence per iteration
+  if (num_occ != static_cast<double>(2 * N + 1)) passed = false;
+  if (max_val != 9.0 or min_val != 0.0) passed = false;
+  if (std::fabs(avg_val - 4.5) > 1.0e-12) passed = false;
+  if (not (min_dur >= 0.0 and min_dur <= avg_dur and avg_dur <= max_dur))
+    passed = false;
+
+  //======================================== Bounded history
+  std::stringstream history(Chi::log.PrintEventHistory(tag));
+  size_t num_lines = 0;
+  for (std::string line; std::getline(history, line);)
+    ++num_lines;
+  if (num_lines != capacity) passed = false;
+
+  Chi::log.SetEventHistoryCapacity(tag, 0);
+  if (not Chi::log.PrintEventHistory(tag).empty()) passed = false;
+
+  Chi::log.Log() << "Occurrences " << num_occ << ", values [" << min_val
+                 << ", " << max_val << "] average " << avg_val
+                 << ", history lines " << num_lines;
+
+  if (passed) Chi::log.Log() << "Event log test passed";
+  else Chi::log.Log() << "Event log test failed";
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,98 @@
+#include "utils/chi_perf_region.h"
+
+#include "chi_misc_utils_test.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_misc_utils_Test03_PerfRegions(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_misc_utils_Test03_PerfRegions,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_misc_utils_Test03_PerfRegions);
+
+/**Times nested performance regions, of which one is only entered on
+ * location 0, and checks the local region data and the cross-location
+ * report.*/
+chi::ParameterBlock
+chi_misc_utils_Test03_PerfRegions(const chi::InputParameters&)
+{
+  auto& registry = chi::PerfRegistry::GetInstance();
+
+  double sum = 0.0;
+  {
+    chi::PerfRegion outer("PerfTest");
+    for (int i = 0; i < 10; ++i)
+    {
+      chi::PerfRegion inner("Inner");
+      for (int j = 0; j < 10000; ++j)
+        sum += std::sqrt(static_cast<double>(i * j));
+
+      if (Chi::mpi.location_id == 0 and i % 2 == 0)
+      {
+        chi::PerfRegion leaf("Leaf");
+        sum += 1.0;
+      }
+    }
+  }
+
+  bool passed = true;
+
+  //======================================== Local region data
+  const auto* outer = registry.FindRegion("PerfTest");
+  const auto* inner = registry.FindRegion("PerfTest/Inner");
+  if (outer == nullptr or inner == nullptr) passed = false;
+  else
+  {
+    if (outer->num_calls != 1 or inner->num_calls != 10) passed = false;
+    if (inner->depth != 1) passed = false;
+    if (outer->total_time < inner->total_time) passed = false;
+  }
+
+  //======================================== Report across locations
+  const std::string json_file_name = "chi_misc_utils_test_03.json";
+  const std::string report = registry.BuildReport(json_file_name);
+
+  if (Chi::mpi.location_id == 0)
+  {
+    const size_t outer_pos = report.find("PerfTest");
+    const size_t inner_pos = report.find("Inner");
+    const size_t leaf_pos = report.find("Leaf");
+    if (outer_pos == std::string::npos or inner_pos == std::string::npos or
+        leaf_pos == std::string::npos)
+      passed = false;
+    else if (not (outer_pos < inner_pos and inner_pos < leaf_pos))
+      passed = false;
+
+    std::ifstream json_file(json_file_name);
+    std::stringstream json;
+    json << json_file.rdbuf();
+    if (json.str().find("\"path\": \"PerfTest/Inner/Leaf\"") ==
+        std::string::npos)
+      passed = false;
+    json_file.close();
+    std::remove(json_file_name.c_str());
+
+    Chi::log.Log() << report;
+  }
+
+  LogChecksum(sum);
+
+  LogCollectiveTestResult("Performance region", passed);
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
@@ -0,0 +1,3 @@
+chi_unit_tests.chi_misc_utils_Test03_PerfRegions()
+
+chiPerfRegionsReport()
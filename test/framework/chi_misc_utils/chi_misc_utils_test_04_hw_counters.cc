@@ -0,0 +1,75 @@
+#include "utils/chi_hw_counters.h"
+#include "utils/chi_perf_region.h"
+
+#include "chi_misc_utils_test.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <cmath>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_misc_utils_Test04_HWCounters(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_misc_utils_Test04_HWCounters,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_misc_utils_Test04_HWCounters);
+
+/**Enables the hardware counters and times a region with them. Counters are
+ * frequently unavailable (containers, virtual machines), in which case the
+ * test checks that everything degrades to zero counts instead. Counters
+ * that were already enabled, e.g. with `--hw_counters`, are left as they
+ * were.*/
+chi::ParameterBlock
+chi_misc_utils_Test04_HWCounters(const chi::InputParameters&)
+{
+  auto& counters = chi::HardwareCounters::GetInstance();
+  typedef chi::HardwareCounters HWC;
+
+  const bool was_enabled = counters.IsEnabled();
+  const bool available = was_enabled or counters.Enable();
+  Chi::log.LogAll() << "Hardware counters available: "
+                    << (available ? "yes" : "no");
+
+  bool passed = available == counters.IsEnabled();
+
+  double sum = 0.0;
+  {
+    chi::PerfRegion perf_region("HWCounterTest");
+    for (int i = 0; i < 1000000; ++i)
+      sum += std::sqrt(static_cast<double>(i));
+  }
+
+  const auto* region =
+    chi::PerfRegistry::GetInstance().FindRegion("HWCounterTest");
+  if (region == nullptr) passed = false;
+  else if (available)
+  {
+    if (region->counter_totals[HWC::CYCLES] == 0) passed = false;
+    if (counters.IsAvailable(HWC::INSTRUCTIONS) and
+        region->counter_totals[HWC::INSTRUCTIONS] < 1000000)
+      passed = false;
+  }
+  else
+  {
+    for (const auto value : region->counter_totals)
+      if (value != 0) passed = false;
+  }
+
+  chi::PerfRegistry::GetInstance().PrintReport();
+  if (not was_enabled) counters.Disable();
+
+  LogChecksum(sum);
+
+  LogCollectiveTestResult("Hardware counter", passed);
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
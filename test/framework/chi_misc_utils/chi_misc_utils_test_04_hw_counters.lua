@@ -0,0 +1 @@
+chi_unit_tests.chi_misc_utils_Test04_HWCounters()
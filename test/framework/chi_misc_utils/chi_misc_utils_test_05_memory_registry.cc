@@ -0,0 +1,88 @@
+#include "utils/chi_memory_registry.h"
+
+#include "chi_misc_utils_test.h"
+
+#include "chi_runtime.h"
+#include "chi_log.h"
+
+#include "console/chi_console.h"
+
+#include <sstream>
+
+namespace chi_unit_tests
+{
+
+chi::ParameterBlock
+chi_misc_utils_Test05_MemoryRegistry(const chi::InputParameters& params);
+
+RegisterWrapperFunction(/*namespace_name=*/chi_unit_tests,
+                        /*name_in_lua=*/chi_misc_utils_Test05_MemoryRegistry,
+                        /*syntax_function=*/nullptr,
+                        /*actual_function=*/chi_misc_utils_Test05_MemoryRegistry);
+
+/**Registers memory from two owners, of which one only registers on
+ * location 0, and checks the local totals and the cross-location report.*/
+chi::ParameterBlock
+chi_misc_utils_Test05_MemoryRegistry(const chi::InputParameters&)
+{
+  auto& registry = chi::MemoryRegistry::GetInstance();
+  const size_t MB = 1024 * 1024;
+  const int owner_a = 0;
+  const int owner_b = 0;
+
+  bool passed = true;
+
+  //======================================== Local totals
+  const size_t location_mb = static_cast<size_t>(Chi::mpi.location_id) + 1;
+  registry.Set("TestCategoryA", &owner_a, 10 * MB);
+  registry.Set("TestCategoryA", &owner_a, location_mb * MB); //replaces
+  registry.Set("TestCategoryA", &owner_b, MB);
+  if (Chi::mpi.location_id == 0)
+    registry.Set("TestCategoryB", &owner_b, 2 * MB);
+
+  if (registry.CategoryTotal("TestCategoryA") != (location_mb + 1) * MB)
+    passed = false;
+
+  registry.Remove("TestCategoryA", &owner_b);
+  if (registry.CategoryTotal("TestCategoryA") != location_mb * MB)
+    passed = false;
+
+  //======================================== Report across locations
+  // TestCategoryA holds 1 MB on location 0 and 2 MB on location 1
+  const std::string report = registry.BuildReport(/*per_location=*/true);
+
+  if (Chi::mpi.location_id == 0)
+  {
+    bool found_a = false, found_b = false;
+    std::istringstream lines(report);
+    std::string line;
+    while (std::getline(lines, line))
+    {
+      if (line.find("TestCategoryA") == 0)
+        found_a = line.find("1.000") != std::string::npos and
+                  line.find("1.500") != std::string::npos and
+                  line.find("2.000") != std::string::npos and
+                  line.find("3.000") != std::string::npos;
+      if (line.find("TestCategoryB") == 0)
+        found_b = line.find("0.000") != std::string::npos and
+                  line.find("2.000") != std::string::npos;
+    }
+    if (not (found_a and found_b)) passed = false;
+    if (report.find("Location 1:") == std::string::npos) passed = false;
+
+    Chi::log.Log() << report;
+  }
+
+  //======================================== Cleanup
+  registry.RemoveOwner(&owner_a);
+  registry.RemoveOwner(&owner_b);
+  if (registry.CategoryTotal("TestCategoryA") != 0 or
+      registry.CategoryTotal("TestCategoryB") != 0)
+    passed = false;
+
+  LogCollectiveTestResult("Memory registry", passed);
+
+  return chi::ParameterBlock();
+}
+
+} // namespace chi_unit_tests
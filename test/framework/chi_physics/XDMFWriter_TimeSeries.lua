@@ -0,0 +1,73 @@
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+nodes={}
+N=8
+L=1.0
+for i=1,(N+1) do
+  nodes[i] = (i-1)*L/N
+end
+
+chiMeshCreateUnpartitioned2DOrthoMesh(nodes,nodes)
+chiVolumeMesherExecute();
+
+chiVolumeMesherSetMatIDToAll(0)
+
+--############################################### Field functions
+ff_pwld = chi_physics.FieldFunctionGridBased.Create({ name = "T_pwld",
+                                                     sdm_type = "PWLD",
+                                                     initial_value = 1.0 })
+ff_fv = chi_physics.FieldFunctionGridBased.Create({ name = "T_fv",
+                                                   sdm_type = "FiniteVolume",
+                                                   initial_value = 2.0 })
+
+--############################################### Write time series
+writer = chi_physics.FieldFunctionXDMFWriter.Create
+({
+  file_base_name = "XDMFWriter_TimeSeries",
+  field_function_handles = { ff_pwld, ff_fv }
+})
+
+chiXDMFWriterWriteTimeStep(writer, 0.0)
+chiXDMFWriterWriteTimeStep(writer, 0.5)
+
+--############################################### Read back the arrays
+-- Every field array referenced by the XDMF file is read from the binary
+-- file at its Seek offset and compared to the field's initial value
+chiMPIBarrier()
+if (chi_location_id == 0) then
+  xdmf_file = io.open("XDMFWriter_TimeSeries.xdmf", "r")
+  xdmf = xdmf_file:read("a")
+  xdmf_file:close()
+
+  bin_file = io.open("XDMFWriter_TimeSeries.bin", "rb")
+
+  expected_values = { T_pwld = 1.0, T_fv = 2.0 }
+  num_arrays_checked = 0
+  passed = true
+  pattern = '<Attribute Name="([%w_]+)"[^>]*>%s*<DataItem Dimensions="(%d+)"'..
+            '[^>]*Endian="(%a+)" Seek="(%d+)"'
+  for name, dimensions, endian, seek in string.gmatch(xdmf, pattern) do
+    expected = expected_values[name]
+    if (expected ~= nil) then
+      format = (endian == "Little" and "<" or ">").."d"
+      bin_file:seek("set", tonumber(seek))
+      for i=1,tonumber(dimensions) do
+        value = string.unpack(format, bin_file:read(8))
+        passed = passed and (math.abs(value - expected) < 1.0e-12)
+      end
+      num_arrays_checked = num_arrays_checked + 1
+    end
+  end
+  bin_file:close()
+
+  -- 2 time steps, 2 field functions, node and cell arrays
+  passed = passed and (num_arrays_checked == 8)
+  if (passed) then
+    chiLog(LOG_0, "XDMF read-back test passed")
+  else
+    chiLog(LOG_0, "XDMF read-back test failed")
+  end
+
+  os.execute("rm XDMFWriter_TimeSeries.bin XDMFWriter_TimeSeries.xdmf")
+end
@@ -0,0 +1,56 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration with pCMFD
+-- Test: Final k-eigenvalue: 0.5969127
+-- Plain power iteration (KEigenvalueTransport2D_1a_QBlock.lua) converges in
+-- 21 iterations. The iteration limit below is half of that, so the test only
+-- reports CONVERGED if the acceleration works.
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      groupset_num_subsets = 2,
+    }
+  },
+  options =
+  {
+    boundary_conditions = { { name = "xmin", type = "reflecting"},
+                            { name = "ymin", type = "reflecting"} },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  }
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.XXPowerIterationKEigenCMFD.Create
+({
+  lbs_solver_handle = phys1,
+  cmfd_type = "pcmfd",
+  coarse_divisions = { 8, 8, 1 },
+  max_iters = 10,
+})
+chiSolverInitialize(k_solver0)
+chiSolverExecute(k_solver0)
+
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+-- Reference value k_eff = 0.5969127
@@ -0,0 +1,66 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration with LGMRES and DGMRES
+-- inners. The problem is solved with restarted GMRES, LGMRES and DGMRES
+-- using a restart interval well below the maximum number of iterations.
+-- Augmenting and deflating the restarted Krylov space must both take fewer
+-- sweeps than plain GMRES.
+-- Test: Final k-eigenvalue: 0.5969127
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+function SolveWithMethod(method)
+  lbs_block =
+  {
+    num_groups = num_groups,
+    groupsets =
+    {
+      {
+        groups_from_to = {0, num_groups-1},
+        angular_quadrature_handle = pquad,
+        inner_linear_method = method,
+        l_max_its = 50,
+        gmres_restart_interval = 10,
+        krylov_recycle_size = 4,
+        l_abs_tol = 1.0e-10,
+        groupset_num_subsets = 2,
+      }
+    },
+    options =
+    {
+      boundary_conditions = { { name = "xmin", type = "reflecting"},
+                              { name = "ymin", type = "reflecting"} },
+      scattering_order = 2,
+
+      use_precursors = false,
+
+      verbose_inner_iterations = false,
+      verbose_outer_iterations = true,
+    }
+  }
+
+  phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+  k_solver = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys, })
+  chiSolverInitialize(k_solver)
+  chiSolverExecute(k_solver)
+
+  num_sweeps = chiLBSGetSweepCount(phys)
+  chiLog(LOG_0, "Sweeps with "..method..": "..tostring(num_sweeps))
+  return num_sweeps
+end
+
+gmres_sweeps = SolveWithMethod("gmres")
+lgmres_sweeps = SolveWithMethod("lgmres")
+dgmres_sweeps = SolveWithMethod("dgmres")
+
+if (lgmres_sweeps < gmres_sweeps and dgmres_sweeps < gmres_sweeps) then
+  chiLog(LOG_0, "Recycled Krylov sweep reduction passed")
+else
+  chiLog(LOG_0, "Recycled Krylov sweep reduction failed")
+end
+
+-- Reference value k_eff = 0.5969127
@@ -0,0 +1,75 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration with adaptive inner
+-- tolerances. The problem is solved again with the fixed inner tolerance,
+-- which must take more sweeps. The adaptive solve runs first so that its
+-- k-eigenvalue is the one checked.
+-- Test: Final k-eigenvalue: 0.5969127
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      groupset_num_subsets = 2,
+    }
+  },
+  options =
+  {
+    boundary_conditions = { { name = "xmin", type = "reflecting"},
+                            { name = "ymin", type = "reflecting"} },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  }
+}
+
+--############################################### Adaptive inner tolerances
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.XXPowerIterationKEigen.Create
+({
+  lbs_solver_handle = phys1,
+  adaptive_inner_tol = true,
+  inner_tol_max = 1.0e-2,
+})
+chiSolverInitialize(k_solver0)
+chiSolverExecute(k_solver0)
+
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+--############################################### Fixed inner tolerance
+phys2 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver1 = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys2, })
+chiSolverInitialize(k_solver1)
+chiSolverExecute(k_solver1)
+
+--############################################### Compare sweeps
+adaptive_sweeps = chiLBSGetSweepCount(phys1)
+fixed_sweeps = chiLBSGetSweepCount(phys2)
+chiLog(LOG_0, "Sweeps with adaptive inner tolerances: "..tostring(adaptive_sweeps))
+chiLog(LOG_0, "Sweeps with fixed inner tolerance: "..tostring(fixed_sweeps))
+
+if (adaptive_sweeps < fixed_sweeps) then
+  chiLog(LOG_0, "Adaptive inner tolerance sweep reduction passed")
+else
+  chiLog(LOG_0, "Adaptive inner tolerance sweep reduction failed")
+end
+
+-- Reference value k_eff = 0.5969127
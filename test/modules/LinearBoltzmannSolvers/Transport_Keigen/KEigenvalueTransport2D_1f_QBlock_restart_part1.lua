@@ -0,0 +1,51 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration, writing restart data
+-- every outer iteration in the background and at the end
+-- Test: Final k-eigenvalue: 0.5969127
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      groupset_num_subsets = 2,
+    }
+  },
+  options =
+  {
+    boundary_conditions = { { name = "xmin", type = "reflecting"},
+                            { name = "ymin", type = "reflecting"} },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    write_restart_data = true,
+    write_restart_folder_name = "YRestart_QBlock",
+    write_restart_file_base = "keigen",
+    write_restart_interval = 0.0,
+    write_restart_async = true,
+    output_compression = "shuffle_lz",
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  }
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys1, })
+chiSolverInitialize(k_solver0)
+chiSolverExecute(k_solver0)
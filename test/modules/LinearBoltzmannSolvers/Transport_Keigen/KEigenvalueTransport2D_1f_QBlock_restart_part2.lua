@@ -0,0 +1,50 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration, restarted from the
+-- data written by part1 on a different number of processes. Starting from
+-- the converged flux the power iterations must converge in a few outer
+-- iterations instead of the many of part1's cold start.
+-- Test: Final k-eigenvalue: 0.5969127, Outer iterations <= 3
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      groupset_num_subsets = 2,
+    }
+  },
+  options =
+  {
+    boundary_conditions = { { name = "xmin", type = "reflecting"},
+                            { name = "ymin", type = "reflecting"} },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    read_restart_data = true,
+    read_restart_folder_name = "YRestart_QBlock",
+    read_restart_file_base = "keigen",
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  }
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys1, })
+chiSolverInitialize(k_solver0)
+chiSolverExecute(k_solver0)
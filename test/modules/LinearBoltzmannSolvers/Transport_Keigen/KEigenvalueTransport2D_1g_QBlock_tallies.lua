@@ -0,0 +1,79 @@
+-- 2D 2G KEigenvalue::Solver test using Power Iteration with in-situ tallies
+-- Test: Final k-eigenvalue: 0.5969127
+
+dofile("utils/QBlock_mesh.lua")
+dofile("utils/QBlock_materials.lua") --num_groups assigned here
+
+--############################################### Setup Physics
+pquad = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 4)
+chiOptimizeAngularQuadratureForPolarSymmetry(pqaud, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad,
+      inner_linear_method = "gmres",
+      l_max_its = 50,
+      gmres_restart_interval = 50,
+      l_abs_tol = 1.0e-10,
+      groupset_num_subsets = 2,
+    }
+  },
+  options =
+  {
+    boundary_conditions = { { name = "xmin", type = "reflecting"},
+                            { name = "ymin", type = "reflecting"} },
+    scattering_order = 2,
+
+    use_precursors = false,
+
+    tallies =
+    {
+      { name = "fission_total", reaction = "fission" },
+      { name = "fission_fuel", reaction = "fission", logical_volume = vol1 },
+      { name = "flux_total", reaction = "flux" },
+      { name = "flux_bins", reaction = "flux", group_bins = {0, 1} },
+    },
+    tally_output_file = "KEigenvalueTransport2D_1g_QBlock_tallies.txt",
+
+    verbose_inner_iterations = false,
+    verbose_outer_iterations = true,
+  }
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+
+k_solver0 = lbs.XXPowerIterationKEigen.Create({ lbs_solver_handle = phys1, })
+chiSolverInitialize(k_solver0)
+chiSolverExecute(k_solver0)
+
+--############################################### Check tallies
+fission_rate = chiLBSComputeFissionRate(phys1, "OLD")
+fission_total = chiLBSGetTallyValues(phys1, "fission_total")
+fission_fuel = chiLBSGetTallyValues(phys1, "fission_fuel")
+flux_total = chiLBSGetTallyValues(phys1, "flux_total")
+flux_bins = chiLBSGetTallyValues(phys1, "flux_bins")
+
+function RelDiff(a, b)
+  return math.abs(a - b) / math.abs(b)
+end
+
+passed = RelDiff(fission_total[1], fission_rate) < 1.0e-10 and
+         RelDiff(fission_fuel[1], fission_rate) < 1.0e-10 and
+         RelDiff(flux_bins[1] + flux_bins[2], flux_total[1]) < 1.0e-10
+
+chiLog(LOG_0, string.format("Fuel fission rate tally %.6e", fission_fuel[1]))
+if (passed) then
+  chiLog(LOG_0, "Tally checks passed")
+else
+  chiLog(LOG_0, "Tally checks failed")
+end
+
+chiMPIBarrier()
+if (chi_location_id == 0) then
+  os.execute("rm KEigenvalueTransport2D_1g_QBlock_tallies.txt")
+end
@@ -0,0 +1,158 @@
+-- 1D Transport test with two groupsets solved with block-Jacobi in energy.
+-- The problem is that of Transport1D_1. It is solved with Gauss-Seidel and
+-- with block-Jacobi across-groupset iterations and the two solutions must
+-- agree. Run with --energy_comms=2 on twice the processes to solve the
+-- groupsets concurrently on two energy communicators, in which case both
+-- solves use block-Jacobi and the gold values are those of Gauss-Seidel.
+-- SDM: PWLD
+-- Test: Max-value=0.49903 and 7.18243e-4
+num_procs = 2
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+mesh={}
+N=100
+L=30.0
+xmin = 0.0
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  mesh[i] = xmin + k*dx
+end
+chiMeshCreateUnpartitioned1DOrthoMesh(mesh)
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+chiVolumeMesherSetMatIDToAll(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 168
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_3_170.cxs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE,40)
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 62},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 8,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+    {
+      groups_from_to = {63, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 8,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/2
+
+--############################################### Max-values of a solution
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+function GetMaxValues(phys)
+  local fflist,count = chiLBSGetScalarFieldFunctionList(phys)
+  local values = {}
+  for k,g in pairs({1, 160}) do
+    local ffi = chiFFInterpolationCreate(VOLUME)
+    chiFFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[g])
+
+    chiFFInterpolationInitialize(ffi)
+    chiFFInterpolationExecute(ffi)
+    values[k] = chiFFInterpolationGetValue(ffi)
+  end
+  return values
+end
+
+--############################################### Solve with each ordering
+max_values = {}
+for k,ags_type in pairs({"gauss_seidel", "block_jacobi"}) do
+  lbs_options =
+  {
+    boundary_conditions =
+    {
+      {
+        name = "zmin",
+        type = "incident_isotropic",
+        group_strength = bsrc
+      }
+    },
+    scattering_order = 5,
+    ags_iteration_type = ags_type,
+    ags_tolerance = 1.0e-8,
+    verbose_ags_iterations = true,
+  }
+
+  phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+  lbs.SetOptions(phys, lbs_options)
+
+  ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys})
+
+  chiSolverInitialize(ss_solver)
+  chiSolverExecute(ss_solver)
+
+  max_values[k] = GetMaxValues(phys)
+end
+
+--############################################### Compare
+passed = true
+for i=1,2 do
+  local gs_value = max_values[1][i]
+  local bj_value = max_values[2][i]
+  if (math.abs(bj_value - gs_value) > 1.0e-5 * math.abs(gs_value)) then
+    chiLog(LOG_0ERROR, string.format("Block-Jacobi max-value%d=%.8e "..
+      "differs from Gauss-Seidel max-value%d=%.8e", i, bj_value, i, gs_value))
+    passed = false
+  end
+end
+if (passed) then
+  chiLog(LOG_0, "Block-Jacobi matches Gauss-Seidel passed")
+end
+
+chiLog(LOG_0,string.format("Max-value1=%.5f", max_values[2][1]))
+chiLog(LOG_0,string.format("Max-value2=%.5e", max_values[2][2]))
@@ -0,0 +1,9 @@
+-- 1D Transport test with two groupsets solved concurrently on two energy
+-- communicators. Runs the problem of Transport1D_1c_BlockJacobi, which must
+-- be launched with --energy_comms=2 on twice its number of processes.
+-- SDM: PWLD
+-- Test: Max-value=0.49903 and 7.18243e-4
+chiLog(LOG_0, "Number of energy communicators: " ..
+              tostring(chi_number_of_energy_comms))
+
+dofile("Transport1D_1c_BlockJacobi.lua")
@@ -29,6 +29,9 @@ chiVolumeMesherSetKBACutsX({0.0})
 chiVolumeMesherSetKBACutsY({0.0})
 
 chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
+if (local_cell_ordering ~= nil) then
+  chiVolumeMesherSetProperty(LOCAL_CELL_ORDERING,local_cell_ordering)
+end
 
 chiSurfaceMesherExecute();
 chiVolumeMesherExecute();
@@ -0,0 +1,8 @@
+-- 2D Transport test with Vacuum and Incident-isotropic BC, with the local
+-- cells renumbered along a Hilbert curve ordering. Runs the problem of
+-- Transport2D_2Unstructured, the solution must not change.
+-- SDM: PWLD
+-- Test: Max-value=0.51187 and 1.42458e-03
+local_cell_ordering = LOCAL_ORDERING_HILBERT
+
+dofile("Transport2D_2Unstructured.lua")
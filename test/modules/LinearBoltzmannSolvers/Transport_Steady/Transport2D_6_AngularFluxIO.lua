@@ -0,0 +1,154 @@
+-- 2D Transport test of the angular flux binary files. The angular fluxes of a
+-- solved problem are written, read into a solver on the same mesh with its
+-- local cells renumbered along a reverse Cuthill-McKee ordering (the mapping
+-- path of the reader), written again, read back into the original solver and
+-- written once more. The first and last files must be byte-identical.
+-- SDM: PWLD
+-- Test: Angular flux round-trip test passed
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup meshes
+function CreateMesh(local_cell_ordering)
+  chiMeshHandlerCreate()
+
+  local umesh = chiUnpartitionedMeshFromWavefrontOBJ(
+    "../../../../resources/TestMeshes/SquareMesh2x2QuadsBlock.obj")
+
+  chiSurfaceMesherCreate(SURFACEMESHER_PREDEFINED);
+  chiVolumeMesherCreate(VOLUMEMESHER_UNPARTITIONED, umesh);
+
+  chiVolumeMesherSetKBAPartitioningPxPyPz(2,2,1)
+  chiVolumeMesherSetKBACutsX({0.0})
+  chiVolumeMesherSetKBACutsY({0.0})
+
+  chiVolumeMesherSetProperty(PARTITION_TYPE,KBA_STYLE_XYZ)
+  if (local_cell_ordering ~= nil) then
+    chiVolumeMesherSetProperty(LOCAL_CELL_ORDERING,local_cell_ordering)
+  end
+
+  chiSurfaceMesherExecute();
+  chiVolumeMesherExecute();
+
+  local vol0 = chi_mesh.RPPLogicalVolume.Create(
+    {infx=true, infy=true, infz=true})
+  chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+end
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 2
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.5)
+
+src={}
+for g=1,num_groups do
+  src[g] = 1.0
+end
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,4, 2)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    }
+  }
+}
+
+lbs_options =
+{
+  scattering_order = 0,
+  save_angular_flux = true,
+}
+
+--=============== Solver A, natural local cell ordering
+CreateMesh(nil)
+physA = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(physA, lbs_options)
+
+ss_solverA = lbs.SteadyStateSolver.Create({lbs_solver_handle = physA})
+chiSolverInitialize(ss_solverA)
+chiSolverExecute(ss_solverA)
+
+--=============== Solver B, RCM local cell ordering
+CreateMesh(LOCAL_ORDERING_RCM)
+physB = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(physB, lbs_options)
+
+ss_solverB = lbs.SteadyStateSolver.Create({lbs_solver_handle = physB})
+chiSolverInitialize(ss_solverB)
+
+--############################################### Round trip
+file_baseA  = "Transport2D_6_psiA"
+file_baseB  = "Transport2D_6_psiB"
+file_baseA2 = "Transport2D_6_psiA2"
+
+chiLBSWriteGroupsetAngularFlux(physA, 0, file_baseA)
+chiLBSReadGroupsetAngularFlux(physB, 0, file_baseA)
+chiLBSWriteGroupsetAngularFlux(physB, 0, file_baseB)
+chiLBSReadGroupsetAngularFlux(physA, 0, file_baseB)
+chiLBSWriteGroupsetAngularFlux(physA, 0, file_baseA2)
+
+chiMPIBarrier()
+
+--############################################### Compare files
+function ReadFile(file_name)
+  local file = io.open(file_name, "rb")
+  if (file == nil) then return nil end
+  local contents = file:read("a")
+  file:close()
+  return contents
+end
+
+if (chi_location_id == 0) then
+  local passed = true
+  for p=0,chi_number_of_processes-1 do
+    local contentsA  = ReadFile(file_baseA ..tostring(p)..".data")
+    local contentsA2 = ReadFile(file_baseA2..tostring(p)..".data")
+    if (contentsA == nil or contentsA ~= contentsA2) then
+      chiLog(LOG_0, "Angular flux file of location "..tostring(p)..
+        " changed in the round trip")
+      passed = false
+    end
+  end
+
+  if (passed) then
+    chiLog(LOG_0, "Angular flux round-trip test passed")
+  end
+end
+
+chiMPIBarrier()
+
+--############################################### Cleanup
+for _,file_base in pairs({file_baseA, file_baseB, file_baseA2}) do
+  os.remove(file_base..tostring(chi_location_id)..".data")
+end
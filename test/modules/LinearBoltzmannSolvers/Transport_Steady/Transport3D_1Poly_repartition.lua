@@ -0,0 +1,205 @@
+-- 3D Transport test with Vacuum and Incident-isotropic BC. The grid is
+-- repartitioned with measured cell costs after the first solve and the
+-- solve is repeated on the new partitions.
+-- SDM: PWLD
+-- Test: Max-value=0.52745 and 3.76339e-4
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and chi_number_of_processes ~= num_procs) then
+  chiLog(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+chiMeshHandlerCreate()
+
+Nxy = 32
+nodesxy = {}
+dxy = 2/Nxy
+dz = 1.6/8
+for i=0,(Nxy) do
+  nodesxy[i+1] = -1.0 + i*dxy
+end
+nodesz = {}
+for k=0,8 do
+  nodesz[k+1] = 0.0 + k*dz
+end
+
+chiMeshCreateUnpartitioned3DOrthoMesh(nodesxy,nodesxy,nodesz)
+chiVolumeMesherSetProperty(PARTITION_TYPE,PARMETIS)
+chiVolumeMesherExecute();
+
+--############################################### Set Material IDs
+vol0 = chi_mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol0,0)
+
+vol1 = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-0.5,xmax=0.5,ymin=-0.5,ymax=0.5, infz=true })
+chiVolumeMesherSetProperty(MATID_FROMLOGICAL,vol1,1)
+
+
+--############################################### Add materials
+materials = {}
+materials[1] = chiPhysicsAddMaterial("Test Material");
+materials[2] = chiPhysicsAddMaterial("Test Material2");
+
+chiPhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+chiPhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+chiPhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+chiPhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+
+num_groups = 21
+chiPhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+chiPhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  CHI_XSFILE,"xs_graphite_pure.cxs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+
+chiPhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+chiPhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+
+
+--############################################### Setup Physics
+pquad0 = chiCreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 20},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_type = "single",
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/4.0/math.pi;
+lbs_options =
+{
+  boundary_conditions = { { name = "zmin", type = "incident_isotropic",
+                            group_strength=bsrc}},
+  scattering_order = 1,
+  measure_cell_costs = true,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+chiSolverInitialize(ss_solver)
+chiSolverExecute(ss_solver)
+
+--############################################### Repartition
+-- The migrated flux is compared with the flux before repartitioning, both
+-- over the whole domain and over a corner region, so that cells that did
+-- not move or whose unknowns were scrambled are detected before the second
+-- solve hides them
+vol_corner = chi_mesh.RPPLogicalVolume.Create
+({ xmin=-1.0,xmax=-0.5,ymin=-1.0,ymax=-0.5, zmin=0.0,zmax=0.4 })
+
+function FluxValue(ff, logvol, operation)
+  local ffi = chiFFInterpolationCreate(VOLUME)
+  chiFFInterpolationSetProperty(ffi,OPERATION,operation)
+  chiFFInterpolationSetProperty(ffi,LOGICAL_VOLUME,logvol)
+  chiFFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+  chiFFInterpolationInitialize(ffi)
+  chiFFInterpolationExecute(ffi)
+  return chiFFInterpolationGetValue(ffi)
+end
+
+function FluxValues()
+  local ffs = chiLBSGetScalarFieldFunctionList(phys1)
+  return { FluxValue(ffs[1], vol0, OP_MAX),
+           FluxValue(ffs[20], vol0, OP_MAX),
+           FluxValue(ffs[1], vol_corner, OP_AVG),
+           FluxValue(ffs[20], vol_corner, OP_AVG) }
+end
+
+values_before = FluxValues()
+num_migrated = chiLBSRepartition(phys1)
+values_after = FluxValues()
+
+chiLog(LOG_0, "Cells migrated: "..tostring(num_migrated))
+passed = num_migrated > 0
+for i=1,#values_before do
+  chiLog(LOG_0, string.format("Migrated flux value %d: %.8e before, %.8e after",
+                              i, values_before[i], values_after[i]))
+  diff = math.abs(values_after[i] - values_before[i])
+  passed = passed and (diff <= 1.0e-10 * math.abs(values_before[i]))
+end
+if (passed) then
+  chiLog(LOG_0, "Repartition migration test passed")
+else
+  chiLog(LOG_0, "Repartition migration test failed")
+end
+
+chiSolverExecute(ss_solver)
+
+--############################################### Get field functions
+fflist,count = chiLBSGetScalarFieldFunctionList(phys1)
+
+--############################################### Slice plot
+--slices = {}
+--for k=1,count do
+--    slices[k] = chiFFInterpolationCreate(SLICE)
+--    chiFFInterpolationSetProperty(slices[k],SLICE_POINT,0.0,0.0,0.8001)
+--    chiFFInterpolationSetProperty(slices[k],ADD_FIELDFUNCTION,fflist[k])
+--    --chiFFInterpolationSetProperty(slices[k],SLICE_TANGENT,0.393,1.0-0.393,0)
+--    --chiFFInterpolationSetProperty(slices[k],SLICE_NORMAL,-(1.0-0.393),-0.393,0.0)
+--    --chiFFInterpolationSetProperty(slices[k],SLICE_BINORM,0.0,0.0,1.0)
+--    chiFFInterpolationInitialize(slices[k])
+--    chiFFInterpolationExecute(slices[k])
+--    chiFFInterpolationExportPython(slices[k])
+--end
+
+--############################################### Volume integrations
+ffi1 = chiFFInterpolationCreate(VOLUME)
+curffi = ffi1
+chiFFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[1])
+
+chiFFInterpolationInitialize(curffi)
+chiFFInterpolationExecute(curffi)
+maxval = chiFFInterpolationGetValue(curffi)
+
+chiLog(LOG_0,string.format("Max-value1=%.5e", maxval))
+
+ffi1 = chiFFInterpolationCreate(VOLUME)
+curffi = ffi1
+chiFFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+chiFFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+chiFFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[20])
+
+chiFFInterpolationInitialize(curffi)
+chiFFInterpolationExecute(curffi)
+maxval = chiFFInterpolationGetValue(curffi)
+
+chiLog(LOG_0,string.format("Max-value2=%.5e", maxval))